@@ -357,6 +357,44 @@ inline mgp_vertex *vertices_iterator_next(mgp_vertices_iterator *it) {
   return MgInvoke<mgp_vertex *>(mgp_vertices_iterator_next, it);
 }
 
+// mgp_graph_projection
+
+inline mgp_graph_projection *graph_projection_create(mgp_graph *graph, const char *label, const char *edge_type,
+                                                     const char *weight_property, mgp_memory *memory) {
+  return MgInvoke<mgp_graph_projection *>(mgp_graph_projection_create, graph, label, edge_type, weight_property,
+                                          memory);
+}
+
+inline void graph_projection_destroy(mgp_graph_projection *projection) { mgp_graph_projection_destroy(projection); }
+
+inline size_t graph_projection_vertices_count(mgp_graph_projection *projection) {
+  return MgInvoke<size_t>(mgp_graph_projection_vertices_count, projection);
+}
+
+inline size_t graph_projection_edges_count(mgp_graph_projection *projection) {
+  return MgInvoke<size_t>(mgp_graph_projection_edges_count, projection);
+}
+
+inline const uint64_t *graph_projection_offsets(mgp_graph_projection *projection) {
+  return MgInvoke<const uint64_t *>(mgp_graph_projection_offsets, projection);
+}
+
+inline const uint64_t *graph_projection_targets(mgp_graph_projection *projection) {
+  return MgInvoke<const uint64_t *>(mgp_graph_projection_targets, projection);
+}
+
+inline const double *graph_projection_weights(mgp_graph_projection *projection) {
+  return MgInvoke<const double *>(mgp_graph_projection_weights, projection);
+}
+
+inline mgp_vertex_id graph_projection_vertex_id(mgp_graph_projection *projection, size_t index) {
+  return MgInvoke<mgp_vertex_id>(mgp_graph_projection_vertex_id, projection, index);
+}
+
+inline size_t graph_projection_vertex_index(mgp_graph_projection *projection, mgp_vertex_id id) {
+  return MgInvoke<size_t>(mgp_graph_projection_vertex_index, projection, id);
+}
+
 // mgp_edges_iterator
 
 inline void edges_iterator_destroy(mgp_edges_iterator *it) { mgp_edges_iterator_destroy(it); }
@@ -1374,6 +1374,73 @@ enum mgp_error mgp_duration_sub(struct mgp_duration *first, struct mgp_duration
 enum mgp_error mgp_vertices_iterator_next(struct mgp_vertices_iterator *it, struct mgp_vertex **result);
 ///@}
 
+/// @name Graph Projection
+///
+/// A read-only projection of the graph in the compressed sparse row (CSR)
+/// format, meant for algorithms which repeatedly walk the whole graph.
+///
+/// Vertices of the projection are numbered from 0 to the number of vertices,
+/// in the order of their IDs. The outgoing relationships of the vertex `i` are
+/// `targets[offsets[i]]` up to `targets[offsets[i + 1]]`, where each target is
+/// the number of the end vertex. Relationships whose end vertex isn't part of
+/// the projection are left out. The arrays are owned by the projection and are
+/// valid until it is destroyed.
+///@{
+
+/// Read-only CSR projection of the graph.
+struct mgp_graph_projection;
+
+/// Create a projection of the vertices with the given label and their outgoing
+/// relationships of the given type, weighted by the given relationship
+/// property. Each of `label`, `edge_type` and `weight_property` may be NULL to
+/// include all vertices, all relationships, or to leave out the weights.
+/// Relationships without a numeric weight property have the weight 1.
+/// The projection is built from the graph as it is seen by the current
+/// command of the transaction, and repeated calls from the same query with the
+/// same arguments return the same projection without rebuilding it.
+/// Resulting mgp_graph_projection needs to be deallocated with mgp_graph_projection_destroy.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `graph` is a subgraph.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_graph_projection.
+enum mgp_error mgp_graph_projection_create(struct mgp_graph *graph, const char *label, const char *edge_type,
+                                           const char *weight_property, struct mgp_memory *memory,
+                                           struct mgp_graph_projection **result);
+
+/// Free the memory used by a mgp_graph_projection.
+void mgp_graph_projection_destroy(struct mgp_graph_projection *projection);
+
+/// Get the number of vertices in the projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_vertices_count(struct mgp_graph_projection *projection, size_t *result);
+
+/// Get the number of relationships in the projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_edges_count(struct mgp_graph_projection *projection, size_t *result);
+
+/// Get the array of offsets into the targets, which has one element more than
+/// there are vertices in the projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_offsets(struct mgp_graph_projection *projection, const uint64_t **result);
+
+/// Get the array of end vertices of the relationships.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_targets(struct mgp_graph_projection *projection, const uint64_t **result);
+
+/// Get the array of weights of the relationships.
+/// Result is NULL if the projection was created without a weight property.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_projection_weights(struct mgp_graph_projection *projection, const double **result);
+
+/// Get the ID of the vertex with the given number.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if the number is out of range.
+enum mgp_error mgp_graph_projection_vertex_id(struct mgp_graph_projection *projection, size_t index,
+                                              struct mgp_vertex_id *result);
+
+/// Get the number of the vertex with the given ID.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if the vertex isn't part of the projection.
+enum mgp_error mgp_graph_projection_vertex_index(struct mgp_graph_projection *projection, struct mgp_vertex_id id,
+                                                 size_t *result);
+///@}
+
 /// @name Type System
 ///
 /// The following structures and functions are used to build a type
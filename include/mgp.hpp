@@ -19,6 +19,7 @@
 #include <optional>
 #include <set>
 #include <shared_mutex>
+#include <span>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -195,6 +196,7 @@ class Graph {
  private:
   friend class Node;
   friend class Relationship;
+  friend class GraphProjection;
 
  public:
   explicit Graph(mgp_graph *graph);
@@ -349,6 +351,47 @@ class GraphRelationships {
   mgp_graph *graph_;
 };
 
+/// @brief Read-only projection of the graph in the compressed sparse row (CSR) format; wrapper class for
+/// @ref mgp_graph_projection.
+/// Nodes are numbered from 0 in the order of their IDs. The outgoing relationships of the node `i` are stored in
+/// `Targets()[Offsets()[i]]` up to `Targets()[Offsets()[i + 1]]`, each as the number of the target node.
+class GraphProjection {
+ public:
+  /// @brief Projects the nodes with the given label (all nodes if empty) and the relationships of the given type (all
+  /// relationships if empty) between them. If `weight_property` isn't empty, the projection also holds the weight of
+  /// each relationship, 1 if the relationship has no numeric value of the property.
+  explicit GraphProjection(const Graph &graph, std::string_view label = "", std::string_view type = "",
+                           std::string_view weight_property = "");
+
+  GraphProjection(const GraphProjection &) = delete;
+  GraphProjection &operator=(const GraphProjection &) = delete;
+  GraphProjection(GraphProjection &&other) noexcept;
+  GraphProjection &operator=(GraphProjection &&other) noexcept;
+
+  ~GraphProjection();
+
+  /// @brief Returns the number of projected nodes.
+  size_t NodesCount() const;
+  /// @brief Returns the number of projected relationships.
+  size_t RelationshipsCount() const;
+
+  /// @brief Returns the offsets of the relationship ranges of the nodes, `NodesCount() + 1` of them.
+  std::span<const uint64_t> Offsets() const;
+  /// @brief Returns the target nodes of the relationships.
+  std::span<const uint64_t> Targets() const;
+  /// @brief Returns the weights of the relationships, empty if the projection has no weight property.
+  std::span<const double> Weights() const;
+
+  /// @brief Returns the ID of the node with the given number.
+  Id NodeId(size_t index) const;
+  /// @brief Returns the number of the node with the given ID.
+  /// @throws OutOfRangeException if the node isn't part of the projection
+  size_t IndexOf(Id node_id) const;
+
+ private:
+  mgp_graph_projection *projection_;
+};
+
 /// @brief Wrapper class for @ref mgp_edges_iterator.
 class Relationships {
  public:
@@ -2330,6 +2373,63 @@ inline GraphRelationships::Iterator GraphRelationships::cbegin() const {
 
 inline GraphRelationships::Iterator GraphRelationships::cend() const { return Iterator(nullptr); }
 
+// GraphProjection:
+
+inline GraphProjection::GraphProjection(const Graph &graph, std::string_view label, std::string_view type,
+                                        std::string_view weight_property) {
+  const auto to_arg = [](const std::string &name) { return name.empty() ? nullptr : name.c_str(); };
+  const std::string label_str(label);
+  const std::string type_str(type);
+  const std::string weight_property_str(weight_property);
+  projection_ = mgp::MemHandlerCallback(graph_projection_create, graph.graph_, to_arg(label_str), to_arg(type_str),
+                                        to_arg(weight_property_str));
+}
+
+inline GraphProjection::GraphProjection(GraphProjection &&other) noexcept : projection_(other.projection_) {
+  other.projection_ = nullptr;
+}
+
+inline GraphProjection &GraphProjection::operator=(GraphProjection &&other) noexcept {
+  if (this != &other) {
+    if (projection_ != nullptr) mgp::graph_projection_destroy(projection_);
+    projection_ = other.projection_;
+    other.projection_ = nullptr;
+  }
+  return *this;
+}
+
+inline GraphProjection::~GraphProjection() {
+  if (projection_ != nullptr) {
+    mgp::graph_projection_destroy(projection_);
+  }
+}
+
+inline size_t GraphProjection::NodesCount() const { return mgp::graph_projection_vertices_count(projection_); }
+
+inline size_t GraphProjection::RelationshipsCount() const { return mgp::graph_projection_edges_count(projection_); }
+
+inline std::span<const uint64_t> GraphProjection::Offsets() const {
+  return {mgp::graph_projection_offsets(projection_), NodesCount() + 1};
+}
+
+inline std::span<const uint64_t> GraphProjection::Targets() const {
+  return {mgp::graph_projection_targets(projection_), RelationshipsCount()};
+}
+
+inline std::span<const double> GraphProjection::Weights() const {
+  const auto *weights = mgp::graph_projection_weights(projection_);
+  if (weights == nullptr) return {};
+  return {weights, RelationshipsCount()};
+}
+
+inline Id GraphProjection::NodeId(size_t index) const {
+  return Id::FromInt(mgp::graph_projection_vertex_id(projection_, index).as_int);
+}
+
+inline size_t GraphProjection::IndexOf(Id node_id) const {
+  return mgp::graph_projection_vertex_index(projection_, mgp_vertex_id{.as_int = node_id.AsInt()});
+}
+
 // Relationships:
 
 inline Relationships::Relationships(mgp_edges_iterator *relationships_iterator)
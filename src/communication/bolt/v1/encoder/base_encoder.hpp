@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <ranges>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 #include "communication/bolt/v1/codes.hpp"
@@ -104,9 +108,9 @@ class BaseEncoder {
     }
   }
 
-  void WriteString(const std::string &value) {
+  void WriteString(std::string_view value) {
     WriteTypeSize(value.size(), MarkerString);
-    WriteRAW(value.c_str(), value.size());
+    WriteRAW(value.data(), value.size());
   }
 
   void WriteList(const std::vector<Value> &value) {
@@ -123,27 +127,70 @@ class BaseEncoder {
   }
 
   void WriteVertex(const Vertex &vertex) {
+    const auto &props = vertex.properties;
+    WriteVertex(vertex.id.AsInt(), vertex.labels, props.size(), vertex.element_id, [&] {
+      for (const auto &prop : props) {
+        WriteString(prop.first);
+        WriteValue(prop.second);
+      }
+    });
+  }
+
+  /**
+   * Writes a node without building a `Vertex` first, so the caller can encode
+   * its own representation of labels and property values.
+   *
+   * @param labels sized range of label names
+   * @param write_properties has to write `num_properties` pairs of property
+   *        names and values
+   */
+  template <typename TLabels, typename TWriteProperties>
+  void WriteVertex(int64_t id, const TLabels &labels, size_t num_properties, std::string_view element_id,
+                   const TWriteProperties &write_properties) {
     int struct_n = 3 + 1 * int(major_v_ > 4);  // element_id introduced from v5
     WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + struct_n);
     WriteRAW(utils::UnderlyingCast(Signature::Node));
-    WriteInt(vertex.id.AsInt());
+    WriteInt(id);
 
     // write labels
-    const auto &labels = vertex.labels;
-    WriteTypeSize(labels.size(), MarkerList);
+    WriteTypeSize(std::ranges::size(labels), MarkerList);
     for (const auto &label : labels) WriteString(label);
 
     // write properties
-    const auto &props = vertex.properties;
-    WriteTypeSize(props.size(), MarkerMap);
-    for (const auto &prop : props) {
-      WriteString(prop.first);
-      WriteValue(prop.second);
-    }
+    WriteTypeSize(num_properties, MarkerMap);
+    write_properties();
 
     if (major_v_ > 4) {
       // element_id introduced in v5.0
-      WriteString(vertex.element_id);
+      WriteString(element_id);
+    }
+  }
+
+  /**
+   * Writes a relationship without building an `Edge` first, see the
+   * `WriteVertex` overload taking the properties writer.
+   */
+  template <typename TWriteProperties>
+  void WriteEdge(int64_t id, int64_t from, int64_t to, std::string_view type, size_t num_properties,
+                 const TWriteProperties &write_properties) {
+    int struct_n = 5 + 3 * int(major_v_ > 4);  // element_id introduced from v5
+    WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + struct_n);
+    WriteRAW(utils::UnderlyingCast(Signature::Relationship));
+
+    WriteInt(id);
+    WriteInt(from);
+    WriteInt(to);
+
+    WriteString(type);
+
+    WriteTypeSize(num_properties, MarkerMap);
+    write_properties();
+
+    if (major_v_ > 4) {
+      // element_id, from_element_id and to_element_id introduced in v5.0
+      WriteString(std::to_string(id));
+      WriteString(std::to_string(from));
+      WriteString(std::to_string(to));
     }
   }
 
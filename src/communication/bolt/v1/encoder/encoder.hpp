@@ -29,6 +29,7 @@ class Encoder : private BaseEncoder<Buffer> {
   using BaseEncoder<Buffer>::WriteRAW;
   using BaseEncoder<Buffer>::WriteList;
   using BaseEncoder<Buffer>::WriteMap;
+  using BaseEncoder<Buffer>::WriteTypeSize;
   using BaseEncoder<Buffer>::buffer_;
 
  public:
@@ -60,6 +61,27 @@ class Encoder : private BaseEncoder<Buffer> {
     return buffer_.Flush(true);
   }
 
+  /**
+   * Sends a Record message whose fields are written by `write_fields`.
+   *
+   * Lets the caller encode the fields straight from its own types instead of
+   * converting them to `Value`s first.
+   *
+   * @param num_fields the number of fields in the record
+   * @param write_fields called with the `BaseEncoder`, has to write exactly
+   *        `num_fields` values
+   */
+  template <typename TWriteFields>
+  bool MessageRecord(size_t num_fields, TWriteFields &&write_fields) {
+    WriteRAW(utils::UnderlyingCast(Marker::TinyStruct1));
+    WriteRAW(utils::UnderlyingCast(Signature::Record));
+    WriteTypeSize(num_fields, MarkerList);
+    write_fields(static_cast<BaseEncoder<Buffer> &>(*this));
+    // Same as the message above, the end of message chunk follows.
+    if (!buffer_.Flush(true)) return false;
+    return buffer_.Flush(true);
+  }
+
   /**
    * Sends a Success message.
    *
@@ -83,24 +83,19 @@ class Listener final {
    * @param connection socket which should be added to the event pool
    */
   void AddConnection(io::network::Socket &&connection) {
-    auto guard = std::lock_guard{lock_};
-
-    // Remember fd before moving connection into Session.
-    int fd = connection.fd();
-
     // Create a new Session for the connection.
-    sessions_.push_back(
-        std::make_unique<SessionHandler>(std::move(connection), data_, context_, inactivity_timeout_sec_));
-
-    // Register the connection in Epoll.
-    // We want to listen to an incoming event which is edge triggered and
-    // we also want to listen on the hangup event. Epoll is hard to use
-    // concurrently and that is why we use `EPOLLONESHOT`, for a detailed
-    // description what are the problems and why this is correct see:
-    // https://idea.popcount.org/2017-02-20-epoll-is-fundamentally-broken-12/
-    epoll_.Add(fd, EPOLLIN | EPOLLET | EPOLLRDHUP | EPOLLONESHOT, sessions_.back().get());
+    AddSession(std::make_unique<SessionHandler>(std::move(connection), data_, context_, inactivity_timeout_sec_));
   }
 
+  /**
+   * Sets the listener to which sessions that ask for a dedicated worker (see
+   * `Session::IsDedicated`) are moved once they are done with an execution.
+   * Must be called before the listener is started.
+   *
+   * @param listener listener with the dedicated workers
+   */
+  void SetDedicatedListener(Listener *listener) { dedicated_listener_ = listener; }
+
   /**
    * This function starts the listener
    */
@@ -218,6 +213,11 @@ class Listener final {
   bool ExecuteSession(SessionHandler &session) {
     try {
       if (session.Execute()) {
+        if (dedicated_listener_ && session.IsDedicated()) {
+          // The dedicated listener registers the socket in its own epoll.
+          MoveSession(session, dedicated_listener_);
+          return false;
+        }
         // Session execution done, rearm epoll to send events for this
         // socket.
         epoll_.Modify(session.socket().fd(), EPOLLIN | EPOLLET | EPOLLRDHUP | EPOLLONESHOT, &session);
@@ -240,6 +240,39 @@ class Listener final {
     return true;
   }
 
+  void AddSession(std::unique_ptr<SessionHandler> session) {
+    auto guard = std::lock_guard{lock_};
+
+    // Remember fd before moving the session.
+    int fd = session->socket().fd();
+    sessions_.push_back(std::move(session));
+
+    // Register the connection in Epoll.
+    // We want to listen to an incoming event which is edge triggered and
+    // we also want to listen on the hangup event. Epoll is hard to use
+    // concurrently and that is why we use `EPOLLONESHOT`, for a detailed
+    // description what are the problems and why this is correct see:
+    // https://idea.popcount.org/2017-02-20-epoll-is-fundamentally-broken-12/
+    epoll_.Add(fd, EPOLLIN | EPOLLET | EPOLLRDHUP | EPOLLONESHOT, sessions_.back().get());
+  }
+
+  void MoveSession(SessionHandler &session, Listener *listener) {
+    // The session isn't armed in epoll while it is executed, so no other
+    // worker can pick it up before it is deregistered here.
+    epoll_.Delete(session.socket().fd());
+
+    std::unique_ptr<SessionHandler> moved;
+    {
+      auto guard = std::lock_guard{lock_};
+      auto it = std::find_if(sessions_.begin(), sessions_.end(), [&](const auto &l) { return l.get() == &session; });
+      MG_ASSERT(it != sessions_.end(), "Trying to move session that is not found in sessions!");
+      moved = std::move(*it);
+      swap(*it, sessions_.back());
+      sessions_.pop_back();
+    }
+    listener->AddSession(std::move(moved));
+  }
+
   void CloseSession(SessionHandler &session) {
     // Deregister the Session's socket from epoll to disable further events. For
     // a detailed description why this is necessary before destroying (closing)
@@ -266,6 +299,8 @@ class Listener final {
   utils::SpinLock lock_;
   std::vector<std::unique_ptr<SessionHandler>> sessions_;
 
+  Listener *dedicated_listener_{nullptr};
+
   std::thread timeout_thread_;
   std::vector<std::thread> worker_threads_;
   std::atomic<bool> alive_;
@@ -38,6 +38,10 @@ namespace memgraph::communication {
  * that has `num_workers` threads. It is started automatically on constructor,
  * and stopped at destructor.
  *
+ * If `dedicated_workers_count` isn't 0, sessions that ask for it are moved to a
+ * second listener with its own threads, so they are served even while all of
+ * the regular workers are busy.
+ *
  * Current Server architecture:
  * incoming connection -> server -> listener -> session
  *
@@ -57,15 +61,21 @@ class Server final {
 
   /**
    * Constructs and binds server to endpoint, operates on session data and
-   * invokes workers_count workers
+   * invokes workers_count workers and dedicated_workers_count dedicated workers
    */
   Server(io::network::Endpoint endpoint, TSessionContext *session_context, ServerContext *context,
          int inactivity_timeout_sec, const std::string &service_name,
-         size_t workers_count = std::thread::hardware_concurrency())
+         size_t workers_count = std::thread::hardware_concurrency(), size_t dedicated_workers_count = 0)
       : alive_(false),
         endpoint_(std::move(endpoint)),
         listener_(session_context, context, inactivity_timeout_sec, service_name, workers_count),
-        service_name_(service_name) {}
+        service_name_(service_name) {
+    if (dedicated_workers_count > 0) {
+      dedicated_listener_.emplace(session_context, context, inactivity_timeout_sec,
+                                  fmt::format("{} dedicated", service_name), dedicated_workers_count);
+      listener_.SetDedicatedListener(&*dedicated_listener_);
+    }
+  }
 
   ~Server() {
     MG_ASSERT(!alive_ && !thread_.joinable(),
@@ -102,6 +112,7 @@ class Server final {
       return false;
     }
 
+    if (dedicated_listener_) dedicated_listener_->Start();
     listener_.Start();
 
     thread_ = std::thread([this]() {
@@ -127,14 +138,17 @@ class Server final {
     alive_.store(false);
     // Shutdown the socket to return from any waiting `Accept` calls.
     socket_.Shutdown();
-    // Shutdown the listener.
+    // Shutdown the listeners.
     listener_.Shutdown();
+    if (dedicated_listener_) dedicated_listener_->Shutdown();
   }
 
   /// Waits for the server to be signaled to shutdown
   void AwaitShutdown() {
     if (thread_.joinable()) thread_.join();
     listener_.AwaitShutdown();
+    // Awaited last because the regular workers can still move sessions to it.
+    if (dedicated_listener_) dedicated_listener_->AwaitShutdown();
   }
 
   /// Returns `true` if the server was started
@@ -158,6 +172,7 @@ class Server final {
   Socket socket_;
   io::network::Endpoint endpoint_;
   Listener<TSession, TSessionContext> listener_;
+  std::optional<Listener<TSession, TSessionContext>> dedicated_listener_;
 
   const std::string service_name_;
 };
@@ -260,6 +260,19 @@ class Session final {
    */
   io::network::Socket &socket() { return socket_; }
 
+  /**
+   * Returns true if the supplied `TSession` asked to be executed by dedicated
+   * workers from now on. Sessions which don't implement `IsDedicated` never
+   * ask for it.
+   */
+  bool IsDedicated() const {
+    if constexpr (requires(const TSession &session) { session.IsDedicated(); }) {
+      return session_.IsDedicated();
+    } else {
+      return false;
+    }
+  }
+
  private:
   void RefreshLastEventTime(bool active) {
     auto guard = std::unique_lock{lock_};
@@ -284,7 +284,8 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
     auto recovered_snapshot = storage::durability::LoadSnapshot(
         *maybe_snapshot_path, &storage->vertices_, &storage->edges_, &storage->edges_metadata_,
         &storage->repl_storage_state_.history, storage->name_id_mapper_.get(), &storage->edge_count_, storage->config_,
-        &storage->enum_store_, storage->config_.salient.items.enable_schema_info ? &storage->schema_info_ : nullptr);
+        &storage->enum_store_, storage->config_.salient.items.enable_schema_info ? &storage->schema_info_ : nullptr,
+        storage->string_dictionary_.get());
     spdlog::debug("Snapshot loaded successfully");
     // If this step is present it should always be the first step of
     // the recovery so we use the UUID we read from snasphost
@@ -1014,6 +1015,36 @@ uint64_t InMemoryReplicationHandlers::ReadAndApplyDeltas(storage::InMemoryStorag
         }
         break;
       }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+        std::stringstream ss;
+        utils::PrintIterable(ss, delta.operation_label_property_list.properties);
+        spdlog::trace("       Create composite label+property index on :{} ({})",
+                      delta.operation_label_property_list.label, ss.str());
+        std::vector<PropertyId> properties;
+        for (const auto &prop : delta.operation_label_property_list.properties) {
+          properties.emplace_back(storage->NameToProperty(prop));
+        }
+        auto *transaction = get_transaction_accessor(delta_timestamp, kUniqueAccess);
+        if (transaction->CreateIndex(storage->NameToLabel(delta.operation_label_property_list.label), properties)
+                .HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        std::stringstream ss;
+        utils::PrintIterable(ss, delta.operation_label_property_list.properties);
+        spdlog::trace("       Drop composite label+property index on :{} ({})",
+                      delta.operation_label_property_list.label, ss.str());
+        std::vector<PropertyId> properties;
+        for (const auto &prop : delta.operation_label_property_list.properties) {
+          properties.emplace_back(storage->NameToProperty(prop));
+        }
+        auto *transaction = get_transaction_accessor(delta_timestamp, kUniqueAccess);
+        if (transaction->DropIndex(storage->NameToLabel(delta.operation_label_property_list.label), properties)
+                .HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
     }
     applied_deltas++;
   }
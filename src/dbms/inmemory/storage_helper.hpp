@@ -26,7 +26,7 @@ inline std::unique_ptr<storage::Storage> CreateInMemoryStorage(storage::Config c
   // Connect replication state and storage
   storage->CreateSnapshotHandler(
       [storage = storage.get(), &repl_state]() -> utils::BasicResult<storage::InMemoryStorage::CreateSnapshotError> {
-        return storage->CreateSnapshot(repl_state.GetRole());
+        return storage->CreateSnapshot(repl_state.GetRole(), true);
       });
 
   return std::move(storage);
@@ -67,6 +67,15 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24UL * 3600));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_gc_workers, 1,
+                        "Number of threads the storage garbage collector uses to unlink deltas and clean up indices. "
+                        "Each database starts its own helper threads.",
+                        FLAG_IN_RANGE(1, 256));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_gc_max_transactions_per_run, 0,
+              "Maximum number of transactions unlinked by one periodic garbage collector run. Runs are repeated until "
+              "the backlog is worked off, releasing the storage locks in between. 0 means no limit.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_python_gc_cycle_sec, 180,
                         "Storage python full garbage collection interval (in seconds).", FLAG_IN_RANGE(1, 24UL * 3600));
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
@@ -87,6 +96,13 @@ DEFINE_bool(storage_wal_enabled, false,
 DEFINE_VALIDATED_uint64(storage_snapshot_retention_count, 3, "The number of snapshots that should always be kept.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_skip_threshold_percent,
+                        memgraph::storage::Config::Durability().snapshot_skip_threshold_percent,
+                        "Skip a periodic snapshot while the changes committed since the last snapshot stay below this "
+                        "percentage of the graph; the WAL files keep those changes durable. Without WAL only "
+                        "snapshots with no change since the last one are skipped. Set to 0 to always create snapshots.",
+                        FLAG_IN_RANGE(0, 100));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_wal_file_size_kib, memgraph::storage::Config::Durability().wal_file_size_kibibytes,
                         "Minimum file size of each WAL file.",
                         FLAG_IN_RANGE(1, static_cast<unsigned long>(1000) * 1024));
@@ -97,6 +113,11 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_group_commit, memgraph::storage::Config::Durability().wal_group_commit,
+            "Make every transaction durable before its commit returns. The 'fsync' calls are issued after the "
+            "transactions are committed and are shared by all transactions committed in the meantime. Overrides "
+            "storage_wal_file_flush_every_n_tx.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -123,6 +144,12 @@ DEFINE_uint64(storage_recovery_thread_count,
                        memgraph::storage::Config::Durability().recovery_thread_count),
               "The number of threads used to recover persisted data from disk.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_thread_count,
+                        std::max(static_cast<uint64_t>(std::thread::hardware_concurrency()),
+                                 memgraph::storage::Config::Durability().snapshot_thread_count),
+                        "The number of threads used to create snapshots.", FLAG_IN_RANGE(1, 1024));
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_enable_schema_metadata, false,
             "Controls whether metadata should be collected about the resident labels and edge types.");
@@ -142,6 +169,42 @@ DEFINE_bool(storage_enable_edges_metadata, false,
 DEFINE_bool(storage_delta_on_identical_property_update, true,
             "Controls whether updating a property with the same value should create a delta object.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_merge_property_deltas, false,
+            "Controls whether committing transactions merge their property deltas with older deltas on the same "
+            "property which no running transaction can tell apart, so objects updated often keep short delta chains.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_freeze_adjacency, false,
+            "Controls whether edges of each vertex should be sorted by edge type and neighbour after recovery and "
+            "after switching from the analytical storage mode, so expansions by edge type don't scan all edges.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_freeze_adjacency_degree, 10000,
+              "Edges of a vertex get sorted by edge type and neighbour once the vertex has this many edges in one "
+              "direction, so expansions by edge type don't scan all edges of a supernode. 0 disables it.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_label_property_index_hash_lookups, false,
+            "Controls whether label+property indices keep a hash table of their entries, so lookups of a single value "
+            "don't search the index. Uses additional memory for every index entry.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_object_cache_size, memgraph::storage::Config::DiskConfig().object_cache_size,
+              "Number of vertices and edges read by transactions in the on-disk storage mode which are kept in a cache "
+              "shared by all transactions, so reading them again skips RocksDB. 0 disables the cache.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(storage_dictionary_encoded_properties, "",
+              "Comma-separated list of properties whose string values are interned in a dictionary shared by all "
+              "vertices and edges of a database, so each distinct value is kept in memory only once per database. "
+              "Meant for properties with few distinct values.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_dictionary_max_strings, 100000,
+              "Maximum number of distinct strings in the dictionary of a database. Interned strings are kept until "
+              "the database is cleared, so once the dictionary is full new values are stored inline.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(schema_info_enabled, false, "Set to true to enable run-time schema info tracking.");
 
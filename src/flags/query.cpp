@@ -10,5 +10,34 @@
 // licenses/APL.txt.
 #include "flags/query.hpp"
 
+#include <limits>
+
+#include "utils/flag_validation.hpp"
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 // DEFINE_bool(cartesian_product_enabled, true, "Enable cartesian product expansion.");  Moved to run_time_configurable
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_pull_batch_size, 0,
+                        "Number of results read-only queries pull through the operators at once. Batched execution "
+                        "amortizes the per-row overhead of the operators. 0 executes queries row by row.",
+                        FLAG_IN_RANGE(0, 65536));
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_parallel_workers, 0,
+                        "Number of threads a single query can use to scan and aggregate vertices in parallel. Values "
+                        "of 0 and 1 disable parallel execution.",
+                        FLAG_IN_RANGE(0, 1024));
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_parallel_scan_threshold, 100000,
+                        "Minimum estimated number of scanned vertices for which an aggregation is executed in "
+                        "parallel. Only used when query_parallel_workers is larger than 1.",
+                        FLAG_IN_RANGE(1, std::numeric_limits<uint64_t>::max()));
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_parallel_expand_threshold, 1024,
+                        "Minimum number of vertices in a level of a breadth-first shortest path expansion for which "
+                        "the edges of the level are read in parallel. Only used when query_parallel_workers is larger "
+                        "than 1.",
+                        FLAG_IN_RANGE(1, std::numeric_limits<uint64_t>::max()));
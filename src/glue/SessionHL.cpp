@@ -21,6 +21,7 @@
 #include "glue/auth_checker.hpp"
 #include "glue/communication.hpp"
 #include "glue/query_user.hpp"
+#include "glue/result_encoder.hpp"
 #include "glue/run_id.hpp"
 #include "license/license.hpp"
 #include "query/discard_value_stream.hpp"
@@ -56,18 +57,17 @@ class TypedValueResultStreamBase {
  public:
   explicit TypedValueResultStreamBase(memgraph::storage::Storage *storage);
 
-  void DecodeValues(const std::vector<memgraph::query::TypedValue> &values);
-
-  auto AccessValues() const -> std::vector<memgraph::glue::bolt_value_t> const & { return decoded_values_; }
+  /// Reads the graph elements of the row, so encoding it can't fail halfway.
+  void PrepareValues(const std::vector<memgraph::query::TypedValue> &values);
 
  protected:
-  // NOTE: Needed only for ToBoltValue conversions
+  // NOTE: Needed only for getting names and reading graph elements
   memgraph::storage::Storage *storage_;
-  std::vector<memgraph::glue::bolt_value_t> decoded_values_;
+  memgraph::glue::ResultEncoder result_encoder_;
 };
 
-/// Wrapper around TEncoder which converts TypedValue to Value
-/// before forwarding the calls to original TEncoder.
+/// Wrapper around TEncoder which encodes TypedValue rows straight into
+/// Record messages of the original TEncoder.
 template <typename TEncoder>
 class TypedValueResultStream : public TypedValueResultStreamBase {
  public:
@@ -75,36 +75,32 @@ class TypedValueResultStream : public TypedValueResultStreamBase {
       : TypedValueResultStreamBase{storage}, encoder_(encoder) {}
 
   void Result(const std::vector<memgraph::query::TypedValue> &values) {
-    DecodeValues(values);
-    encoder_->MessageRecord(AccessValues());
+    PrepareValues(values);
+    encoder_->MessageRecord(values.size(), [&](auto &base_encoder) { result_encoder_.Write(base_encoder, values); });
   }
 
  private:
   TEncoder *encoder_;
 };
 
-void TypedValueResultStreamBase::DecodeValues(const std::vector<memgraph::query::TypedValue> &values) {
-  decoded_values_.reserve(values.size());
-  decoded_values_.clear();
-  for (const auto &v : values) {
-    auto maybe_value = memgraph::glue::ToBoltValue(v, storage_, memgraph::storage::View::NEW);
-    if (maybe_value.HasError()) {
-      switch (maybe_value.GetError()) {
-        case memgraph::storage::Error::DELETED_OBJECT:
-          throw memgraph::communication::bolt::ClientError("Returning a deleted object as a result.");
-        case memgraph::storage::Error::NONEXISTENT_OBJECT:
-          throw memgraph::communication::bolt::ClientError("Returning a nonexistent object as a result.");
-        case memgraph::storage::Error::VERTEX_HAS_EDGES:
-        case memgraph::storage::Error::SERIALIZATION_ERROR:
-        case memgraph::storage::Error::PROPERTIES_DISABLED:
-          throw memgraph::communication::bolt::ClientError("Unexpected storage error when streaming results.");
-      }
+void TypedValueResultStreamBase::PrepareValues(const std::vector<memgraph::query::TypedValue> &values) {
+  auto result = result_encoder_.Prepare(values);
+  if (result.HasError()) {
+    switch (result.GetError()) {
+      case memgraph::storage::Error::DELETED_OBJECT:
+        throw memgraph::communication::bolt::ClientError("Returning a deleted object as a result.");
+      case memgraph::storage::Error::NONEXISTENT_OBJECT:
+        throw memgraph::communication::bolt::ClientError("Returning a nonexistent object as a result.");
+      case memgraph::storage::Error::VERTEX_HAS_EDGES:
+      case memgraph::storage::Error::SERIALIZATION_ERROR:
+      case memgraph::storage::Error::PROPERTIES_DISABLED:
+        throw memgraph::communication::bolt::ClientError("Unexpected storage error when streaming results.");
     }
-    decoded_values_.emplace_back(std::move(*maybe_value));
   }
 }
 
-TypedValueResultStreamBase::TypedValueResultStreamBase(memgraph::storage::Storage *storage) : storage_(storage) {}
+TypedValueResultStreamBase::TypedValueResultStreamBase(memgraph::storage::Storage *storage)
+    : storage_(storage), result_encoder_(storage, memgraph::storage::View::NEW) {}
 
 #ifdef MG_ENTERPRISE
 void MultiDatabaseAuth(memgraph::query::QueryUserOrRole *user, std::string_view db) {
@@ -0,0 +1,115 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "glue/result_encoder.hpp"
+
+#include "communication/bolt/v1/value.hpp"
+
+namespace memgraph::glue {
+
+storage::Result<void> ResultEncoder::Prepare(const std::vector<query::TypedValue> &values) {
+  elements_.clear();
+  fallbacks_.clear();
+  for (const auto &value : values) {
+    auto result = PrepareValue(value);
+    if (result.HasError()) return result.GetError();
+  }
+  return {};
+}
+
+storage::Result<void> ResultEncoder::PrepareValue(const query::TypedValue &value) {
+  switch (value.type()) {
+    case query::TypedValue::Type::Null:
+    case query::TypedValue::Type::Bool:
+    case query::TypedValue::Type::Int:
+    case query::TypedValue::Type::Double:
+    case query::TypedValue::Type::String:
+    case query::TypedValue::Type::Date:
+    case query::TypedValue::Type::LocalTime:
+    case query::TypedValue::Type::LocalDateTime:
+    case query::TypedValue::Type::Duration:
+    case query::TypedValue::Type::ZonedDateTime:
+      return {};
+    case query::TypedValue::Type::Map:
+      for (const auto &[_, elem] : value.ValueMap()) {
+        auto result = PrepareValue(elem);
+        if (result.HasError()) return result.GetError();
+      }
+      return {};
+    case query::TypedValue::Type::List:
+      CheckDb();
+      for (const auto &elem : value.ValueList()) {
+        auto result = PrepareValue(elem);
+        if (result.HasError()) return result.GetError();
+      }
+      return {};
+    case query::TypedValue::Type::Vertex:
+      CheckDb();
+      return PrepareElement(value.ValueVertex().impl_);
+    case query::TypedValue::Type::Edge:
+      CheckDb();
+      return PrepareElement(value.ValueEdge().impl_);
+    case query::TypedValue::Type::Path:
+    case query::TypedValue::Type::Graph:
+    case query::TypedValue::Type::Enum:
+    case query::TypedValue::Type::Point2d:
+    case query::TypedValue::Type::Point3d:
+    case query::TypedValue::Type::Function: {
+      auto maybe_value = ToBoltValue(value, db_, view_);
+      if (maybe_value.HasError()) return maybe_value.GetError();
+      fallbacks_.push_back(std::move(*maybe_value));
+      return {};
+    }
+  }
+}
+
+storage::Result<void> ResultEncoder::PrepareElement(const storage::VertexAccessor &vertex) {
+  auto maybe_labels = vertex.Labels(view_);
+  if (maybe_labels.HasError()) return maybe_labels.GetError();
+  auto maybe_properties = vertex.Properties(view_);
+  if (maybe_properties.HasError()) return maybe_properties.GetError();
+  for (const auto &[_, property] : *maybe_properties) CheckEnums(property);
+  elements_.push_back({std::move(*maybe_labels), std::move(*maybe_properties)});
+  return {};
+}
+
+storage::Result<void> ResultEncoder::PrepareElement(const storage::EdgeAccessor &edge) {
+  auto maybe_properties = edge.Properties(view_);
+  if (maybe_properties.HasError()) return maybe_properties.GetError();
+  for (const auto &[_, property] : *maybe_properties) CheckEnums(property);
+  elements_.push_back({{}, std::move(*maybe_properties)});
+  return {};
+}
+
+void ResultEncoder::CheckEnums(const storage::PropertyValue &value) const {
+  switch (value.type()) {
+    case storage::PropertyValue::Type::Enum:
+      if (db_->enum_store_.ToString(value.ValueEnum()).HasError()) [[unlikely]] {
+        throw communication::bolt::ValueException("Enum not registered in the database");
+      }
+      break;
+    case storage::PropertyValue::Type::List:
+      for (const auto &elem : value.ValueList()) CheckEnums(elem);
+      break;
+    case storage::PropertyValue::Type::Map:
+      for (const auto &[_, elem] : value.ValueMap()) CheckEnums(elem);
+      break;
+    default:
+      break;
+  }
+}
+
+void ResultEncoder::CheckDb() const {
+  if (db_ == nullptr) [[unlikely]]
+    throw communication::bolt::ValueException("Database needed for TypeValue conversion.");
+}
+
+}  // namespace memgraph::glue
@@ -0,0 +1,215 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file Encoding of query results into Bolt records.
+#pragma once
+
+#include <map>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "communication/bolt/v1/value.hpp"
+#include "glue/communication.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/result.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/small_vector.hpp"
+
+namespace memgraph::glue {
+
+/// Writes result rows into a Bolt encoder without converting them to
+/// `communication::bolt::Value`s first. Label, edge type and property names
+/// are written straight from the storage name mapper and property values
+/// straight from the properties read from the storage.
+///
+/// A row is encoded in two passes. `Prepare` reads the labels and properties
+/// of all vertices and edges in the row, so storage errors are reported before
+/// anything is written and a failing row doesn't leave a partial record in
+/// the output. `Write` then writes the row using the prepared data.
+class ResultEncoder {
+ public:
+  /// @param db storage for getting names, may be null if the results contain
+  ///        no graph elements
+  ResultEncoder(const storage::Storage *db, storage::View view) : db_(db), view_(view) {}
+
+  /// Reads the graph elements of the row.
+  ///
+  /// @throw communication::bolt::ValueException if a value can't be encoded
+  storage::Result<void> Prepare(const std::vector<query::TypedValue> &values);
+
+  /// Writes the row prepared by the last `Prepare` call into the encoder.
+  template <typename TEncoder>
+  void Write(TEncoder &encoder, const std::vector<query::TypedValue> &values) {
+    next_element_ = 0;
+    next_fallback_ = 0;
+    for (const auto &value : values) WriteValue(encoder, value);
+  }
+
+ private:
+  struct Element {
+    utils::small_vector<storage::LabelId> labels;
+    std::map<storage::PropertyId, storage::PropertyValue> properties;
+  };
+
+  storage::Result<void> PrepareValue(const query::TypedValue &value);
+  storage::Result<void> PrepareElement(const storage::VertexAccessor &vertex);
+  storage::Result<void> PrepareElement(const storage::EdgeAccessor &edge);
+  /// Checks that the enums in `value` can be converted, so writing it can't
+  /// fail.
+  void CheckEnums(const storage::PropertyValue &value) const;
+  void CheckDb() const;
+
+  template <typename TEncoder>
+  void WriteValue(TEncoder &encoder, const query::TypedValue &value) {
+    switch (value.type()) {
+      case query::TypedValue::Type::Null:
+        encoder.WriteNull();
+        break;
+      case query::TypedValue::Type::Bool:
+        encoder.WriteBool(value.ValueBool());
+        break;
+      case query::TypedValue::Type::Int:
+        encoder.WriteInt(value.ValueInt());
+        break;
+      case query::TypedValue::Type::Double:
+        encoder.WriteDouble(value.ValueDouble());
+        break;
+      case query::TypedValue::Type::String:
+        encoder.WriteString(value.ValueString());
+        break;
+      case query::TypedValue::Type::Date:
+        encoder.WriteDate(value.ValueDate());
+        break;
+      case query::TypedValue::Type::LocalTime:
+        encoder.WriteLocalTime(value.ValueLocalTime());
+        break;
+      case query::TypedValue::Type::LocalDateTime:
+        encoder.WriteLocalDateTime(value.ValueLocalDateTime());
+        break;
+      case query::TypedValue::Type::Duration:
+        encoder.WriteDuration(value.ValueDuration());
+        break;
+      case query::TypedValue::Type::ZonedDateTime:
+        encoder.WriteZonedDateTime(value.ValueZonedDateTime());
+        break;
+      case query::TypedValue::Type::List: {
+        const auto &list = value.ValueList();
+        encoder.WriteTypeSize(list.size(), communication::bolt::MarkerList);
+        for (const auto &elem : list) WriteValue(encoder, elem);
+        break;
+      }
+      case query::TypedValue::Type::Map: {
+        const auto &map = value.ValueMap();
+        encoder.WriteTypeSize(map.size(), communication::bolt::MarkerMap);
+        for (const auto &[key, elem] : map) {
+          encoder.WriteString(key);
+          WriteValue(encoder, elem);
+        }
+        break;
+      }
+      case query::TypedValue::Type::Vertex: {
+        const auto &element = elements_[next_element_++];
+        const auto id = value.ValueVertex().impl_.Gid().AsInt();
+        auto labels = element.labels | std::views::transform([this](storage::LabelId label) -> const std::string & {
+                        return db_->LabelToName(label);
+                      });
+        encoder.WriteVertex(id, labels, element.properties.size(), std::to_string(id),
+                            [&] { WriteProperties(encoder, element.properties); });
+        break;
+      }
+      case query::TypedValue::Type::Edge: {
+        const auto &element = elements_[next_element_++];
+        const auto &edge = value.ValueEdge().impl_;
+        encoder.WriteEdge(edge.Gid().AsInt(), edge.FromVertex().Gid().AsInt(), edge.ToVertex().Gid().AsInt(),
+                          db_->EdgeTypeToName(edge.EdgeType()), element.properties.size(),
+                          [&] { WriteProperties(encoder, element.properties); });
+        break;
+      }
+      // Paths and graphs deduplicate their elements and enums need a lookup
+      // which can fail, so they are converted in `Prepare`.
+      case query::TypedValue::Type::Path:
+      case query::TypedValue::Type::Graph:
+      case query::TypedValue::Type::Enum:
+      case query::TypedValue::Type::Point2d:
+      case query::TypedValue::Type::Point3d:
+      case query::TypedValue::Type::Function:
+        encoder.WriteValue(fallbacks_[next_fallback_++]);
+        break;
+    }
+  }
+
+  template <typename TEncoder>
+  void WriteProperties(TEncoder &encoder, const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
+    for (const auto &[property, value] : properties) {
+      encoder.WriteString(db_->PropertyToName(property));
+      WritePropertyValue(encoder, value);
+    }
+  }
+
+  template <typename TEncoder>
+  void WritePropertyValue(TEncoder &encoder, const storage::PropertyValue &value) {
+    switch (value.type()) {
+      case storage::PropertyValue::Type::Null:
+        encoder.WriteNull();
+        break;
+      case storage::PropertyValue::Type::Bool:
+        encoder.WriteBool(value.ValueBool());
+        break;
+      case storage::PropertyValue::Type::Int:
+        encoder.WriteInt(value.ValueInt());
+        break;
+      case storage::PropertyValue::Type::Double:
+        encoder.WriteDouble(value.ValueDouble());
+        break;
+      case storage::PropertyValue::Type::String:
+        encoder.WriteString(value.ValueString());
+        break;
+      case storage::PropertyValue::Type::List: {
+        const auto &list = value.ValueList();
+        encoder.WriteTypeSize(list.size(), communication::bolt::MarkerList);
+        for (const auto &elem : list) WritePropertyValue(encoder, elem);
+        break;
+      }
+      case storage::PropertyValue::Type::Map: {
+        const auto &map = value.ValueMap();
+        encoder.WriteTypeSize(map.size(), communication::bolt::MarkerMap);
+        for (const auto &[key, elem] : map) {
+          encoder.WriteString(key);
+          WritePropertyValue(encoder, elem);
+        }
+        break;
+      }
+      // Temporal and point values convert to a `Value` without allocating,
+      // enums were checked in `Prepare`.
+      default:
+        encoder.WriteValue(ToBoltValue(value, *db_));
+        break;
+    }
+  }
+
+  const storage::Storage *db_;
+  storage::View view_;
+  // Labels and properties of the vertices and edges of the prepared row, in
+  // the order in which they are written.
+  std::vector<Element> elements_;
+  size_t next_element_{0};
+  // Values of the prepared row which are converted to `Value`s.
+  std::vector<communication::bolt::Value> fallbacks_;
+  size_t next_fallback_{0};
+};
+
+}  // namespace memgraph::glue
@@ -63,6 +63,7 @@
 #include "utils/file.hpp"
 #include "utils/logging.hpp"
 #include "utils/signals.hpp"
+#include "utils/string.hpp"
 #include "utils/sysinfo/memory.hpp"
 #include "utils/system_info.hpp"
 #include "utils/terminate_handler.hpp"
@@ -355,17 +356,22 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .workers = FLAGS_storage_gc_workers,
+             .max_transactions_per_run = FLAGS_storage_gc_max_transactions_per_run},
 
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_data_recovery_on_startup,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
+                     .snapshot_skip_threshold_percent = FLAGS_storage_snapshot_skip_threshold_percent,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
+                     .wal_group_commit = FLAGS_storage_wal_group_commit,
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
+                     .snapshot_thread_count = FLAGS_storage_snapshot_thread_count,
                      .allow_parallel_schema_creation = FLAGS_storage_parallel_schema_recovery},
       .transaction = {.isolation_level = memgraph::flags::ParseIsolationLevel()},
       .disk = {.main_storage_directory = FLAGS_data_directory + "/rocksdb_main_storage",
@@ -375,7 +381,8 @@ int main(int argc, char **argv) {
                .name_id_mapper_directory = FLAGS_data_directory + "/rocksdb_name_id_mapper",
                .id_name_mapper_directory = FLAGS_data_directory + "/rocksdb_id_name_mapper",
                .durability_directory = FLAGS_data_directory + "/rocksdb_durability",
-               .wal_directory = FLAGS_data_directory + "/rocksdb_wal"},
+               .wal_directory = FLAGS_data_directory + "/rocksdb_wal",
+               .object_cache_size = FLAGS_storage_disk_object_cache_size},
       .salient.items = {.properties_on_edges = FLAGS_storage_properties_on_edges,
                         .enable_edges_metadata =
                             FLAGS_storage_properties_on_edges ? FLAGS_storage_enable_edges_metadata : false,
@@ -385,7 +392,14 @@ int main(int argc, char **argv) {
                         .enable_edge_type_index_auto_creation =
                             FLAGS_storage_automatic_edge_type_index_creation_enabled,  // NOLINT(misc-include-cleaner)
                         .delta_on_identical_property_update = FLAGS_storage_delta_on_identical_property_update,
-                        .property_store_compression_enabled = FLAGS_storage_property_store_compression_enabled},
+                        .merge_property_deltas = FLAGS_storage_merge_property_deltas,
+                        .property_store_compression_enabled = FLAGS_storage_property_store_compression_enabled,
+                        .freeze_adjacency = FLAGS_storage_freeze_adjacency,
+                        .freeze_adjacency_degree = FLAGS_storage_freeze_adjacency_degree,
+                        .label_property_index_hash_lookups = FLAGS_storage_label_property_index_hash_lookups,
+                        .dictionary_encoded_properties =
+                            memgraph::utils::Split(FLAGS_storage_dictionary_encoded_properties, ","),
+                        .dictionary_max_strings = FLAGS_storage_dictionary_max_strings},
       .salient.storage_mode = memgraph::flags::ParseStorageMode(),
       .salient.property_store_compression_level = memgraph::flags::ParseCompressionLevel()};
   if (db_config.salient.items.enable_edge_type_index_auto_creation && !db_config.salient.items.properties_on_edges) {
@@ -12,9 +12,13 @@
 #include <gflags/gflags.h>
 
 #include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <mutex>
 #include <optional>
 #include <regex>
 #include <unordered_map>
@@ -29,6 +33,7 @@
 #include "utils/logging.hpp"
 #include "utils/message.hpp"
 #include "utils/string.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/timer.hpp"
 #include "version.hpp"
 
@@ -83,6 +88,13 @@ DEFINE_string(id_type, "STRING",
               "Which data type should be used to store the supplied node IDs. "
               "Possible options are: STRING/INTEGER");
 DEFINE_validator(id_type, &ValidateIdTypeOptions);
+DEFINE_uint64(num_threads, 1,
+              "Number of threads used to insert nodes and relationships. With more than one thread the data is "
+              "imported in the analytical storage mode and the order in which the rows are inserted (and therefore "
+              "the internal IDs) isn't deterministic.");
+DEFINE_uint64(batch_size, 1,
+              "Number of CSV rows inserted in a single transaction. By default every row is inserted in its own "
+              "transaction; larger batches make the import faster.");
 // Arguments `--nodes` and `--relationships` can be input multiple times and are
 // handled with custom parsing.
 DEFINE_string(nodes, "",
@@ -174,6 +186,102 @@ class LoadException : public memgraph::utils::BasicException {
   SPECIALIZE_GET_EXCEPTION_NAME(LoadException)
 };
 
+// Mapping of node IDs from CSV to the gids of the created vertices. The map is
+// split into shards guarded by their own locks, so the threads inserting nodes
+// rarely contend with each other.
+class NodeIdMap {
+ public:
+  // Maps the node ID to the gid returned by `create_node`, which is called
+  // only if the node ID isn't mapped yet. Returns false if it is.
+  template <typename TCreateNode>
+  bool Insert(const NodeId &node_id, TCreateNode &&create_node) {
+    auto &shard = GetShard(node_id);
+    auto guard = std::lock_guard{shard.mutex};
+    if (shard.map.contains(node_id)) return false;
+    shard.map.emplace(node_id, create_node());
+    return true;
+  }
+
+  std::optional<memgraph::storage::Gid> Find(const NodeId &node_id) const {
+    const auto &shard = GetShard(node_id);
+    auto guard = std::lock_guard{shard.mutex};
+    auto it = shard.map.find(node_id);
+    if (it == shard.map.end()) return std::nullopt;
+    return it->second;
+  }
+
+ private:
+  static constexpr size_t kNumShards = 64;
+
+  struct Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<NodeId, memgraph::storage::Gid> map;
+  };
+
+  Shard &GetShard(const NodeId &node_id) { return shards_[std::hash<NodeId>{}(node_id) % kNumShards]; }
+  const Shard &GetShard(const NodeId &node_id) const {
+    return shards_[std::hash<NodeId>{}(node_id) % kNumShards];
+  }
+
+  std::array<Shard, kNumShards> shards_;
+};
+
+// A parsed CSV row together with the number of the (first) line it was read
+// from.
+struct Row {
+  std::vector<std::string> values;
+  uint64_t row_number;
+};
+
+// Executes batches of rows. With a single thread the batches are executed
+// immediately, so the rows are inserted in the order of the CSV files.
+class BatchExecutor {
+ public:
+  explicit BatchExecutor(size_t num_threads) {
+    if (num_threads > 1) {
+      pool_.emplace(num_threads);
+      max_pending_ = 2 * num_threads;
+    }
+  }
+
+  void Execute(std::function<void()> batch) {
+    if (!pool_) {
+      batch();
+      return;
+    }
+    {
+      // Limit the number of parsed rows kept in memory.
+      auto guard = std::unique_lock{mutex_};
+      batch_finished_.wait(guard, [this] { return pending_ < max_pending_; });
+      ++pending_;
+    }
+    pool_->AddTask([this, batch = std::move(batch)] {
+      batch();
+      {
+        auto guard = std::lock_guard{mutex_};
+        --pending_;
+      }
+      batch_finished_.notify_all();
+    });
+  }
+
+  // Waits until all of the batches are executed.
+  void Wait() {
+    if (!pool_) return;
+    auto guard = std::unique_lock{mutex_};
+    batch_finished_.wait(guard, [this] { return pending_ == 0; });
+  }
+
+ private:
+  size_t max_pending_{0};
+  size_t pending_{0};
+  std::mutex mutex_;
+  std::condition_variable batch_finished_;
+  // Declared last, so the threads are joined before the members they use are
+  // destroyed.
+  std::optional<memgraph::utils::ThreadPool> pool_;
+};
+
 enum class CsvParserState {
   INITIAL_FIELD,
   NEXT_FIELD,
@@ -428,45 +536,51 @@ std::string GetIdSpace(const std::string &type) {
 }
 
 /// @throw LoadException
-void ProcessNodeRow(memgraph::storage::Storage *store, const std::vector<std::string> &row,
+void ProcessNodeRow(memgraph::storage::Storage::Accessor *acc, const std::vector<std::string> &row,
                     const std::vector<Field> &fields, const std::vector<std::string> &additional_labels,
-                    std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map) {
+                    NodeIdMap *node_id_map) {
   std::optional<NodeId> id;
-  auto acc = store->Access();
-  auto node = acc->CreateVertex();
+  for (size_t i = 0; i < row.size(); ++i) {
+    if (!memgraph::utils::StartsWith(fields[i].type, "ID")) continue;
+    if (id) throw LoadException("Only one node ID must be specified");
+    if (FLAGS_id_type == "INTEGER") {
+      // Call `StringToInt` to verify that the ID is a valid integer.
+      StringToInt(row[i]);
+    }
+    id.emplace(NodeId{row[i], GetIdSpace(fields[i].type)});
+  }
+
+  // The node is created only once its ID is known to be new, so skipped
+  // duplicates don't leave anything in the storage.
+  std::optional<memgraph::storage::VertexAccessor> created;
+  if (!id) {
+    created.emplace(acc->CreateVertex());
+  } else if (!node_id_map->Insert(*id, [&] { return created.emplace(acc->CreateVertex()).Gid(); })) {
+    if (FLAGS_skip_duplicate_nodes) {
+      spdlog::warn(memgraph::utils::MessageWithLink("Skipping duplicate node with ID '{}'.", *id,
+                                                    "https://memgr.ph/csv-import-tool"));
+      return;
+    } else {
+      throw LoadException("Node with ID '{}' already exists", *id);
+    }
+  }
+  auto &node = *created;
+
   for (size_t i = 0; i < row.size(); ++i) {
     const auto &field = fields[i];
     const auto &value = row[i];
     if (memgraph::utils::StartsWith(field.type, "ID")) {
-      if (id) throw LoadException("Only one node ID must be specified");
-      if (FLAGS_id_type == "INTEGER") {
-        // Call `StringToInt` to verify that the ID is a valid integer.
-        StringToInt(value);
-      }
-      NodeId node_id{value, GetIdSpace(field.type)};
-      auto it = node_id_map->find(node_id);
-      if (it != node_id_map->end()) {
-        if (FLAGS_skip_duplicate_nodes) {
-          spdlog::warn(memgraph::utils::MessageWithLink("Skipping duplicate node with ID '{}'.", node_id,
-                                                        "https://memgr.ph/csv-import-tool"));
-          return;
-        } else {
-          throw LoadException("Node with ID '{}' already exists", node_id);
-        }
-      }
-      node_id_map->emplace(node_id, node.Gid());
       if (!field.name.empty()) {
         memgraph::storage::PropertyValue pv_id;
         if (FLAGS_id_type == "INTEGER") {
-          pv_id = memgraph::storage::PropertyValue(StringToInt(node_id.id));
+          pv_id = memgraph::storage::PropertyValue(StringToInt(id->id));
         } else {
-          pv_id = memgraph::storage::PropertyValue(node_id.id);
+          pv_id = memgraph::storage::PropertyValue(id->id);
         }
         auto old_node_property = node.SetProperty(acc->NameToProperty(field.name), pv_id);
         if (!old_node_property.HasValue()) throw LoadException("Couldn't add property '{}' to the node", field.name);
         if (!old_node_property->IsNull()) throw LoadException("The property '{}' already exists", field.name);
       }
-      id = node_id;
     } else if (field.type == "LABEL") {
       for (const auto &label : memgraph::utils::Split(value, FLAGS_array_delimiter)) {
         auto node_label = node.AddLabel(acc->NameToLabel(label));
@@ -484,24 +598,27 @@ void ProcessNodeRow(memgraph::storage::Storage *store, const std::vector<std::st
     if (!node_label.HasValue()) throw LoadException("Couldn't add label '{}' to the node", label);
     if (!*node_label) throw LoadException("The label '{}' already exists", label);
   }
-  if (acc->Commit().HasError()) throw LoadException("Couldn't store the node");
 }
 
-void ProcessNodes(memgraph::storage::Storage *store, const std::string &nodes_path,
-                  std::optional<std::vector<Field>> *header,
-                  std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map,
-                  const std::vector<std::string> &additional_labels) {
-  std::ifstream nodes_file(nodes_path);
-  MG_ASSERT(nodes_file, "Unable to open '{}'", nodes_path);
+// Reads the rows of the CSV file and hands them over to `process_batch` in
+// batches of `FLAGS_batch_size` rows. The header is read from the file only if
+// it isn't already known.
+void ReadRows(const std::string &path, std::optional<std::vector<Field>> *header, BatchExecutor *executor,
+              const std::function<void(std::vector<Row>)> &process_batch) {
+  std::ifstream file(path);
+  MG_ASSERT(file, "Unable to open '{}'", path);
+  const auto batch_size = std::max<uint64_t>(FLAGS_batch_size, 1);
   uint64_t row_number = 1;
+  std::vector<Row> batch;
+  batch.reserve(batch_size);
   try {
     if (!*header) {
-      auto [fields, header_lines] = ReadHeader(nodes_file);
+      auto [fields, header_lines] = ReadHeader(file);
       row_number += header_lines;
       header->emplace(std::move(fields));
     }
     while (true) {
-      auto [row, lines_count] = ReadRow(nodes_file);
+      auto [row, lines_count] = ReadRow(file);
       if (lines_count == 0) break;
       if ((!FLAGS_ignore_extra_columns && row.size() != (*header)->size()) ||
           (FLAGS_ignore_extra_columns && row.size() < (*header)->size()))
@@ -512,18 +629,45 @@ void ProcessNodes(memgraph::storage::Storage *store, const std::string &nodes_pa
       if (row.size() > (*header)->size()) {
         row.resize((*header)->size());
       }
-      ProcessNodeRow(store, row, **header, additional_labels, node_id_map);
+      batch.push_back({std::move(row), row_number});
+      if (batch.size() == batch_size) {
+        executor->Execute([&process_batch, batch = std::move(batch)]() mutable { process_batch(std::move(batch)); });
+        batch = {};
+        batch.reserve(batch_size);
+      }
       row_number += lines_count;
     }
   } catch (const LoadException &e) {
-    LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, nodes_path, e.what());
+    LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, path, e.what());
+  }
+  if (!batch.empty()) {
+    executor->Execute([&process_batch, batch = std::move(batch)]() mutable { process_batch(std::move(batch)); });
   }
 }
 
+void ProcessNodes(memgraph::storage::Storage *store, const std::string &nodes_path,
+                  std::optional<std::vector<Field>> *header, NodeIdMap *node_id_map,
+                  const std::vector<std::string> &additional_labels, BatchExecutor *executor) {
+  auto process_batch = [&](std::vector<Row> rows) {
+    auto acc = store->Access();
+    for (const auto &row : rows) {
+      try {
+        ProcessNodeRow(acc.get(), row.values, **header, additional_labels, node_id_map);
+      } catch (const LoadException &e) {
+        LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row.row_number, nodes_path, e.what());
+      }
+    }
+    if (acc->Commit().HasError()) LOG_FATAL("Couldn't store the nodes from '{}'", nodes_path);
+  };
+  ReadRows(nodes_path, header, executor, process_batch);
+  // The batches reference the local state of this function.
+  executor->Wait();
+}
+
 /// @throw LoadException
-void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vector<Field> &fields,
+void ProcessRelationshipsRow(memgraph::storage::Storage::Accessor *acc, const std::vector<Field> &fields,
                              const std::vector<std::string> &row, std::optional<std::string> relationship_type,
-                             const std::unordered_map<NodeId, memgraph::storage::Gid> &node_id_map) {
+                             const NodeIdMap &node_id_map) {
   std::optional<memgraph::storage::Gid> start_id;
   std::optional<memgraph::storage::Gid> end_id;
   auto properties = memgraph::storage::PropertyValue::map_t{};
@@ -537,8 +681,8 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
         StringToInt(value);
       }
       NodeId node_id{value, GetIdSpace(field.type)};
-      auto it = node_id_map.find(node_id);
-      if (it == node_id_map.end()) {
+      auto gid = node_id_map.Find(node_id);
+      if (!gid) {
         if (FLAGS_skip_bad_relationships) {
           spdlog::warn(memgraph::utils::MessageWithLink("Skipping bad relationship with START_ID '{}'.", node_id,
                                                         "https://memgr.ph/csv-import-tool"));
@@ -547,7 +691,7 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
           throw LoadException("Node with ID '{}' does not exist", node_id);
         }
       }
-      start_id = it->second;
+      start_id = *gid;
     } else if (memgraph::utils::StartsWith(field.type, "END_ID")) {
       if (end_id) throw LoadException("Only one node ID must be specified");
       if (FLAGS_id_type == "INTEGER") {
@@ -555,8 +699,8 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
         StringToInt(value);
       }
       NodeId node_id{value, GetIdSpace(field.type)};
-      auto it = node_id_map.find(node_id);
-      if (it == node_id_map.end()) {
+      auto gid = node_id_map.Find(node_id);
+      if (!gid) {
         if (FLAGS_skip_bad_relationships) {
           spdlog::warn(memgraph::utils::MessageWithLink("Skipping bad relationship with END_ID '{}'.", node_id,
                                                         "https://memgr.ph/csv-import-tool"));
@@ -565,7 +709,7 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
           throw LoadException("Node with ID '{}' does not exist", node_id);
         }
       }
-      end_id = it->second;
+      end_id = *gid;
     } else if (field.type == "TYPE") {
       if (relationship_type) throw LoadException("Only one relationship TYPE must be specified");
       relationship_type = value;
@@ -578,7 +722,6 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
   if (!end_id) throw LoadException("END_ID must be set");
   if (!relationship_type) throw LoadException("Relationship TYPE must be set");
 
-  auto acc = store->Access();
   auto from_node = acc->FindVertex(*start_id, memgraph::storage::View::NEW);
   if (!from_node) throw LoadException("From node must be in the storage");
   auto to_node = acc->FindVertex(*end_id, memgraph::storage::View::NEW);
@@ -600,41 +743,26 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
       }
     }
   }
-
-  if (acc->Commit().HasError()) throw LoadException("Couldn't store the relationship");
 }
 
 void ProcessRelationships(memgraph::storage::Storage *store, const std::string &relationships_path,
                           const std::optional<std::string> &relationship_type,
-                          std::optional<std::vector<Field>> *header,
-                          const std::unordered_map<NodeId, memgraph::storage::Gid> &node_id_map) {
-  std::ifstream relationships_file(relationships_path);
-  MG_ASSERT(relationships_file, "Unable to open '{}'", relationships_path);
-  uint64_t row_number = 1;
-  try {
-    if (!*header) {
-      auto [fields, header_lines] = ReadHeader(relationships_file);
-      row_number += header_lines;
-      header->emplace(std::move(fields));
-    }
-    while (true) {
-      auto [row, lines_count] = ReadRow(relationships_file);
-      if (lines_count == 0) break;
-      if ((!FLAGS_ignore_extra_columns && row.size() != (*header)->size()) ||
-          (FLAGS_ignore_extra_columns && row.size() < (*header)->size()))
-        throw LoadException(
-            "Expected as many values as there are header fields (found {}, "
-            "expected {})",
-            row.size(), (*header)->size());
-      if (row.size() > (*header)->size()) {
-        row.resize((*header)->size());
+                          std::optional<std::vector<Field>> *header, const NodeIdMap &node_id_map,
+                          BatchExecutor *executor) {
+  auto process_batch = [&](std::vector<Row> rows) {
+    auto acc = store->Access();
+    for (const auto &row : rows) {
+      try {
+        ProcessRelationshipsRow(acc.get(), **header, row.values, relationship_type, node_id_map);
+      } catch (const LoadException &e) {
+        LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row.row_number, relationships_path, e.what());
       }
-      ProcessRelationshipsRow(store, **header, row, relationship_type, node_id_map);
-      row_number += lines_count;
     }
-  } catch (const LoadException &e) {
-    LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, relationships_path, e.what());
-  }
+    if (acc->Commit().HasError()) LOG_FATAL("Couldn't store the relationships from '{}'", relationships_path);
+  };
+  ReadRows(relationships_path, header, executor, process_batch);
+  // The batches reference the local state of this function.
+  executor->Wait();
 }
 
 struct NodesArgument {
@@ -710,13 +838,19 @@ int main(int argc, char *argv[]) {
     FLAGS_id_type = upper;
   }
 
-  std::unordered_map<NodeId, memgraph::storage::Gid> node_id_map;
+  NodeIdMap node_id_map;
+  BatchExecutor executor(std::max<uint64_t>(FLAGS_num_threads, 1));
+  // Concurrent transactions would conflict on the vertices they share, so the
+  // parallel import doesn't use transactional guarantees.
+  const auto storage_mode = FLAGS_num_threads > 1 ? memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL
+                                                  : memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL;
   memgraph::storage::Config config{
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = false,
                      .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::DISABLED,
                      .snapshot_on_exit = true},
-      .salient = {.items = {.properties_on_edges = FLAGS_storage_properties_on_edges}}};
+      .salient = {.storage_mode = storage_mode,
+                  .items = {.properties_on_edges = FLAGS_storage_properties_on_edges}}};
   memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
   auto store = memgraph::dbms::CreateInMemoryStorage(config, repl_state);
 
@@ -728,7 +862,7 @@ int main(int argc, char *argv[]) {
     std::optional<std::vector<Field>> header;
     for (const auto &nodes_file : files) {
       spdlog::info("Loading {}", nodes_file);
-      ProcessNodes(store.get(), nodes_file, &header, &node_id_map, additional_labels);
+      ProcessNodes(store.get(), nodes_file, &header, &node_id_map, additional_labels, &executor);
     }
   }
 
@@ -738,7 +872,7 @@ int main(int argc, char *argv[]) {
     std::optional<std::vector<Field>> header;
     for (const auto &relationships_file : files) {
       spdlog::info("Loading {}", relationships_file);
-      ProcessRelationships(store.get(), relationships_file, type, &header, node_id_map);
+      ProcessRelationships(store.get(), relationships_file, type, &header, node_id_map, &executor);
     }
   }
 
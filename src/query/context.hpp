@@ -27,6 +27,10 @@
 
 namespace memgraph::query {
 
+namespace procedure {
+class GraphProjectionCache;
+}  // namespace procedure
+
 enum class TransactionStatus {
   IDLE,
   ACTIVE,
@@ -81,6 +85,9 @@ struct ExecutionContext {
   int64_t number_of_hops{0};
   HopsLimit hops_limit;
   std::optional<uint64_t> periodic_commit_frequency;
+  /// Graph projections requested by the procedures of the query, see
+  /// `mgp_graph_projection_create`. Created on first use.
+  std::shared_ptr<procedure::GraphProjectionCache> graph_projection_cache;
 #ifdef MG_ENTERPRISE
   std::unique_ptr<FineGrainedAuthChecker> auth_checker{nullptr};
 #endif
@@ -17,7 +17,11 @@
 #include "query/plan/planner.hpp"
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/vertex_count_cache.hpp"
+#include "utils/algorithm.hpp"
+#include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/flag_validation.hpp"
+#include "utils/timer.hpp"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(query_cost_planner, true, "Use the cost-estimating query planner.");
@@ -25,8 +29,30 @@ DEFINE_bool(query_cost_planner, true, "Use the cost-estimating query planner.");
 DEFINE_VALIDATED_int32(query_plan_cache_max_size, 1000, "Maximum number of query plans to cache.",
                        FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
 
+namespace memgraph::metrics {
+extern const Event PlanCacheHit;
+extern const Event PlanCacheMiss;
+extern const Event PlanCacheEviction;
+extern const Event PlanCacheInvalidation;
+extern const Event QueryPlanningLatency_us;
+}  // namespace memgraph::metrics
+
 namespace memgraph::query {
-PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan) : plan_(std::move(plan)) {}
+PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan, DbAccessor *db_accessor) : plan_(std::move(plan)) {
+  const auto &ast_storage = plan_->GetAstStorage();
+  labels_.reserve(ast_storage.labels_.size());
+  for (const auto &label : ast_storage.labels_) {
+    labels_.push_back(db_accessor->NameToLabel(label));
+  }
+  edge_types_.reserve(ast_storage.edge_types_.size());
+  for (const auto &edge_type : ast_storage.edge_types_) {
+    edge_types_.push_back(db_accessor->NameToEdgeType(edge_type));
+  }
+}
+
+bool PlanWrapper::DependsOn(storage::LabelId label) const { return utils::Contains(labels_, label); }
+
+bool PlanWrapper::DependsOn(storage::EdgeTypeId edge_type) const { return utils::Contains(edge_types_, edge_type); }
 
 auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserParameters const &user_parameters)
     -> Parameters {
@@ -148,20 +174,49 @@ std::shared_ptr<PlanWrapper> CypherQueryToPlan(uint64_t hash, AstStorage ast_sto
   if (plan_cache) {
     auto existing_plan = plan_cache->WithLock([&](auto &cache) { return cache.get(hash); });
     if (existing_plan.has_value()) {
+      memgraph::metrics::IncrementCounter(memgraph::metrics::PlanCacheHit);
       return existing_plan.value();
     }
+    memgraph::metrics::IncrementCounter(memgraph::metrics::PlanCacheMiss);
   }
 
+  utils::Timer planning_timer;
   auto plan = std::make_shared<PlanWrapper>(
-      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers));
+      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers), db_accessor);
+  memgraph::metrics::Measure(memgraph::metrics::QueryPlanningLatency_us,
+                             planning_timer.Elapsed<std::chrono::microseconds>().count());
 
   if (plan_cache) {
-    plan_cache->WithLock([&](auto &cache) { cache.put(hash, plan); });
+    const auto evicted = plan_cache->WithLock([&](auto &cache) { return cache.put(hash, plan); });
+    memgraph::metrics::IncrementCounter(memgraph::metrics::PlanCacheEviction, evicted);
   }
 
   return plan;
 }
 
+void InvalidatePlans(PlanCacheLRU *plan_cache) {
+  const auto removed = plan_cache->WithLock([](auto &cache) {
+    const auto size = cache.size();
+    cache.reset();
+    return size;
+  });
+  memgraph::metrics::IncrementCounter(memgraph::metrics::PlanCacheInvalidation, removed);
+}
+
+void InvalidatePlans(PlanCacheLRU *plan_cache, storage::LabelId label) {
+  const auto removed = plan_cache->WithLock([label](auto &cache) {
+    return cache.erase_if([label](auto, const auto &plan) { return plan->DependsOn(label); });
+  });
+  memgraph::metrics::IncrementCounter(memgraph::metrics::PlanCacheInvalidation, removed);
+}
+
+void InvalidatePlans(PlanCacheLRU *plan_cache, storage::EdgeTypeId edge_type) {
+  const auto removed = plan_cache->WithLock([edge_type](auto &cache) {
+    return cache.erase_if([edge_type](auto, const auto &plan) { return plan->DependsOn(edge_type); });
+  });
+  memgraph::metrics::IncrementCounter(memgraph::metrics::PlanCacheInvalidation, removed);
+}
+
 SingleNodeLogicalPlan::SingleNodeLogicalPlan(std::unique_ptr<plan::LogicalOperator> root, double cost,
                                              AstStorage storage, SymbolTable symbol_table)
     : root_(std::move(root)), cost_(cost), storage_(std::move(storage)), symbol_table_(std::move(symbol_table)) {}
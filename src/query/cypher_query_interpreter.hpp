@@ -16,6 +16,7 @@
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/frontend/stripped.hpp"
 #include "query/parameters.hpp"
+#include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/lru_cache.hpp"
 #include "utils/synchronized.hpp"
@@ -33,6 +34,7 @@ namespace plan {
 class LogicalOperator;
 }
 
+class DbAccessor;
 class SymbolTable;
 class Query;
 
@@ -62,15 +64,26 @@ auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserP
 
 class PlanWrapper {
  public:
-  explicit PlanWrapper(std::unique_ptr<LogicalPlan> plan);
+  /// @param db_accessor used to resolve the labels and edge types the plan
+  /// depends on.
+  PlanWrapper(std::unique_ptr<LogicalPlan> plan, DbAccessor *db_accessor);
 
   const auto &plan() const { return plan_->GetRoot(); }
   double cost() const { return plan_->GetCost(); }
   const auto &symbol_table() const { return plan_->GetSymbolTable(); }
   const auto &ast_storage() const { return plan_->GetAstStorage(); }
 
+  /// Returns whether the query references the label. Indices and statistics
+  /// of labels and edge types the query doesn't reference can't change its
+  /// plan.
+  bool DependsOn(storage::LabelId label) const;
+  /// Returns whether the query references the edge type.
+  bool DependsOn(storage::EdgeTypeId edge_type) const;
+
  private:
   std::unique_ptr<LogicalPlan> plan_;
+  std::vector<storage::LabelId> labels_;
+  std::vector<storage::EdgeTypeId> edge_types_;
 };
 
 struct CachedQuery {
@@ -128,6 +141,17 @@ class SingleNodeLogicalPlan final : public LogicalPlan {
 using PlanCacheLRU =
     utils::Synchronized<utils::LRUCache<uint64_t, std::shared_ptr<query::PlanWrapper>>, utils::RWSpinLock>;
 
+/// Removes all cached plans.
+void InvalidatePlans(PlanCacheLRU *plan_cache);
+
+/// Removes the cached plans which depend on the label, after an index on it
+/// was created or dropped or its statistics changed.
+void InvalidatePlans(PlanCacheLRU *plan_cache, storage::LabelId label);
+
+/// Removes the cached plans which depend on the edge type, after an index on
+/// it was created or dropped.
+void InvalidatePlans(PlanCacheLRU *plan_cache, storage::EdgeTypeId edge_type);
+
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
                                              const std::vector<Identifier *> &predefined_identifiers);
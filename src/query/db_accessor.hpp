@@ -247,6 +247,20 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, view));
   }
 
+  std::vector<VerticesIterable> ChunkedVertices(storage::View view, size_t num_chunks) {
+    std::vector<VerticesIterable> chunks;
+    for (auto &chunk : accessor_->ChunkedVertices(view, num_chunks)) chunks.emplace_back(std::move(chunk));
+    return chunks;
+  }
+
+  std::vector<VerticesIterable> ChunkedVertices(storage::View view, storage::LabelId label, size_t num_chunks) {
+    std::vector<VerticesIterable> chunks;
+    for (auto &chunk : accessor_->ChunkedVertices(label, view, num_chunks)) chunks.emplace_back(std::move(chunk));
+    return chunks;
+  }
+
+  void SetConcurrentReaders(bool concurrent_readers) { accessor_->SetConcurrentReaders(concurrent_readers); }
+
   VerticesIterable Vertices(storage::View view, storage::LabelId label, storage::PropertyId property) {
     return VerticesIterable(accessor_->Vertices(label, property, view));
   }
@@ -262,6 +276,13 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, property, lower, upper, view));
   }
 
+  VerticesIterable Vertices(storage::View view, storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                            const std::vector<storage::PropertyValue> &prefix,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return VerticesIterable(accessor_->Vertices(label, properties, prefix, lower, upper, view));
+  }
+
   EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type) {
     return EdgesIterable(accessor_->Edges(edge_type, view));
   }
@@ -444,6 +465,14 @@ class DbAccessor final {
     return accessor_->LabelPropertyIndexExists(label, prop);
   }
 
+  bool LabelPropertyIndexExists(storage::LabelId label, const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->LabelPropertyIndexExists(label, properties);
+  }
+
+  std::vector<std::pair<storage::LabelId, std::vector<storage::PropertyId>>> ListCompositeIndices() const {
+    return accessor_->ListCompositeIndices();
+  }
+
   bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) const { return accessor_->EdgeTypeIndexExists(edge_type); }
 
   bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
@@ -512,6 +541,15 @@ class DbAccessor final {
     return accessor_->ApproximateVertexCount(label, property, lower, upper);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->ApproximateVertexCount(label, properties);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &values) const {
+    return accessor_->ApproximateVertexCount(label, properties, values);
+  }
+
   int64_t EdgesCount(storage::EdgeTypeId edge_type) const { return accessor_->ApproximateEdgeCount(edge_type); }
 
   int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
@@ -551,6 +589,11 @@ class DbAccessor final {
     return accessor_->CreateIndex(label, property);
   }
 
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateIndex(
+      storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    return accessor_->CreateIndex(label, properties);
+  }
+
   utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateIndex(storage::EdgeTypeId edge_type) {
     return accessor_->CreateIndex(edge_type);
   }
@@ -569,6 +612,11 @@ class DbAccessor final {
     return accessor_->DropIndex(label, property);
   }
 
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> DropIndex(
+      storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    return accessor_->DropIndex(label, properties);
+  }
+
   utils::BasicResult<storage::StorageIndexDefinitionError, void> DropIndex(storage::EdgeTypeId edge_type) {
     return accessor_->DropIndex(edge_type);
   }
@@ -306,6 +306,15 @@ void DumpLabelPropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::L
       << ");";
 }
 
+void DumpLabelPropertyCompositeIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
+                                     const std::vector<storage::PropertyId> &properties) {
+  *os << "CREATE INDEX ON :" << EscapeName(dba->LabelToName(label)) << "(";
+  utils::PrintIterable(*os, properties, ", ", [&dba](auto &stream, const auto &property) {
+    stream << EscapeName(dba->PropertyToName(property));
+  });
+  *os << ");";
+}
+
 void DumpTextIndex(std::ostream *os, query::DbAccessor *dba, const std::string &index_name, storage::LabelId label) {
   *os << "CREATE TEXT INDEX " << EscapeName(index_name) << " ON :" << EscapeName(dba->LabelToName(label)) << ";";
 }
@@ -527,19 +536,26 @@ PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyIndicesPullChunk() {
       indices_info_.emplace(dba_->ListAllIndices());
     }
     const auto &label_property = indices_info_->label_property;
+    const auto &label_property_composite = indices_info_->label_property_composite;
+    const auto total = label_property.size() + label_property_composite.size();
 
     size_t local_counter = 0;
-    while (global_index < label_property.size() && (!n || local_counter < *n)) {
+    while (global_index < total && (!n || local_counter < *n)) {
       std::ostringstream os;
-      const auto &label_property_index = label_property[global_index];
-      DumpLabelPropertyIndex(&os, dba_, label_property_index.first, label_property_index.second);
+      if (global_index < label_property.size()) {
+        const auto &label_property_index = label_property[global_index];
+        DumpLabelPropertyIndex(&os, dba_, label_property_index.first, label_property_index.second);
+      } else {
+        const auto &composite_index = label_property_composite[global_index - label_property.size()];
+        DumpLabelPropertyCompositeIndex(&os, dba_, composite_index.first, composite_index.second);
+      }
       stream->Result({TypedValue(os.str())});
 
       ++global_index;
       ++local_counter;
     }
 
-    if (global_index == label_property.size()) {
+    if (global_index == total) {
       return local_counter;
     }
 
@@ -356,9 +356,8 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::CREATE;
   index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
-  if (ctx->propertyKeyName()) {
-    auto name_key = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
-    index_query->properties_ = {name_key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    index_query->properties_.push_back(std::any_cast<PropertyIx>(property_key_name->accept(this)));
   }
   return index_query;
 }
@@ -366,9 +365,8 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
 antlrcpp::Any CypherMainVisitor::visitDropIndex(MemgraphCypher::DropIndexContext *ctx) {
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::DROP;
-  if (ctx->propertyKeyName()) {
-    auto key = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
-    index_query->properties_ = {key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    index_query->properties_.push_back(std::any_cast<PropertyIx>(property_key_name->accept(this)));
   }
   index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
   return index_query;
@@ -0,0 +1,355 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/compiled_expression.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+#include "query/exceptions.hpp"
+#include "utils/exceptions.hpp"
+#include "utils/logging.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+/// Result of `lhs < rhs` and `lhs == rhs`, from which every comparison is
+/// derived the same way as the `TypedValue` operators derive them.
+struct Ordering {
+  bool less;
+  bool equal;
+};
+
+/// Orders a stored property value and a constant, if they are both numbers or
+/// both strings. Other values are compared as `TypedValue`s.
+std::optional<Ordering> OrderStored(const storage::PropertyValue &stored, const TypedValue &constant,
+                                    bool stored_on_left) {
+  auto order = [stored_on_left](const auto &stored, const auto &constant) {
+    return stored_on_left ? Ordering{stored < constant, stored == constant}
+                          : Ordering{constant < stored, constant == stored};
+  };
+  if (stored.IsInt() && constant.IsInt()) return order(stored.ValueInt(), constant.ValueInt());
+  if (stored.IsString() && constant.IsString()) {
+    return order(std::string_view{stored.ValueString()}, std::string_view{constant.ValueString()});
+  }
+  if ((stored.IsInt() || stored.IsDouble()) && constant.IsNumeric()) {
+    const auto stored_double = stored.IsInt() ? static_cast<double>(stored.ValueInt()) : stored.ValueDouble();
+    const auto constant_double = constant.IsInt() ? static_cast<double>(constant.ValueInt()) : constant.ValueDouble();
+    return order(stored_double, constant_double);
+  }
+  return std::nullopt;
+}
+
+/// Unary operators compiled as the corresponding `ExpressionEvaluator` visits.
+template <typename TOp>
+std::function<TypedValue(ExpressionEvaluator &)> UnaryNode(std::function<TypedValue(ExpressionEvaluator &)> operand,
+                                                           TOp op, std::string_view cypher_op) {
+  return [operand = std::move(operand), op, cypher_op](ExpressionEvaluator &evaluator) {
+    auto value = operand(evaluator);
+    try {
+      return op(value);
+    } catch (const TypedValueException &) {
+      throw QueryRuntimeException("Invalid type {} for '{}'.", value.type(), cypher_op);
+    }
+  };
+}
+
+/// Binary operators compiled as the corresponding `ExpressionEvaluator` visits.
+template <typename TOp>
+std::function<TypedValue(ExpressionEvaluator &)> BinaryNode(std::function<TypedValue(ExpressionEvaluator &)> lhs,
+                                                            std::function<TypedValue(ExpressionEvaluator &)> rhs,
+                                                            TOp op, std::string_view cypher_op) {
+  return [lhs = std::move(lhs), rhs = std::move(rhs), op, cypher_op](ExpressionEvaluator &evaluator) {
+    auto value1 = lhs(evaluator);
+    auto value2 = rhs(evaluator);
+    try {
+      return op(value1, value2);
+    } catch (const TypedValueException &) {
+      throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", value1.type(), value2.type(), cypher_op);
+    }
+  };
+}
+
+}  // namespace
+
+CompiledExpression::CompiledExpression(Expression *expression, ExpressionEvaluator &evaluator)
+    : root_(Compile(expression, evaluator).node) {}
+
+bool CompiledExpression::EvaluateFilter(ExpressionEvaluator &evaluator) const {
+  auto result = Evaluate(evaluator);
+  // Null is treated like false.
+  if (result.IsNull()) return false;
+  if (result.type() != TypedValue::Type::Bool)
+    throw QueryRuntimeException("Filter expression must evaluate to bool or null, got {}.", result.type());
+  return result.ValueBool();
+}
+
+CompiledExpression::CompiledNode CompiledExpression::Constant(TypedValue value) {
+  auto node = [value](ExpressionEvaluator &evaluator) { return TypedValue(value, evaluator.GetMemoryResource()); };
+  return {std::move(node), std::move(value)};
+}
+
+CompiledExpression::CompiledNode CompiledExpression::Compile(Expression *expression, ExpressionEvaluator &evaluator) {
+  // Evaluates the operator once if all of its operands are constant. If that
+  // fails, the error is left to be raised when a row is evaluated, as it would
+  // be without compilation.
+  auto fold = [&](Node node, std::initializer_list<const CompiledNode *> operands) -> CompiledNode {
+    if (std::all_of(operands.begin(), operands.end(), [](const auto *operand) { return operand->constant; })) {
+      try {
+        return Constant(expression->Accept(evaluator));
+      } catch (const utils::BasicException &) {
+      }
+    }
+    return {std::move(node), std::nullopt};
+  };
+
+  if (auto *literal = utils::Downcast<PrimitiveLiteral>(expression)) {
+    return Constant(TypedValue(literal->value_, evaluator.GetMemoryResource()));
+  }
+  if (utils::Downcast<ParameterLookup>(expression)) {
+    return Constant(expression->Accept(evaluator));
+  }
+  if (auto *identifier = utils::Downcast<Identifier>(expression)) {
+    const auto symbol = evaluator.symbol_table_->at(*identifier);
+    return {[symbol](ExpressionEvaluator &evaluator) {
+              return TypedValue(evaluator.frame_->at(symbol), evaluator.GetMemoryResource());
+            },
+            std::nullopt};
+  }
+  if (auto *lookup = utils::Downcast<PropertyLookup>(expression)) {
+    return {CompilePropertyLookup(lookup, evaluator), std::nullopt};
+  }
+
+  if (auto *op = utils::Downcast<AndOperator>(expression)) {
+    auto lhs = Compile(op->expression1_, evaluator);
+    auto rhs = Compile(op->expression2_, evaluator);
+    auto node = [lhs = lhs.node, rhs = rhs.node](ExpressionEvaluator &evaluator) {
+      auto value1 = lhs(evaluator);
+      if (value1.IsBool() && !value1.ValueBool()) {
+        // If first expression is false, don't evaluate the second one.
+        return value1;
+      }
+      auto value2 = rhs(evaluator);
+      try {
+        return value1 && value2;
+      } catch (const TypedValueException &) {
+        throw QueryRuntimeException("Invalid types: {} and {} for AND.", value1.type(), value2.type());
+      }
+    };
+    return fold(std::move(node), {&lhs, &rhs});
+  }
+  if (auto *op = utils::Downcast<OrOperator>(expression)) {
+    auto lhs = Compile(op->expression1_, evaluator);
+    auto rhs = Compile(op->expression2_, evaluator);
+    auto node = [lhs = lhs.node, rhs = rhs.node](ExpressionEvaluator &evaluator) {
+      auto value1 = lhs(evaluator);
+      if (value1.IsBool() && value1.ValueBool()) {
+        // If first expression is true, don't evaluate the second one.
+        return value1;
+      }
+      auto value2 = rhs(evaluator);
+      try {
+        return value1 || value2;
+      } catch (const TypedValueException &) {
+        throw QueryRuntimeException("Invalid types: {} and {} for OR.", value1.type(), value2.type());
+      }
+    };
+    return fold(std::move(node), {&lhs, &rhs});
+  }
+  if (auto *op = utils::Downcast<RangeOperator>(expression)) {
+    auto lhs = Compile(op->expr1_, evaluator);
+    auto rhs = Compile(op->expr2_, evaluator);
+    auto node = [lhs = lhs.node, rhs = rhs.node](ExpressionEvaluator &evaluator) {
+      return lhs(evaluator) && rhs(evaluator);
+    };
+    return fold(std::move(node), {&lhs, &rhs});
+  }
+
+  if (auto *op = utils::Downcast<EqualOperator>(expression)) return CompileComparison(op, Comparison::EQUAL, evaluator);
+  if (auto *op = utils::Downcast<NotEqualOperator>(expression)) {
+    return CompileComparison(op, Comparison::NOT_EQUAL, evaluator);
+  }
+  if (auto *op = utils::Downcast<LessOperator>(expression)) return CompileComparison(op, Comparison::LESS, evaluator);
+  if (auto *op = utils::Downcast<GreaterOperator>(expression)) {
+    return CompileComparison(op, Comparison::GREATER, evaluator);
+  }
+  if (auto *op = utils::Downcast<LessEqualOperator>(expression)) {
+    return CompileComparison(op, Comparison::LESS_EQUAL, evaluator);
+  }
+  if (auto *op = utils::Downcast<GreaterEqualOperator>(expression)) {
+    return CompileComparison(op, Comparison::GREATER_EQUAL, evaluator);
+  }
+
+#define COMPILE_BINARY_OPERATOR(OP_NODE, CPP_OP, CYPHER_OP)                                                    \
+  if (auto *op = utils::Downcast<OP_NODE>(expression)) {                                                       \
+    auto lhs = Compile(op->expression1_, evaluator);                                                           \
+    auto rhs = Compile(op->expression2_, evaluator);                                                           \
+    auto node = BinaryNode(                                                                                    \
+        lhs.node, rhs.node, [](const TypedValue &a, const TypedValue &b) { return a CPP_OP b; }, #CYPHER_OP); \
+    return fold(std::move(node), {&lhs, &rhs});                                                                \
+  }
+
+#define COMPILE_UNARY_OPERATOR(OP_NODE, CPP_OP, CYPHER_OP)                                                      \
+  if (auto *op = utils::Downcast<OP_NODE>(expression)) {                                                        \
+    auto operand = Compile(op->expression_, evaluator);                                                         \
+    auto node = UnaryNode(operand.node, [](const TypedValue &value) { return CPP_OP value; }, #CYPHER_OP); \
+    return fold(std::move(node), {&operand});                                                                   \
+  }
+
+  COMPILE_BINARY_OPERATOR(XorOperator, ^, XOR);
+  COMPILE_BINARY_OPERATOR(AdditionOperator, +, +);
+  COMPILE_BINARY_OPERATOR(SubtractionOperator, -, -);
+  COMPILE_BINARY_OPERATOR(MultiplicationOperator, *, *);
+  COMPILE_BINARY_OPERATOR(DivisionOperator, /, /);
+  COMPILE_BINARY_OPERATOR(ModOperator, %, %);
+
+  COMPILE_UNARY_OPERATOR(NotOperator, !, NOT);
+  COMPILE_UNARY_OPERATOR(UnaryPlusOperator, +, +);
+  COMPILE_UNARY_OPERATOR(UnaryMinusOperator, -, -);
+
+#undef COMPILE_BINARY_OPERATOR
+#undef COMPILE_UNARY_OPERATOR
+
+  if (auto *op = utils::Downcast<IsNullOperator>(expression)) {
+    auto operand = Compile(op->expression_, evaluator);
+    auto node = [operand = operand.node](ExpressionEvaluator &evaluator) {
+      return TypedValue(operand(evaluator).IsNull(), evaluator.GetMemoryResource());
+    };
+    return fold(std::move(node), {&operand});
+  }
+
+  // Everything else is evaluated by walking the AST.
+  return {[expression](ExpressionEvaluator &evaluator) { return expression->Accept(evaluator); }, std::nullopt};
+}
+
+CompiledExpression::CompiledNode CompiledExpression::CompileComparison(BinaryOperator *op, Comparison comparison,
+                                                                       ExpressionEvaluator &evaluator) {
+  auto lhs = Compile(op->expression1_, evaluator);
+  auto rhs = Compile(op->expression2_, evaluator);
+  if (lhs.constant && rhs.constant) {
+    try {
+      return Constant(Compare(comparison, *lhs.constant, *rhs.constant));
+    } catch (const QueryRuntimeException &) {
+    }
+  }
+  if (rhs.constant) {
+    if (auto node = CompilePropertyComparison(op->expression1_, *rhs.constant, comparison, true, evaluator)) {
+      return {std::move(*node), std::nullopt};
+    }
+  }
+  if (lhs.constant) {
+    if (auto node = CompilePropertyComparison(op->expression2_, *lhs.constant, comparison, false, evaluator)) {
+      return {std::move(*node), std::nullopt};
+    }
+  }
+  return {[comparison, lhs = lhs.node, rhs = rhs.node](ExpressionEvaluator &evaluator) {
+            auto value1 = lhs(evaluator);
+            auto value2 = rhs(evaluator);
+            return Compare(comparison, value1, value2);
+          },
+          std::nullopt};
+}
+
+CompiledExpression::Node CompiledExpression::CompilePropertyLookup(PropertyLookup *lookup,
+                                                                   ExpressionEvaluator &evaluator) {
+  auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+  if (!identifier || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) {
+    return [lookup](ExpressionEvaluator &evaluator) { return lookup->Accept(evaluator); };
+  }
+  const auto symbol = evaluator.symbol_table_->at(*identifier);
+  const auto property = evaluator.ctx_->properties[lookup->property_.ix];
+  return [lookup, symbol, property](ExpressionEvaluator &evaluator) {
+    const auto &object = evaluator.frame_->at(symbol);
+    if (object.IsVertex()) {
+      return TypedValue(evaluator.GetProperty(object.ValueVertex(), property), evaluator.GetMemoryResource());
+    }
+    if (object.IsEdge()) {
+      return TypedValue(evaluator.GetProperty(object.ValueEdge(), property), evaluator.GetMemoryResource());
+    }
+    return lookup->Accept(evaluator);
+  };
+}
+
+std::optional<CompiledExpression::Node> CompiledExpression::CompilePropertyComparison(
+    Expression *lookup_expression, const TypedValue &constant, Comparison comparison, bool property_on_left,
+    ExpressionEvaluator &evaluator) {
+  auto *lookup = utils::Downcast<PropertyLookup>(lookup_expression);
+  if (!lookup || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) return std::nullopt;
+  auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+  if (!identifier || !(constant.IsNumeric() || constant.IsString())) return std::nullopt;
+
+  const auto symbol = evaluator.symbol_table_->at(*identifier);
+  const auto property = evaluator.ctx_->properties[lookup->property_.ix];
+  return [lookup, symbol, property, constant, comparison, property_on_left](ExpressionEvaluator &evaluator) {
+    auto *memory = evaluator.GetMemoryResource();
+    const auto &object = evaluator.frame_->at(symbol);
+    std::optional<storage::PropertyValue> stored;
+    if (object.IsVertex()) {
+      stored.emplace(evaluator.GetProperty(object.ValueVertex(), property));
+    } else if (object.IsEdge()) {
+      stored.emplace(evaluator.GetProperty(object.ValueEdge(), property));
+    }
+
+    if (stored) {
+      // Comparing null with a number or a string always results in null.
+      if (stored->IsNull()) return TypedValue(memory);
+      if (auto ordering = OrderStored(*stored, constant, property_on_left)) {
+        switch (comparison) {
+          case Comparison::EQUAL:
+            return TypedValue(ordering->equal, memory);
+          case Comparison::NOT_EQUAL:
+            return TypedValue(!ordering->equal, memory);
+          case Comparison::LESS:
+            return TypedValue(ordering->less, memory);
+          case Comparison::GREATER:
+            return TypedValue(!(ordering->less || ordering->equal), memory);
+          case Comparison::LESS_EQUAL:
+            return TypedValue(ordering->less || ordering->equal, memory);
+          case Comparison::GREATER_EQUAL:
+            return TypedValue(!ordering->less, memory);
+        }
+      }
+    }
+
+    auto value = stored ? TypedValue(*stored, memory) : lookup->Accept(evaluator);
+    return property_on_left ? Compare(comparison, value, constant) : Compare(comparison, constant, value);
+  };
+}
+
+TypedValue CompiledExpression::Compare(Comparison comparison, const TypedValue &lhs, const TypedValue &rhs) {
+  try {
+    switch (comparison) {
+      case Comparison::EQUAL:
+        return lhs == rhs;
+      case Comparison::NOT_EQUAL:
+        return lhs != rhs;
+      case Comparison::LESS:
+        return lhs < rhs;
+      case Comparison::GREATER:
+        return lhs > rhs;
+      case Comparison::LESS_EQUAL:
+        return lhs <= rhs;
+      case Comparison::GREATER_EQUAL:
+        return lhs >= rhs;
+    }
+  } catch (const TypedValueException &) {
+    constexpr std::string_view kCypherOps[] = {"=", "<>", "<", ">", "<=", ">="};
+    throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", lhs.type(), rhs.type(),
+                                kCypherOps[static_cast<uint8_t>(comparison)]);
+  }
+  LOG_FATAL("Unknown comparison");
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,74 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/typed_value.hpp"
+
+namespace memgraph::query {
+
+/// An expression compiled into a tree of closures, so evaluating it for every
+/// row doesn't walk the AST with `ExpressionEvaluator`.
+///
+/// Identifiers and property names are resolved to frame positions and property
+/// ids once, subexpressions of literals and parameters are folded into
+/// constants and comparisons of a property with a numeric or string constant
+/// are done on the stored value, without converting it to a `TypedValue`.
+/// Other subexpressions are evaluated by the evaluator passed to `Evaluate`, so
+/// the result is always the same as `expression->Accept(evaluator)`.
+///
+/// Parameters are folded as well, so an expression is compiled for each
+/// execution of a query, by the cursor evaluating it.
+class CompiledExpression {
+ public:
+  /// Compiles `expression` for the query executed by `evaluator`. Constant
+  /// subexpressions are evaluated right away.
+  CompiledExpression(Expression *expression, ExpressionEvaluator &evaluator);
+
+  TypedValue Evaluate(ExpressionEvaluator &evaluator) const { return root_(evaluator); }
+
+  /// Evaluates the expression as a filter, where null is treated like false.
+  /// @throw QueryRuntimeException if the result isn't a bool or null.
+  bool EvaluateFilter(ExpressionEvaluator &evaluator) const;
+
+ private:
+  using Node = std::function<TypedValue(ExpressionEvaluator &)>;
+
+  struct CompiledNode {
+    Node node;
+    /// Value of the subexpression if it doesn't depend on the row.
+    std::optional<TypedValue> constant;
+  };
+
+  enum class Comparison : uint8_t { EQUAL, NOT_EQUAL, LESS, GREATER, LESS_EQUAL, GREATER_EQUAL };
+
+  static CompiledNode Constant(TypedValue value);
+  static CompiledNode Compile(Expression *expression, ExpressionEvaluator &evaluator);
+  static CompiledNode CompileComparison(BinaryOperator *op, Comparison comparison, ExpressionEvaluator &evaluator);
+  static Node CompilePropertyLookup(PropertyLookup *lookup, ExpressionEvaluator &evaluator);
+  /// Returns the node comparing a property of an identifier with a constant,
+  /// if the comparison can be done on the stored value.
+  static std::optional<Node> CompilePropertyComparison(Expression *lookup_expression, const TypedValue &constant,
+                                                       Comparison comparison, bool property_on_left,
+                                                       ExpressionEvaluator &evaluator);
+  static TypedValue Compare(Comparison comparison, const TypedValue &lhs, const TypedValue &rhs);
+
+  Node root_;
+};
+
+}  // namespace memgraph::query
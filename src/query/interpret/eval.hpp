@@ -181,7 +181,11 @@ class PrimitiveLiteralExpressionEvaluator : public ExpressionVisitor<TypedValue>
  private:
   EvaluationContext const *ctx_;
 };
+class CompiledExpression;
+
 class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
+  friend class CompiledExpression;
+
  public:
   ExpressionEvaluator(Frame *frame, const SymbolTable &symbol_table, const EvaluationContext &ctx, DbAccessor *dba,
                       storage::View view, FrameChangeCollector *frame_change_collector = nullptr)
@@ -879,7 +883,12 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
 
   template <class TRecordAccessor>
   storage::PropertyValue GetProperty(const TRecordAccessor &record_accessor, const PropertyIx &prop) {
-    auto maybe_prop = record_accessor.GetProperty(view_, ctx_->properties[prop.ix]);
+    return GetProperty(record_accessor, ctx_->properties[prop.ix]);
+  }
+
+  template <class TRecordAccessor>
+  storage::PropertyValue GetProperty(const TRecordAccessor &record_accessor, storage::PropertyId property) {
+    auto maybe_prop = record_accessor.GetProperty(view_, property);
     if (maybe_prop.HasError() && maybe_prop.GetError() == storage::Error::NONEXISTENT_OBJECT) {
       // This is a very nasty and temporary hack in order to make MERGE work.
       // The old storage had the following logic when returning an `OLD` view:
@@ -887,7 +896,7 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
       // exist, it returned the NEW view. With this hack we simulate that
       // behavior.
       // TODO (mferencevic, teon.banek): Remove once MERGE is reimplemented.
-      maybe_prop = record_accessor.GetProperty(storage::View::NEW, ctx_->properties[prop.ix]);
+      maybe_prop = record_accessor.GetProperty(storage::View::NEW, property);
     }
     if (maybe_prop.HasError()) {
       switch (maybe_prop.GetError()) {
@@ -0,0 +1,103 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "query/interpret/frame.hpp"
+#include "utils/logging.hpp"
+#include "utils/memory.hpp"
+
+namespace memgraph::query {
+
+/// A fixed capacity batch of frames used by the batched pull protocol
+/// (`plan::Cursor::PullMultiple`).
+///
+/// The batch owns `capacity` frames which are allocated once and reused
+/// between pulls, so the `TypedValue` storage of each slot is recycled instead
+/// of reallocated. Only the first `size()` frames hold valid rows.
+class MultiFrame {
+ public:
+  MultiFrame(int64_t frame_size, size_t capacity, utils::MemoryResource *memory) : frame_size_(frame_size) {
+    MG_ASSERT(capacity > 0, "MultiFrame must be able to hold at least one frame");
+    frames_.reserve(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+      frames_.emplace_back(frame_size, memory);
+    }
+  }
+
+  MultiFrame(const MultiFrame &) = delete;
+  MultiFrame &operator=(const MultiFrame &) = delete;
+  MultiFrame(MultiFrame &&) = default;
+  MultiFrame &operator=(MultiFrame &&) = default;
+  ~MultiFrame() = default;
+
+  int64_t frame_size() const { return frame_size_; }
+  size_t capacity() const { return frames_.size(); }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == frames_.size(); }
+
+  utils::MemoryResource *GetMemoryResource() const { return frames_.front().GetMemoryResource(); }
+
+  Frame &operator[](size_t i) {
+    DMG_ASSERT(i < size_, "MultiFrame index out of range");
+    return frames_[i];
+  }
+  const Frame &operator[](size_t i) const {
+    DMG_ASSERT(i < size_, "MultiFrame index out of range");
+    return frames_[i];
+  }
+
+  /// Appends a copy of `frame` as a new row and returns the stored frame, so
+  /// the caller can overwrite the symbols it produces.
+  Frame &Emplace(const Frame &frame) {
+    DMG_ASSERT(!full(), "MultiFrame is full");
+    auto &slot = frames_[size_++];
+    slot = frame;
+    return slot;
+  }
+
+  /// Appends `frame` as a new row by swapping it with the next free slot.
+  /// `frame` is left holding the stale contents of that slot.
+  Frame &Emplace(Frame &&frame) {
+    DMG_ASSERT(!full(), "MultiFrame is full");
+    auto &slot = frames_[size_++];
+    std::swap(slot, frame);
+    return slot;
+  }
+
+  /// Invalidates all rows. The underlying frames are kept for reuse.
+  void Clear() { size_ = 0; }
+
+  /// Removes every row for which `pred` returns true, preserving the relative
+  /// order of the remaining rows.
+  template <typename TPredicate>
+  void EraseIf(TPredicate &&pred) {
+    size_t kept = 0;
+    for (size_t i = 0; i < size_; ++i) {
+      if (pred(frames_[i])) continue;
+      if (kept != i) std::swap(frames_[kept], frames_[i]);
+      ++kept;
+    }
+    size_ = kept;
+  }
+
+ private:
+  int64_t frame_size_;
+  std::vector<Frame> frames_;
+  size_t size_{0};
+};
+
+}  // namespace memgraph::query
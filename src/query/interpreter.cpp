@@ -24,6 +24,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <set>
 #include <stdexcept>
 #include <string_view>
 #include <thread>
@@ -44,6 +45,7 @@
 #include "dbms/global.hpp"
 #include "dbms/inmemory/storage_helper.hpp"
 #include "flags/experimental.hpp"
+#include "flags/query.hpp"
 #include "flags/replication.hpp"
 #include "flags/run_time_configurable.hpp"
 #include "glue/communication.hpp"
@@ -67,6 +69,7 @@
 #include "query/hops_limit.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/interpret/frame.hpp"
+#include "query/interpret/multi_frame.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/metadata.hpp"
 #include "query/parameters.hpp"
@@ -1984,16 +1987,30 @@ struct PullPlan {
                     std::optional<QueryLogger> &query_logger,
                     TriggerContextCollector *trigger_context_collector = nullptr,
                     std::optional<size_t> memory_limit = {}, FrameChangeCollector *frame_change_collector_ = nullptr,
-                    std::optional<int64_t> hops_limit = {});
+                    std::optional<int64_t> hops_limit = {}, std::optional<size_t> pull_batch_size = {});
 
   std::optional<plan::ProfilingStatsWithTotalTime> Pull(AnyStream *stream, std::optional<int> n,
                                                         const std::vector<Symbol> &output_symbols,
                                                         std::map<std::string, TypedValue> *summary);
 
  private:
+  // Moves to the next result of the batch, pulling a new batch from the cursor
+  // once the current one has been streamed. Returns false if there are no
+  // more results.
+  bool PullFromBatch();
+
+  // Frame holding the current result.
+  const Frame &ResultFrame() const { return multi_frame_ ? (*multi_frame_)[multi_frame_pos_ - 1] : frame_; }
+
   std::shared_ptr<PlanWrapper> plan_ = nullptr;
   plan::UniqueCursorPtr cursor_ = nullptr;
   Frame frame_;
+  // Results of the batched pull protocol, used instead of pulling the cursor
+  // row by row when the query can be executed in batches. Results before
+  // multi_frame_pos_ have already been streamed.
+  std::optional<MultiFrame> multi_frame_;
+  size_t multi_frame_pos_{0};
+  bool cursor_exhausted_{false};
   ExecutionContext ctx_;
   std::optional<size_t> memory_limit_;
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
@@ -2019,12 +2036,15 @@ PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &pa
                    std::shared_ptr<utils::AsyncTimer> tx_timer, DatabaseAccessProtector db_acc,
                    std::optional<QueryLogger> &query_logger, TriggerContextCollector *trigger_context_collector,
                    const std::optional<size_t> memory_limit, FrameChangeCollector *frame_change_collector,
-                   const std::optional<int64_t> hops_limit)
+                   const std::optional<int64_t> hops_limit, const std::optional<size_t> pull_batch_size)
     : plan_(plan),
       cursor_(plan->plan().MakeCursor(execution_memory)),
       frame_(plan->symbol_table().max_position(), execution_memory),
       memory_limit_(memory_limit),
       query_logger_(query_logger) {
+  if (pull_batch_size) {
+    multi_frame_.emplace(plan->symbol_table().max_position(), *pull_batch_size, execution_memory);
+  }
   ctx_.hops_limit = query::HopsLimit{hops_limit};
   ctx_.db_accessor = dba;
   ctx_.symbol_table = plan->symbol_table();
@@ -2078,12 +2098,16 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
       }};
 
   // Returns true if a result was pulled.
-  const auto pull_result = [&]() -> bool { return cursor_->Pull(frame_, ctx_); };
+  const auto pull_result = [&]() -> bool {
+    if (multi_frame_) return PullFromBatch();
+    return cursor_->Pull(frame_, ctx_);
+  };
 
   auto values = std::vector<TypedValue>(output_symbols.size());
   const auto stream_values = [&] {
+    const auto &result_frame = ResultFrame();
     for (auto const i : ranges::views::iota(0UL, output_symbols.size())) {
-      values[i] = frame_[output_symbols[i]];
+      values[i] = result_frame[output_symbols[i]];
     }
     stream->Result(values);
   };
@@ -2162,6 +2186,19 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   return stats_and_total_time;
 }
 
+bool PullPlan::PullFromBatch() {
+  if (multi_frame_pos_ == multi_frame_->size()) {
+    if (cursor_exhausted_) return false;
+    // A batch which isn't full means that the cursor is exhausted.
+    cursor_->PullMultiple(frame_, *multi_frame_, ctx_);
+    cursor_exhausted_ = !multi_frame_->full();
+    multi_frame_pos_ = 0;
+    if (multi_frame_->empty()) return false;
+  }
+  ++multi_frame_pos_;
+  return true;
+}
+
 using RWType = plan::ReadWriteTypeChecker::RWType;
 
 bool IsQueryWrite(const query::plan::ReadWriteTypeChecker::RWType query_type) {
@@ -2369,11 +2406,20 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   // TODO: pass current DB into plan, in future current can change during pull
   auto *trigger_context_collector =
       current_db.trigger_context_collector_ ? &*current_db.trigger_context_collector_ : nullptr;
+  // Batched execution runs each operator over the whole batch before the next
+  // one sees it. That is equivalent to row by row execution only if the query
+  // doesn't modify the graph and no cached values depend on the order of
+  // evaluation between operators.
+  std::optional<size_t> pull_batch_size;
+  if (FLAGS_query_pull_batch_size > 0 && !is_profile_query && !IsQueryWrite(rw_type_checker.type) &&
+      !frame_change_collector->IsTrackingValues()) {
+    pull_batch_size = FLAGS_query_pull_batch_size;
+  }
   auto pull_plan = std::make_shared<PullPlan>(
       plan, parsed_query.parameters, is_profile_query, dba, interpreter_context, execution_memory,
       std::move(user_or_role), transaction_status, std::move(tx_timer), current_db.db_acc_, interpreter.query_logger_,
       trigger_context_collector, memory_limit,
-      frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit);
+      frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit, pull_batch_size);
   return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
                        [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary](
                            AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
@@ -2834,15 +2880,24 @@ PreparedQuery PrepareAnalyzeGraphQuery(ParsedQuery parsed_query, bool in_explici
   }
   MG_ASSERT(current_db.db_acc_, "Analyze Graph query expects a current DB");
 
-  // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = current_db.db_acc_->get()->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
-  utils::OnScopeExit cache_invalidator(invalidate_plan_cache);
-
   auto *analyze_graph_query = utils::Downcast<AnalyzeGraphQuery>(parsed_query.query);
   MG_ASSERT(analyze_graph_query);
 
+  // Statistics influence computed plan costs, but only of the plans which use
+  // the analyzed labels.
+  auto invalidate_plan_cache = [plan_cache = current_db.db_acc_->get()->plan_cache(),
+                                storage = current_db.db_acc_->get()->storage(),
+                                labels = analyze_graph_query->labels_] {
+    if (labels.empty() || labels[0] == kAsterisk) {
+      InvalidatePlans(plan_cache);
+      return;
+    }
+    for (const auto &label : labels) {
+      InvalidatePlans(plan_cache, storage->NameToLabel(label));
+    }
+  };
+  utils::OnScopeExit cache_invalidator(invalidate_plan_cache);
+
   MG_ASSERT(current_db.execution_db_accessor_, "Analyze Graph query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
 
@@ -2879,14 +2934,13 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   MG_ASSERT(current_db.db_transactional_accessor_, "Index query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
 
-  // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
-
   auto *storage = db_acc->storage();
   auto label = storage->NameToLabel(index_query->label_.name);
 
+  // Creating an index influences computed plan costs of the plans using the
+  // label.
+  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache(), label] { InvalidatePlans(plan_cache, label); };
+
   std::vector<storage::PropertyId> properties;
   std::vector<std::string> properties_string;
   properties.reserve(index_query->properties_.size());
@@ -2896,8 +2950,8 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
     properties_string.push_back(prop.name);
   }
 
-  if (properties.size() > 1) {
-    throw utils::NotYetImplemented("index on multiple properties");
+  if (std::set(properties.begin(), properties.end()).size() != properties.size()) {
+    throw SemanticException("The same property can't be indexed more than once in an index.");
   }
 
   auto properties_stringified = utils::Join(properties_string, ", ");
@@ -2913,8 +2967,11 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       handler = [dba, label, properties_stringified = std::move(properties_stringified),
                  label_name = index_query->label_.name, properties = std::move(properties),
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? dba->CreateIndex(label) : dba->CreateIndex(label, properties[0]);
+        auto maybe_index_error = [&] {
+          if (properties.empty()) return dba->CreateIndex(label);
+          if (properties.size() == 1U) return dba->CreateIndex(label, properties[0]);
+          return dba->CreateIndex(label, properties);
+        }();
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -2934,8 +2991,11 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       handler = [dba, label, properties_stringified = std::move(properties_stringified),
                  label_name = index_query->label_.name, properties = std::move(properties),
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? dba->DropIndex(label) : dba->DropIndex(label, properties[0]);
+        auto maybe_index_error = [&] {
+          if (properties.empty()) return dba->DropIndex(label);
+          if (properties.size() == 1U) return dba->DropIndex(label, properties[0]);
+          return dba->DropIndex(label, properties);
+        }();
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -2979,13 +3039,13 @@ PreparedQuery PrepareEdgeIndexQuery(ParsedQuery parsed_query, bool in_explicit_t
   MG_ASSERT(current_db.db_transactional_accessor_, "Index query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
 
-  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
-
   auto *storage = db_acc->storage();
   auto edge_type = storage->NameToEdgeType(index_query->edge_type_.name);
 
+  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache(), edge_type] {
+    InvalidatePlans(plan_cache, edge_type);
+  };
+
   std::vector<storage::PropertyId> properties;
   std::vector<std::string> properties_string;
   properties.reserve(index_query->properties_.size());
@@ -3077,8 +3137,8 @@ PreparedQuery PreparePointIndexQuery(ParsedQuery parsed_query, bool in_explicit_
   MG_ASSERT(current_db.db_transactional_accessor_, "Index query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
 
-  auto const invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
+  auto const invalidate_plan_cache = [plan_cache = db_acc->plan_cache()](storage::LabelId label) {
+    InvalidatePlans(plan_cache, label);
   };
 
   auto label_name = index_query->label_.name;
@@ -3097,7 +3157,7 @@ PreparedQuery PreparePointIndexQuery(ParsedQuery parsed_query, bool in_explicit_
         auto prop_id = storage->NameToProperty(prop_name);
 
         auto maybe_index_error = dba->CreatePointIndex(label_id, prop_id);
-        utils::OnScopeExit const invalidator(invalidate_plan_cache);
+        utils::OnScopeExit const invalidator([&] { invalidate_plan_cache(label_id); });
 
         if (maybe_index_error.HasError()) {
           index_notification.code = NotificationCode::EXISTENT_INDEX;
@@ -3119,7 +3179,7 @@ PreparedQuery PreparePointIndexQuery(ParsedQuery parsed_query, bool in_explicit_
         auto prop_id = storage->NameToProperty(prop_name);
 
         auto maybe_index_error = dba->DropPointIndex(label_id, prop_id);
-        utils::OnScopeExit const invalidator(invalidate_plan_cache);
+        utils::OnScopeExit const invalidator([&] { invalidate_plan_cache(label_id); });
 
         if (maybe_index_error.HasError()) {
           index_notification.code = NotificationCode::NONEXISTENT_INDEX;
@@ -3158,13 +3218,12 @@ PreparedQuery PrepareTextIndexQuery(ParsedQuery parsed_query, bool in_explicit_t
   MG_ASSERT(current_db.db_transactional_accessor_, "Text index query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
 
-  // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
-
   auto *storage = db_acc->storage();
   auto label = storage->NameToLabel(text_index_query->label_.name);
+
+  // Creating an index influences computed plan costs of the plans using the
+  // label.
+  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache(), label] { InvalidatePlans(plan_cache, label); };
   auto &index_name = text_index_query->index_name_;
 
   Notification index_notification(SeverityLevel::INFO);
@@ -3236,9 +3295,7 @@ PreparedQuery PrepareTtlQuery(ParsedQuery parsed_query, bool in_explicit_transac
   auto label = storage->NameToLabel("TTL");
   auto prop = storage->NameToProperty("ttl");
 
-  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
+  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache(), label] { InvalidatePlans(plan_cache, label); };
 
   Notification notification(SeverityLevel::INFO);
   switch (ttl_query->type_) {
@@ -4217,6 +4274,16 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
                TypedValue(storage->PropertyToName(item.second)),
                TypedValue(static_cast<int>(storage_acc->ApproximateVertexCount(item.first, item.second)))});
         }
+        for (const auto &[label_id, properties] : info.label_property_composite) {
+          std::vector<TypedValue> property_names;
+          property_names.reserve(properties.size());
+          for (const auto &property : properties) {
+            property_names.emplace_back(storage->PropertyToName(property));
+          }
+          results.push_back({TypedValue(label_property_index_mark), TypedValue(storage->LabelToName(label_id)),
+                             TypedValue(std::move(property_names)),
+                             TypedValue(static_cast<int>(storage_acc->ApproximateVertexCount(label_id, properties)))});
+        }
         for (const auto &item : info.edge_type) {
           results.push_back({TypedValue(edge_type_index_mark), TypedValue(storage->EdgeTypeToName(item)), TypedValue(),
                              TypedValue(static_cast<int>(storage_acc->ApproximateEdgeCount(item)))});
@@ -4250,7 +4317,19 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
             return label_1 < label_2;
           }
 
-          return record_1[2].ValueString() < record_2[2].ValueString();
+          // Composite label+property indices list their properties, and sort after single property ones
+          const auto &property_1 = record_1[2];
+          const auto &property_2 = record_2[2];
+          if (property_1.IsList() != property_2.IsList()) {
+            return property_2.IsList();
+          }
+          if (property_1.IsList()) {
+            return std::lexicographical_compare(
+                property_1.ValueList().begin(), property_1.ValueList().end(), property_2.ValueList().begin(),
+                property_2.ValueList().end(),
+                [](const auto &lhs, const auto &rhs) { return lhs.ValueString() < rhs.ValueString(); });
+          }
+          return property_1.ValueString() < property_2.ValueString();
         });
 
         return std::pair{results, QueryHandlerResult::COMMIT};
@@ -5186,6 +5265,17 @@ PreparedQuery PrepareShowSchemaInfoQuery(const ParsedQuery &parsed_query, Curren
                                     {"properties", {storage->PropertyToName(property)}},
                                     {"count", storage_acc->ApproximateVertexCount(label_id, property)}}));
       }
+      // Vertex composite label property indices
+      for (const auto &[label_id, properties] : index_info.label_property_composite) {
+        auto property_names = nlohmann::json::array();
+        for (const auto &property : properties) {
+          property_names.push_back(storage->PropertyToName(property));
+        }
+        node_indexes.push_back(
+            nlohmann::json::object({{"labels", {storage->LabelToName(label_id)}},
+                                    {"properties", std::move(property_names)},
+                                    {"count", storage_acc->ApproximateVertexCount(label_id, properties)}}));
+      }
       // Vertex label text
       for (const auto &[str, label_id] : index_info.text_indices) {
         node_indexes.push_back(nlohmann::json::object({{"labels", {storage->LabelToName(label_id)}},
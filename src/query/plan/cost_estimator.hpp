@@ -150,6 +150,28 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   }
 
   bool PostVisit(ScanAllByLabelPropertyValue &logical_op) override {
+    if (!logical_op.composite_properties_.empty()) {
+      // Composite index scans have no statistics, so the cardinality is exact
+      // only when every property of the index is matched with a constant
+      std::vector<storage::PropertyValue> values;
+      for (auto *expression : logical_op.prefix_values_) {
+        auto value = ConstPropertyValue(expression);
+        if (!value) break;
+        values.emplace_back(std::move(*value));
+      }
+      auto value = ConstPropertyValue(logical_op.expression_);
+      if (value && values.size() == logical_op.prefix_values_.size() &&
+          values.size() + 1 == logical_op.composite_properties_.size()) {
+        values.emplace_back(std::move(*value));
+        cardinality_ *= db_accessor_->VerticesCount(logical_op.label_, logical_op.composite_properties_, values);
+      } else {
+        cardinality_ *=
+            db_accessor_->VerticesCount(logical_op.label_, logical_op.composite_properties_) * CardParam::kFilter;
+      }
+      IncrementCost(CostParam::MakeScanAllByLabelPropertyValue);
+      return true;
+    }
+
     // This cardinality estimation depends on the property value (expression).
     // If it's a constant, we can evaluate cardinality exactly, otherwise
     // we estimate
@@ -179,6 +201,13 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   }
 
   bool PostVisit(ScanAllByLabelPropertyRange &logical_op) override {
+    if (!logical_op.composite_properties_.empty()) {
+      cardinality_ *=
+          db_accessor_->VerticesCount(logical_op.label_, logical_op.composite_properties_) * CardParam::kFilter;
+      IncrementCost(CostParam::MakeScanAllByLabelPropertyRange);
+      return true;
+    }
+
     auto index_stats = db_accessor_->GetIndexStats(logical_op.label_, logical_op.property_);
     if (index_stats.has_value()) {
       SaveStatsFor(logical_op.output_symbol_, index_stats.value());
@@ -295,7 +324,9 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     auto card_param = CardParam::kExpand;
     auto stats = GetStatsFor(expand.input_symbol_);
 
-    if (stats.has_value()) {
+    if (auto edge_type_degree = EdgeTypeDegree(expand.common_)) {
+      card_param = *edge_type_degree;
+    } else if (stats.has_value()) {
       card_param = stats.value().degree;
     }
 
@@ -325,11 +356,16 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;                                      \
   }
 
-  POST_VISIT_COST_FIRST(Filter, kFilter)
   POST_VISIT_COST_FIRST(EdgeUniquenessFilter, kEdgeUniquenessFilter);
 
 #undef POST_VISIT_COST_FIRST
 
+  bool PostVisit(Filter &filter) override {
+    IncrementCost(CostParam::kFilter);
+    cardinality_ *= FilterSelectivity(filter.all_filters_);
+    return true;
+  }
+
   bool PostVisit(Unwind &unwind) override {
     // Unwind cost depends more on the number of lists that get unwound
     // much less on the number of outputs
@@ -519,6 +555,52 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return std::nullopt;
   }
 
+  // Average number of edges a vertex has of the expanded edge types, computed
+  // from the edge type indices. Returns nullopt if the expansion isn't limited
+  // to edge types which are all indexed.
+  std::optional<double> EdgeTypeDegree(const ExpandCommon &common) {
+    if (common.edge_types.empty()) return std::nullopt;
+    const auto vertices_count = db_accessor_->VerticesCount();
+    if (vertices_count <= 0) return std::nullopt;
+
+    double edges_count = 0;
+    for (const auto edge_type : common.edge_types) {
+      if (!db_accessor_->EdgeTypeIndexExists(edge_type)) return std::nullopt;
+      edges_count += static_cast<double>(db_accessor_->EdgesCount(edge_type));
+    }
+    // Every edge is counted once as outgoing and once as incoming
+    if (common.direction == EdgeAtom::Direction::BOTH) edges_count *= 2;
+    return edges_count / static_cast<double>(vertices_count);
+  }
+
+  // Fraction of rows which pass the filter. Label filters use the share of
+  // vertices with the label when the label is indexed, every other filter
+  // expression is estimated with CardParam::kFilter.
+  double FilterSelectivity(const Filters &filters) {
+    if (filters.empty()) return CardParam::kFilter;
+
+    double selectivity = 1.0;
+    bool has_unestimated_filter = false;
+    const auto vertices_count = db_accessor_->VerticesCount();
+    for (const auto &filter : filters) {
+      if (filter.type != FilterInfo::Type::Label || filter.labels.empty() || vertices_count <= 0) {
+        has_unestimated_filter = true;
+        continue;
+      }
+      for (const auto &label : filter.labels) {
+        const auto label_id = db_accessor_->NameToLabel(label.name);
+        if (!db_accessor_->LabelIndexExists(label_id)) {
+          has_unestimated_filter = true;
+          continue;
+        }
+        selectivity *=
+            static_cast<double>(db_accessor_->VerticesCount(label_id)) / static_cast<double>(vertices_count);
+      }
+    }
+    if (has_unestimated_filter) selectivity *= CardParam::kFilter;
+    return selectivity;
+  }
+
   bool HasStatsFor(const Symbol &symbol) const { return utils::Contains(scopes_.back().symbol_stats, symbol.name()); }
 
   std::optional<SymbolStatistics> GetStatsFor(const Symbol &symbol) {
@@ -12,8 +12,11 @@
 #include "query/plan/operator.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstdint>
+#include <exception>
+#include <latch>
 #include <limits>
 #include <optional>
 #include <queue>
@@ -34,6 +37,7 @@
 
 #include "csv/parsing.hpp"
 #include "flags/experimental.hpp"
+#include "flags/query.hpp"
 #include "license/license.hpp"
 #include "query/auth_checker.hpp"
 #include "query/context.hpp"
@@ -42,7 +46,9 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/graph.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/interpret/eval.hpp"
+#include "query/interpret/multi_frame.hpp"
 #include "query/path.hpp"
 #include "query/plan/scoped_profile.hpp"
 #include "query/procedure/cypher_types.hpp"
@@ -54,6 +60,7 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/algorithm.hpp"
+#include "utils/dense_hash_map.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/fnv.hpp"
@@ -71,8 +78,10 @@
 #include "utils/pmr/vector.hpp"
 #include "utils/readable_size.hpp"
 #include "utils/string.hpp"
+#include "utils/synchronized.hpp"
 #include "utils/tag.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/typeinfo.hpp"
 
 // macro for the default implementation of LogicalOperator::Accept
@@ -212,6 +221,14 @@ std::vector<storage::LabelId> EvaluateLabels(const std::vector<StorageLabelType>
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define SCOPED_PROFILE_OP_BY_REF(ref) ScopedProfile profile{ComputeProfilingKey(this), ref, &context};
 
+bool Cursor::PullMultiple(Frame &frame, MultiFrame &multi_frame, ExecutionContext &context) {
+  multi_frame.Clear();
+  while (!multi_frame.full() && Pull(frame, context)) {
+    multi_frame.Emplace(frame);
+  }
+  return !multi_frame.empty();
+}
+
 bool Once::OnceCursor::Pull(Frame &, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP("Once");
@@ -540,6 +557,34 @@ class ScanAllCursor : public Cursor {
     return true;
   }
 
+  bool PullMultiple(Frame &frame, MultiFrame &multi_frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    multi_frame.Clear();
+    while (!multi_frame.full()) {
+      AbortCheck(context);
+      while (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
+        if (!input_cursor_->Pull(frame, context)) return !multi_frame.empty();
+        auto next_vertices = get_vertices_(frame, context);
+        if (!next_vertices) continue;
+        vertices_.emplace(std::move(next_vertices.value()));
+        vertices_it_.emplace(vertices_.value().begin());
+        vertices_end_it_.emplace(vertices_.value().end());
+      }
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker && !FindNextVertex(context)) {
+        continue;
+      }
+#endif
+
+      auto &output = multi_frame.Emplace(frame);
+      output[output_symbol_] = *vertices_it_.value();
+      ++vertices_it_.value();
+    }
+    return true;
+  }
+
 #ifdef MG_ENTERPRISE
   bool FindNextVertex(const ExecutionContext &context) {
     while (vertices_it_.value() != vertices_end_it_.value()) {
@@ -873,6 +918,30 @@ std::optional<utils::Bound<storage::PropertyValue>> TryConvertToBound(std::optio
     throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
   }
 }
+
+// Evaluates the equality prefix of a composite index scan. Returns nullopt if
+// any of the values is null, since such a prefix can't match any vertex.
+std::optional<std::vector<storage::PropertyValue>> EvaluateCompositePrefix(const std::vector<Expression *> &values,
+                                                                           ExpressionEvaluator &evaluator) {
+  std::vector<storage::PropertyValue> prefix;
+  prefix.reserve(values.size() + 1);
+  for (auto *expression : values) {
+    auto value = expression->Accept(evaluator);
+    if (value.IsNull()) return std::nullopt;
+    if (!value.IsPropertyValue()) {
+      throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+    }
+    prefix.emplace_back(storage::PropertyValue(value));
+  }
+  return prefix;
+}
+
+std::string CompositePropertiesToString(const DbAccessor &dba, const std::vector<storage::PropertyId> &properties,
+                                        storage::PropertyId property) {
+  if (properties.empty()) return dba.PropertyToName(property);
+  return utils::IterableToString(properties, ", ",
+                                 [&dba](const auto &composite_property) { return dba.PropertyToName(composite_property); });
+}
 }  // namespace
 
 UniqueCursorPtr ScanAllByEdgeTypePropertyRange::MakeCursor(utils::MemoryResource *mem) const {
@@ -942,6 +1011,11 @@ UniqueCursorPtr ScanAllByLabelPropertyRange::MakeCursor(utils::MemoryResource *m
     if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
     if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
 
+    if (!composite_properties_.empty()) {
+      auto prefix = EvaluateCompositePrefix(prefix_values_, evaluator);
+      if (!prefix) return std::nullopt;
+      return std::make_optional(db->Vertices(view_, label_, composite_properties_, *prefix, maybe_lower, maybe_upper));
+    }
     return std::make_optional(db->Vertices(view_, label_, property_, maybe_lower, maybe_upper));
   };
   return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(
@@ -950,7 +1024,7 @@ UniqueCursorPtr ScanAllByLabelPropertyRange::MakeCursor(utils::MemoryResource *m
 
 std::string ScanAllByLabelPropertyRange::ToString() const {
   return fmt::format("ScanAllByLabelPropertyRange ({0} :{1} {{{2}}})", output_symbol_.name(), dba_->LabelToName(label_),
-                     dba_->PropertyToName(property_));
+                     CompositePropertiesToString(*dba_, composite_properties_, property_));
 }
 
 ScanAllByLabelPropertyValue::ScanAllByLabelPropertyValue(const std::shared_ptr<LogicalOperator> &input,
@@ -975,6 +1049,13 @@ UniqueCursorPtr ScanAllByLabelPropertyValue::MakeCursor(utils::MemoryResource *m
     if (!value.IsPropertyValue()) {
       throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
     }
+    if (!composite_properties_.empty()) {
+      auto prefix = EvaluateCompositePrefix(prefix_values_, evaluator);
+      if (!prefix) return std::nullopt;
+      prefix->emplace_back(storage::PropertyValue(value));
+      return std::make_optional(
+          db->Vertices(view_, label_, composite_properties_, *prefix, std::nullopt, std::nullopt));
+    }
     return std::make_optional(db->Vertices(view_, label_, property_, storage::PropertyValue(value)));
   };
   return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(
@@ -983,7 +1064,7 @@ UniqueCursorPtr ScanAllByLabelPropertyValue::MakeCursor(utils::MemoryResource *m
 
 std::string ScanAllByLabelPropertyValue::ToString() const {
   return fmt::format("ScanAllByLabelPropertyValue ({0} :{1} {{{2}}})", output_symbol_.name(), dba_->LabelToName(label_),
-                     dba_->PropertyToName(property_));
+                     CompositePropertiesToString(*dba_, composite_properties_, property_));
 }
 
 ScanAllByLabelProperty::ScanAllByLabelProperty(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
@@ -1200,6 +1281,55 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
   }
 }
 
+bool Expand::ExpandCursor::PullMultiple(Frame &frame, MultiFrame &multi_frame, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  // The input row stays in the scratch frame while its edges are expanded,
+  // every expansion is a copy of it with the edge and the node placed on it.
+  const auto emit = [this, &frame, &multi_frame](const EdgeAccessor &edge, const VertexAccessor &node) {
+    auto &output = multi_frame.Emplace(frame);
+    output[self_.common_.edge_symbol] = edge;
+    if (!self_.common_.existing_node) output[self_.common_.node_symbol] = node;
+  };
+
+  multi_frame.Clear();
+  while (!multi_frame.full()) {
+    AbortCheck(context);
+    if (in_edges_ && *in_edges_it_ != in_edges_->end()) {
+      auto edge = *(*in_edges_it_)++;
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(edge.From(), self_.view_,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        continue;
+      }
+#endif
+      emit(edge, edge.From());
+      continue;
+    }
+
+    if (out_edges_ && *out_edges_it_ != out_edges_->end()) {
+      auto edge = *(*out_edges_it_)++;
+      if (self_.common_.direction == EdgeAtom::Direction::BOTH && edge.IsCycle()) continue;
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(edge.To(), self_.view_,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        continue;
+      }
+#endif
+      emit(edge, edge.To());
+      continue;
+    }
+
+    if (!InitEdges(frame, context)) break;
+  }
+  return !multi_frame.empty();
+}
+
 void Expand::ExpandCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Expand::ExpandCursor::Reset() {
@@ -1715,6 +1845,9 @@ class STShortestPathCursor : public query::plan::Cursor {
   void Reset() override { input_cursor_->Reset(); }
 
  private:
+  /// Number of frontier vertices a worker reads the edges of at once.
+  static constexpr size_t kFrontierChunkSize = 64;
+
   const ExpandVariable &self_;
   UniqueCursorPtr input_cursor_;
 
@@ -1757,8 +1890,6 @@ class STShortestPathCursor : public query::plan::Cursor {
 
   bool FindPath(const VertexAccessor &source, const VertexAccessor &sink, int64_t lower_bound, int64_t upper_bound,
                 Frame *frame, ExpressionEvaluator *evaluator, ExecutionContext &context) {
-    using utils::Contains;
-
     if (source == sink) return false;
 
     // We expand from both directions, both from the source and the sink.
@@ -1791,141 +1922,200 @@ class STShortestPathCursor : public query::plan::Cursor {
 
     while (true) {
       AbortCheck(context);
-      // Top-down step (expansion from the source).
       ++current_length;
       if (current_length > upper_bound) return false;
 
-      for (const auto &vertex : source_frontier) {
-        if (context.hops_limit.IsLimitReached()) break;
-        if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto out_edges_result =
-              UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
-          context.number_of_hops += out_edges_result.expanded_count;
-          for (const auto &edge : out_edges_result.edges) {
+      // Every step expands a whole level of one of the sides, so the path
+      // found when the expansions meet is always `current_length` long. The
+      // side with the smaller frontier is expanded, because it reads fewer
+      // edges than the other one.
+      const bool from_source = source_frontier.size() <= sink_frontier.size();
+      auto &frontier = from_source ? source_frontier : sink_frontier;
+      auto &next = from_source ? source_next : sink_next;
+      auto &visited = from_source ? in_edge : out_edge;
+      const auto &other_visited = from_source ? out_edge : in_edge;
+
+      auto midpoint = ExpandFrontier(frontier, from_source, visited, other_visited, next, frame, evaluator, context);
+      if (midpoint) {
+        if (current_length < lower_bound) return false;
+        ReconstructPath(*midpoint, in_edge, out_edge, frame, pull_memory);
+        return true;
+      }
+
+      if (next.empty()) return false;
+      frontier.clear();
+      std::swap(frontier, next);
+    }
+  }
+
+  /// Expands the frontier by one level into `next` and records the edges used
+  /// in `visited`. Returns the vertex in which the expansion met the one from
+  /// the other side, if it did.
+  std::optional<VertexAccessor> ExpandFrontier(const utils::pmr::vector<VertexAccessor> &frontier, bool from_source,
+                                               VertexEdgeMapT &visited, const VertexEdgeMapT &other_visited,
+                                               utils::pmr::vector<VertexAccessor> &next, Frame *frame,
+                                               ExpressionEvaluator *evaluator, ExecutionContext &context) {
+    using utils::Contains;
+
+    // When expanding from the sink everything is reversed, the edges are
+    // followed against the direction of the pattern.
+    const auto direction = self_.common_.direction;
+    const bool read_out = from_source ? direction != EdgeAtom::Direction::IN : direction != EdgeAtom::Direction::OUT;
+    const bool read_in = from_source ? direction != EdgeAtom::Direction::OUT : direction != EdgeAtom::Direction::IN;
+
+    // Returns true if the expansions met in `neighbour`.
+    auto expand_edge = [&](const VertexAccessor &vertex, const EdgeAccessor &edge, const VertexAccessor &neighbour) {
 #ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(edge.To(), storage::View::OLD,
-                                            memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(neighbour, storage::View::OLD,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        return false;
+      }
 #endif
-            if (ShouldExpand(edge.To(), edge, frame, evaluator) && !Contains(in_edge, edge.To())) {
-              in_edge.emplace(edge.To(), edge);
-              if (Contains(out_edge, edge.To())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.To(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              source_next.push_back(edge.To());
-            }
-          }
+      // When expanding from the sink we have to be careful which edge
+      // endpoint we pass to `should_expand`, because everything is reversed.
+      if (!ShouldExpand(from_source ? neighbour : vertex, edge, frame, evaluator) || Contains(visited, neighbour)) {
+        return false;
+      }
+      visited.emplace(neighbour, edge);
+      if (Contains(other_visited, neighbour)) return true;
+      next.push_back(neighbour);
+      return false;
+    };
+
+    if (ShouldReadInParallel(frontier, context)) {
+      auto [out_edges, in_edges] = ReadFrontierEdges(frontier, read_out, read_in, context);
+      for (size_t i = 0; i < frontier.size(); ++i) {
+        for (const auto &edge : out_edges[i]) {
+          if (expand_edge(frontier[i], edge, edge.To())) return edge.To();
         }
-        if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto in_edges_result =
-              UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
-          context.number_of_hops += in_edges_result.expanded_count;
-          for (const auto &edge : in_edges_result.edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(edge.From(), storage::View::OLD,
-                                            memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-            if (ShouldExpand(edge.From(), edge, frame, evaluator) && !Contains(in_edge, edge.From())) {
-              in_edge.emplace(edge.From(), edge);
-              if (Contains(out_edge, edge.From())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.From(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              source_next.push_back(edge.From());
-            }
-          }
+        for (const auto &edge : in_edges[i]) {
+          if (expand_edge(frontier[i], edge, edge.From())) return edge.From();
         }
       }
+      return std::nullopt;
+    }
 
-      if (source_next.empty()) return false;
-      source_frontier.clear();
-      std::swap(source_frontier, source_next);
-
-      // Bottom-up step (expansion from the sink).
-      ++current_length;
-      if (current_length > upper_bound) return false;
+    for (const auto &vertex : frontier) {
+      if (context.hops_limit.IsLimitReached()) break;
+      if (read_out) {
+        auto out_edges_result =
+            UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+        context.number_of_hops += out_edges_result.expanded_count;
+        for (const auto &edge : out_edges_result.edges) {
+          if (expand_edge(vertex, edge, edge.To())) return edge.To();
+        }
+      }
+      if (read_in) {
+        auto in_edges_result =
+            UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
+        context.number_of_hops += in_edges_result.expanded_count;
+        for (const auto &edge : in_edges_result.edges) {
+          if (expand_edge(vertex, edge, edge.From())) return edge.From();
+        }
+      }
+    }
+    return std::nullopt;
+  }
 
-      // When expanding from the sink we have to be careful which edge
-      // endpoint we pass to `should_expand`, because everything is
-      // reversed.
-      for (const auto &vertex : sink_frontier) {
-        if (context.hops_limit.IsLimitReached()) break;
-        if (self_.common_.direction != EdgeAtom::Direction::OUT) {
-          auto out_edges_result =
-              UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
-          context.number_of_hops += out_edges_result.expanded_count;
-          for (const auto &edge : out_edges_result.edges) {
+  /**
+   * Checks whether the edges of the frontier should be read on multiple
+   * threads. The frontier must have at least `query_parallel_expand_threshold`
+   * vertices and the storage must be in memory. Expansions with a hops limit
+   * or fine grained access control are always done on a single thread.
+   */
+  static bool ShouldReadInParallel(const utils::pmr::vector<VertexAccessor> &frontier,
+                                   const ExecutionContext &context) {
+    if (FLAGS_query_parallel_workers < 2 || context.is_profile_query) return false;
+    if (frontier.size() < FLAGS_query_parallel_expand_threshold) return false;
+    if (context.hops_limit.IsUsed()) return false;
 #ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(edge.To(), storage::View::OLD,
-                                            memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
+    if (context.auth_checker) return false;
 #endif
-            if (ShouldExpand(vertex, edge, frame, evaluator) && !Contains(out_edge, edge.To())) {
-              out_edge.emplace(edge.To(), edge);
-              if (Contains(in_edge, edge.To())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.To(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              sink_next.push_back(edge.To());
-            }
-          }
+    const auto storage_mode = context.db_accessor->GetStorageMode();
+    return storage_mode == storage::StorageMode::IN_MEMORY_TRANSACTIONAL ||
+           storage_mode == storage::StorageMode::IN_MEMORY_ANALYTICAL;
+  }
+
+  /**
+   * Reads the outgoing and incoming edges of the frontier vertices on the
+   * workers of `ParallelExecutionPool`. The edges of `frontier[i]` are
+   * returned at index `i`, so they are expanded in the same order as when they
+   * are read on a single thread. Only the reading is done in parallel, the
+   * filter lambda and the visited maps are still evaluated on the calling
+   * thread.
+   */
+  std::pair<std::vector<std::vector<EdgeAccessor>>, std::vector<std::vector<EdgeAccessor>>> ReadFrontierEdges(
+      const utils::pmr::vector<VertexAccessor> &frontier, bool read_out, bool read_in, ExecutionContext &context) {
+    std::vector<std::vector<EdgeAccessor>> out_edges(frontier.size());
+    std::vector<std::vector<EdgeAccessor>> in_edges(frontier.size());
+
+    const auto num_chunks = (frontier.size() + kFrontierChunkSize - 1) / kFrontierChunkSize;
+    std::atomic<size_t> next_chunk{0};
+    std::atomic<int64_t> number_of_hops{0};
+    std::atomic<bool> stop{false};
+    utils::Synchronized<std::exception_ptr, utils::SpinLock> first_error;
+
+    auto run_worker = [&]() {
+      OOMExceptionEnabler oom_exception;
+      int64_t expanded = 0;
+      while (!stop.load(std::memory_order_acquire)) {
+        const auto chunk_index = next_chunk.fetch_add(1, std::memory_order_acq_rel);
+        if (chunk_index >= num_chunks) break;
+        if (MustAbort(context) != AbortReason::NO_ABORT) {
+          stop.store(true, std::memory_order_release);
+          break;
         }
-        if (self_.common_.direction != EdgeAtom::Direction::IN) {
-          auto in_edges_result =
-              UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
-          context.number_of_hops += in_edges_result.expanded_count;
-          for (const auto &edge : in_edges_result.edges) {
-#ifdef MG_ENTERPRISE
-            if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-                !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-                  context.auth_checker->Has(edge.From(), storage::View::OLD,
-                                            memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-              continue;
-            }
-#endif
-            if (ShouldExpand(vertex, edge, frame, evaluator) && !Contains(out_edge, edge.From())) {
-              out_edge.emplace(edge.From(), edge);
-              if (Contains(in_edge, edge.From())) {
-                if (current_length >= lower_bound) {
-                  ReconstructPath(edge.From(), in_edge, out_edge, frame, pull_memory);
-                  return true;
-                } else {
-                  return false;
-                }
-              }
-              sink_next.push_back(edge.From());
-            }
+        const auto end = std::min(frontier.size(), (chunk_index + 1) * kFrontierChunkSize);
+        for (auto i = chunk_index * kFrontierChunkSize; i < end; ++i) {
+          if (read_out) {
+            auto result = UnwrapEdgesResult(frontier[i].OutEdges(storage::View::OLD, self_.common_.edge_types));
+            expanded += result.expanded_count;
+            out_edges[i] = std::move(result.edges);
+          }
+          if (read_in) {
+            auto result = UnwrapEdgesResult(frontier[i].InEdges(storage::View::OLD, self_.common_.edge_types));
+            expanded += result.expanded_count;
+            in_edges[i] = std::move(result.edges);
           }
         }
       }
+      number_of_hops.fetch_add(expanded, std::memory_order_relaxed);
+    };
+    auto run_worker_safely = [&]() {
+      try {
+        run_worker();
+      } catch (...) {
+        stop.store(true, std::memory_order_release);
+        auto locked_error = first_error.Lock();
+        if (!*locked_error) *locked_error = std::current_exception();
+      }
+    };
+
+    {
+      auto *dba = context.db_accessor;
+      dba->SetConcurrentReaders(true);
+      utils::OnScopeExit reset_concurrent_readers{[dba] { dba->SetConcurrentReaders(false); }};
 
-      if (sink_next.empty()) return false;
-      sink_frontier.clear();
-      std::swap(sink_frontier, sink_next);
+      const auto num_helpers = std::min<size_t>(FLAGS_query_parallel_workers - 1, num_chunks - 1);
+      std::latch helpers_done{static_cast<std::ptrdiff_t>(num_helpers)};
+      for (size_t i = 0; i < num_helpers; ++i) {
+        ParallelExecutionPool().AddTask([&, dba] {
+          dba->TrackCurrentThreadAllocations();
+          run_worker_safely();
+          dba->UntrackCurrentThreadAllocations();
+          helpers_done.count_down();
+        });
+      }
+      run_worker_safely();
+      helpers_done.wait();
     }
+
+    if (auto error = *first_error.Lock()) std::rethrow_exception(error);
+    AbortCheck(context);
+    context.number_of_hops += number_of_hops.load();
+    return {std::move(out_edges), std::move(in_edges)};
   }
 };
 
@@ -3007,18 +3197,58 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   // nodes and edges.
   ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                 storage::View::OLD, context.frame_change_collector);
+  if (!expression_) expression_ = std::make_unique<CompiledExpression>(self_.expression_, evaluator);
   while (input_cursor_->Pull(frame, context)) {
     for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
       pattern_filter_cursor->Pull(frame, context);
     }
-    if (EvaluateFilter(evaluator, self_.expression_)) return true;
+    if (expression_->EvaluateFilter(evaluator)) return true;
   }
   return false;
 }
 
+bool Filter::FilterCursor::PullMultiple(Frame &frame, MultiFrame &multi_frame, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  if (!input_batch_) {
+    input_batch_ = std::make_unique<MultiFrame>(multi_frame.frame_size(), multi_frame.capacity(),
+                                                multi_frame.GetMemoryResource());
+  }
+
+  multi_frame.Clear();
+  while (!multi_frame.full()) {
+    AbortCheck(context);
+    if (input_batch_pos_ == input_batch_->size()) {
+      if (input_exhausted_) break;
+      input_cursor_->PullMultiple(frame, *input_batch_, context);
+      input_exhausted_ = !input_batch_->full();
+      input_batch_pos_ = 0;
+      continue;
+    }
+
+    auto &input_frame = (*input_batch_)[input_batch_pos_++];
+    // Like all filters, newly set values should not affect filtering of old
+    // nodes and edges.
+    ExpressionEvaluator evaluator(&input_frame, context.symbol_table, context.evaluation_context,
+                                  context.db_accessor, storage::View::OLD, context.frame_change_collector);
+    if (!expression_) expression_ = std::make_unique<CompiledExpression>(self_.expression_, evaluator);
+    for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
+      pattern_filter_cursor->Pull(input_frame, context);
+    }
+    if (expression_->EvaluateFilter(evaluator)) multi_frame.Emplace(std::move(input_frame));
+  }
+  return !multi_frame.empty();
+}
+
 void Filter::FilterCursor::Shutdown() { input_cursor_->Shutdown(); }
 
-void Filter::FilterCursor::Reset() { input_cursor_->Reset(); }
+void Filter::FilterCursor::Reset() {
+  input_cursor_->Reset();
+  if (input_batch_) input_batch_->Clear();
+  input_batch_pos_ = 0;
+  input_exhausted_ = false;
+}
 
 EvaluatePatternFilter::EvaluatePatternFilter(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol)
     : input_(input), output_symbol_(std::move(output_symbol)) {}
@@ -3086,20 +3316,45 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP_BY_REF(self_);
 
   if (input_cursor_->Pull(frame, context)) {
-    // Produce should always yield the latest results.
-    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
-                                  storage::View::NEW, context.frame_change_collector);
-    for (auto *named_expr : self_.named_expressions_) {
-      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
-        context.frame_change_collector->ResetTrackingValue(named_expr->name_);
-      }
-      named_expr->Accept(evaluator);
-    }
+    ProduceRow(frame, context);
     return true;
   }
   return false;
 }
 
+bool Produce::ProduceCursor::PullMultiple(Frame &frame, MultiFrame &multi_frame, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  if (!input_cursor_->PullMultiple(frame, multi_frame, context)) return false;
+
+  for (size_t i = 0; i < multi_frame.size(); ++i) {
+    ProduceRow(multi_frame[i], context);
+  }
+  return true;
+}
+
+void Produce::ProduceCursor::ProduceRow(Frame &frame, ExecutionContext &context) {
+  // Produce should always yield the latest results.
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::NEW, context.frame_change_collector);
+  if (expressions_.empty()) {
+    symbols_.reserve(self_.named_expressions_.size());
+    expressions_.reserve(self_.named_expressions_.size());
+    for (auto *named_expr : self_.named_expressions_) {
+      symbols_.push_back(context.symbol_table.at(*named_expr));
+      expressions_.emplace_back(named_expr->expression_, evaluator);
+    }
+  }
+  for (size_t i = 0; i < expressions_.size(); ++i) {
+    const auto *named_expr = self_.named_expressions_[i];
+    if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
+      context.frame_change_collector->ResetTrackingValue(named_expr->name_);
+    }
+    frame[symbols_[i]] = expressions_[i].Evaluate(evaluator);
+  }
+}
+
 void Produce::ProduceCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Produce::ProduceCursor::Reset() { input_cursor_->Reset(); }
@@ -4028,13 +4283,20 @@ TypedValue DefaultAggregationOpValue(const Aggregate::Element &element, utils::M
 }
 }  // namespace
 
+utils::ThreadPool &ParallelExecutionPool() {
+  static utils::ThreadPool pool{std::max<uint64_t>(FLAGS_query_parallel_workers, 2) - 1};
+  return pool;
+}
+
 class AggregateCursor : public Cursor {
  public:
   AggregateCursor(const Aggregate &self, utils::MemoryResource *mem)
       : self_(self),
         input_cursor_(self_.input_->MakeCursor(mem)),
         aggregation_(mem),
-        reused_group_by_(self.group_by_.size(), mem) {}
+        reused_group_by_(self.group_by_.size(), mem),
+        batch_group_by_(mem),
+        batch_hashes_(mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -4046,46 +4308,54 @@ class AggregateCursor : public Cursor {
       aggregation_it_ = aggregation_.begin();
 
       if (aggregation_.empty()) {
-        auto *pull_memory = context.evaluation_context.memory;
-        // place default aggregation values on the frame
-        for (const auto &elem : self_.aggregations_) {
-          frame[elem.output_sym] = DefaultAggregationOpValue(elem, pull_memory);
-          if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(elem.output_sym.name())) {
-            context.frame_change_collector->ResetTrackingValue(elem.output_sym.name());
-          }
-        }
-
-        // place null as remember values on the frame
-        for (const Symbol &remember_sym : self_.remember_) {
-          frame[remember_sym] = TypedValue(pull_memory);
-          if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(remember_sym.name())) {
-            context.frame_change_collector->ResetTrackingValue(remember_sym.name());
-          }
-        }
+        PlaceDefaultValues(frame, context);
         return true;
       }
     }
     if (aggregation_it_ == aggregation_.end()) return false;
 
-    // place aggregation values on the frame
-    auto aggregation_values_it = aggregation_it_->second.values_.begin();
-    for (const auto &aggregation_elem : self_.aggregations_)
-      frame[aggregation_elem.output_sym] = *aggregation_values_it++;
-
-    // place remember values on the frame
-    auto remember_values_it = aggregation_it_->second.remember_.begin();
-    for (const Symbol &remember_sym : self_.remember_) frame[remember_sym] = *remember_values_it++;
-
+    PlaceAggregationValues(frame);
     aggregation_it_++;
     return true;
   }
 
+  bool PullMultiple(Frame &frame, MultiFrame &multi_frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    if (!pulled_all_input_) {
+      // The output batch is free until the input is exhausted, so it's reused
+      // for pulling the input.
+      if (!ProcessAllMultiple(frame, multi_frame, context) && !self_.group_by_.empty()) {
+        multi_frame.Clear();
+        return false;
+      }
+      pulled_all_input_ = true;
+      aggregation_it_ = aggregation_.begin();
+
+      if (aggregation_.empty()) {
+        multi_frame.Clear();
+        PlaceDefaultValues(multi_frame.Emplace(frame), context);
+        return true;
+      }
+    }
+
+    multi_frame.Clear();
+    while (!multi_frame.full() && aggregation_it_ != aggregation_.end()) {
+      PlaceAggregationValues(multi_frame.Emplace(frame));
+      aggregation_it_++;
+    }
+    return !multi_frame.empty();
+  }
+
   void Shutdown() override { input_cursor_->Shutdown(); }
 
   void Reset() override {
     input_cursor_->Reset();
     aggregation_.clear();
     aggregation_it_ = aggregation_.begin();
+    batch_group_by_.clear();
+    batch_hashes_.clear();
     pulled_all_input_ = false;
   }
 
@@ -4115,20 +4385,39 @@ class AggregateCursor : public Cursor {
     utils::pmr::vector<TSet> unique_values_;
   };
 
+  // map key is the vector of group-by values
+  // map value is an AggregationValue struct
+  using AggregationMap =
+      utils::DenseHashMap<utils::pmr::vector<TypedValue>, AggregationValue,
+                          // use FNV collection hashing specialized for a
+                          // vector of TypedValues
+                          utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
+                          // custom equality
+                          TypedValueVectorEqual>;
+
+  // The part of the input which is executed in parallel: a scan over all
+  // vertices (or all vertices with a label) followed by filters.
+  struct ParallelScanInput {
+    const ScanAll *scan{nullptr};
+    std::optional<storage::LabelId> label;
+    // Filter expressions, ordered from the scan outwards.
+    std::vector<Expression *> filters;
+  };
+
+  // Each worker gets a few chunks so the load stays balanced when the chunks
+  // aren't equally expensive.
+  static constexpr uint64_t kParallelChunksPerWorker = 4;
+  static constexpr uint64_t kParallelAbortCheckFrequency = 1024;
+
   const Aggregate &self_;
   const UniqueCursorPtr input_cursor_;
   // storage for aggregated data
-  // map key is the vector of group-by values
-  // map value is an AggregationValue struct
-  utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
-                            // use FNV collection hashing specialized for a
-                            // vector of TypedValues
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
-                            // custom equality
-                            TypedValueVectorEqual>
-      aggregation_;
+  AggregationMap aggregation_;
   // this is a for object reuse, to avoid re-allocating this buffer
   utils::pmr::vector<TypedValue> reused_group_by_;
+  // group-by values and their hashes for each frame of a pulled batch
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> batch_group_by_;
+  utils::pmr::vector<size_t> batch_hashes_;
   // iterator over the accumulated cache
   decltype(aggregation_.begin()) aggregation_it_ = aggregation_.begin();
   // this LogicalOp pulls all from the input on it's first pull
@@ -4145,6 +4434,10 @@ class AggregateCursor : public Cursor {
    * aggregation results, and not on the number of inputs.
    */
   bool ProcessAll(Frame *frame, ExecutionContext *context) {
+    if (auto parallel_input = GetParallelScanInput(*context)) {
+      return ProcessAllParallel(frame, context, *parallel_input);
+    }
+
     ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
                                   storage::View::NEW);
 
@@ -4155,7 +4448,245 @@ class AggregateCursor : public Cursor {
     }
     if (!pulled) return false;
 
-    // post processing
+    PostProcess(context);
+    return true;
+  }
+
+  /**
+   * Same as ProcessAll, but pulls the input in batches using the given
+   * MultiFrame as the buffer.
+   */
+  bool ProcessAllMultiple(Frame &frame, MultiFrame &multi_frame, ExecutionContext &context) {
+    if (auto parallel_input = GetParallelScanInput(context)) {
+      return ProcessAllParallel(&frame, &context, *parallel_input);
+    }
+
+    bool pulled = false;
+    while (input_cursor_->PullMultiple(frame, multi_frame, context)) {
+      ProcessBatch(multi_frame, context);
+      pulled = true;
+      if (!multi_frame.full()) break;
+    }
+    if (!pulled) return false;
+
+    PostProcess(&context);
+    return true;
+  }
+
+  /**
+   * Checks whether the input can be aggregated in parallel and returns the
+   * scan and filters to execute if so. The input must be a scan over all
+   * vertices (or all vertices with a label) with optional filters on top,
+   * the storage must be in memory and the estimated number of scanned
+   * vertices must be at least `query_parallel_scan_threshold`.
+   */
+  std::optional<ParallelScanInput> GetParallelScanInput(const ExecutionContext &context) const {
+    if (FLAGS_query_parallel_workers < 2 || context.is_profile_query) return std::nullopt;
+#ifdef MG_ENTERPRISE
+    if (context.auth_checker) return std::nullopt;
+#endif
+    auto *dba = context.db_accessor;
+    const auto storage_mode = dba->GetStorageMode();
+    if (storage_mode != storage::StorageMode::IN_MEMORY_TRANSACTIONAL &&
+        storage_mode != storage::StorageMode::IN_MEMORY_ANALYTICAL) {
+      return std::nullopt;
+    }
+    // DISTINCT and PROJECT aggregations can't be merged from partial results.
+    for (const auto &aggregation : self_.aggregations_) {
+      if (aggregation.distinct || aggregation.op == Aggregation::Op::PROJECT) return std::nullopt;
+    }
+
+    ParallelScanInput input;
+    const LogicalOperator *op = self_.input_.get();
+    while (op->GetTypeInfo() == Filter::kType) {
+      const auto *filter = static_cast<const Filter *>(op);
+      if (!filter->pattern_filters_.empty()) return std::nullopt;
+      input.filters.push_back(filter->expression_);
+      op = filter->input_.get();
+    }
+    std::reverse(input.filters.begin(), input.filters.end());
+
+    if (op->GetTypeInfo() == ScanAllByLabel::kType) {
+      input.label = static_cast<const ScanAllByLabel *>(op)->label_;
+    } else if (op->GetTypeInfo() != ScanAll::kType) {
+      return std::nullopt;
+    }
+    input.scan = static_cast<const ScanAll *>(op);
+    if (!input.scan->input_ || input.scan->input_->GetTypeInfo() != Once::kType) return std::nullopt;
+
+    const auto estimate = input.label ? dba->VerticesCount(*input.label) : dba->VerticesCount();
+    if (estimate < 0 || static_cast<uint64_t>(estimate) < FLAGS_query_parallel_scan_threshold) return std::nullopt;
+    return input;
+  }
+
+  /**
+   * Same as ProcessAll, but scans the input vertices in chunks on multiple
+   * threads. Every chunk is aggregated into its own table and the tables are
+   * merged in chunk order, so the result is the same as when the input is
+   * processed on a single thread.
+   */
+  bool ProcessAllParallel(Frame *frame, ExecutionContext *context, const ParallelScanInput &input) {
+    auto *dba = context->db_accessor;
+    const auto num_chunks = FLAGS_query_parallel_workers * kParallelChunksPerWorker;
+    auto chunks = input.label ? dba->ChunkedVertices(input.scan->view_, *input.label, num_chunks)
+                              : dba->ChunkedVertices(input.scan->view_, num_chunks);
+
+    // The query execution memory isn't thread-safe, so the workers allocate
+    // their partial results from the global allocator.
+    auto *worker_memory = utils::NewDeleteResource();
+    std::vector<AggregationMap> partials;
+    partials.reserve(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) partials.emplace_back(worker_memory);
+
+    std::atomic<size_t> next_chunk{0};
+    std::atomic<bool> stop{false};
+    utils::Synchronized<std::exception_ptr, utils::SpinLock> first_error;
+
+    auto run_worker = [&]() {
+      OOMExceptionEnabler oom_exception;
+      Frame worker_frame(static_cast<int64_t>(frame->elems().size()), worker_memory);
+      for (size_t i = 0; i < frame->elems().size(); ++i) worker_frame.elems()[i] = frame->elems()[i];
+      auto evaluation_context = context->evaluation_context;
+      evaluation_context.memory = worker_memory;
+      // Like all filters, newly set values should not affect filtering of old
+      // nodes and edges.
+      ExpressionEvaluator filter_evaluator(&worker_frame, context->symbol_table, evaluation_context, dba,
+                                           storage::View::OLD);
+      ExpressionEvaluator evaluator(&worker_frame, context->symbol_table, evaluation_context, dba, storage::View::NEW);
+      utils::pmr::vector<TypedValue> group_by(worker_memory);
+
+      uint64_t processed = 0;
+      while (!stop.load(std::memory_order_acquire)) {
+        const auto chunk_index = next_chunk.fetch_add(1, std::memory_order_acq_rel);
+        if (chunk_index >= chunks.size()) return;
+        for (auto vertex : chunks[chunk_index]) {
+          if (++processed % kParallelAbortCheckFrequency == 0 &&
+              (stop.load(std::memory_order_acquire) || MustAbort(*context) != AbortReason::NO_ABORT)) {
+            stop.store(true, std::memory_order_release);
+            return;
+          }
+          worker_frame[input.scan->output_symbol_] = vertex;
+          filter_evaluator.ResetPropertyLookupCache();
+          const auto passes = std::all_of(input.filters.begin(), input.filters.end(), [&](Expression *filter) {
+            return EvaluateFilter(filter_evaluator, filter);
+          });
+          if (passes) ProcessOne(worker_frame, &evaluator, &partials[chunk_index], &group_by);
+        }
+      }
+    };
+    auto run_worker_safely = [&]() {
+      try {
+        run_worker();
+      } catch (...) {
+        stop.store(true, std::memory_order_release);
+        auto locked_error = first_error.Lock();
+        if (!*locked_error) *locked_error = std::current_exception();
+      }
+    };
+
+    {
+      dba->SetConcurrentReaders(true);
+      utils::OnScopeExit reset_concurrent_readers{[dba] { dba->SetConcurrentReaders(false); }};
+
+      const auto num_helpers = std::min<size_t>(FLAGS_query_parallel_workers - 1, chunks.size() - 1);
+      std::latch helpers_done{static_cast<std::ptrdiff_t>(num_helpers)};
+      for (size_t i = 0; i < num_helpers; ++i) {
+        ParallelExecutionPool().AddTask([&, dba] {
+          dba->TrackCurrentThreadAllocations();
+          run_worker_safely();
+          dba->UntrackCurrentThreadAllocations();
+          helpers_done.count_down();
+        });
+      }
+      run_worker_safely();
+      helpers_done.wait();
+    }
+
+    if (auto error = *first_error.Lock()) std::rethrow_exception(error);
+    AbortCheck(*context);
+
+    bool pulled = false;
+    for (const auto &partial : partials) {
+      pulled |= !partial.empty();
+      MergePartial(partial);
+    }
+    if (!pulled) return false;
+
+    PostProcess(context);
+    return true;
+  }
+
+  /**
+   * Merges a partial aggregation table into `aggregation_`. Partial tables
+   * have to be merged in input order so that the remembered values, collected
+   * lists and ties in MIN/MAX match the single threaded execution.
+   */
+  void MergePartial(const AggregationMap &partial) {
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    for (const auto &[group_by, partial_value] : partial) {
+      auto res = aggregation_.try_emplace(group_by, mem);
+      auto &agg_value = res.first->second;
+      if (res.second /*was newly inserted*/) {
+        agg_value.counts_.assign(partial_value.counts_.begin(), partial_value.counts_.end());
+        agg_value.values_.assign(partial_value.values_.begin(), partial_value.values_.end());
+        agg_value.remember_.assign(partial_value.remember_.begin(), partial_value.remember_.end());
+        agg_value.unique_values_.reserve(self_.aggregations_.size());
+        for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+          agg_value.unique_values_.emplace_back(AggregationValue::TSet(mem));
+        }
+        continue;
+      }
+
+      for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+        const auto partial_count = partial_value.counts_[pos];
+        if (partial_count == 0) continue;
+        auto &count = agg_value.counts_[pos];
+        auto &value = agg_value.values_[pos];
+        const auto &partial_agg = partial_value.values_[pos];
+        switch (self_.aggregations_[pos].op) {
+          case Aggregation::Op::COUNT:
+            // value is deferred to post-processing
+            break;
+          case Aggregation::Op::MIN:
+            try {
+              if (count == 0 || (partial_agg < value).ValueBool()) value = partial_agg;
+            } catch (const TypedValueException &) {
+              throw QueryRuntimeException("Unable to get MIN of '{}' and '{}'.", partial_agg.type(), value.type());
+            }
+            break;
+          case Aggregation::Op::MAX:
+            try {
+              if (count == 0 || (partial_agg > value).ValueBool()) value = partial_agg;
+            } catch (const TypedValueException &) {
+              throw QueryRuntimeException("Unable to get MAX of '{}' and '{}'.", partial_agg.type(), value.type());
+            }
+            break;
+          case Aggregation::Op::AVG:
+          case Aggregation::Op::SUM:
+            value = count == 0 ? partial_agg : value + partial_agg;
+            break;
+          case Aggregation::Op::COLLECT_LIST: {
+            auto &list = value.ValueList();
+            for (const auto &elem : partial_agg.ValueList()) list.push_back(elem);
+            break;
+          }
+          case Aggregation::Op::COLLECT_MAP: {
+            auto &map = value.ValueMap();
+            for (const auto &[key, elem] : partial_agg.ValueMap()) map.emplace(key, elem);
+            break;
+          }
+          case Aggregation::Op::PROJECT:
+            LOG_FATAL("PROJECT aggregation can't be merged from partial results");
+        }
+        count += partial_count;
+      }
+    }
+  }
+
+  /**
+   * Finalizes the aggregated values once all of the input has been processed.
+   */
+  void PostProcess(ExecutionContext *context) {
     for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
       switch (self_.aggregations_[pos].op) {
         case Aggregation::Op::AVG: {
@@ -4187,22 +4718,99 @@ class AggregateCursor : public Cursor {
           break;
       }
     }
-    return true;
+  }
+
+  /**
+   * Places the default aggregation values and null remember values on the
+   * frame, used when there was no input to aggregate.
+   */
+  void PlaceDefaultValues(Frame &frame, ExecutionContext &context) {
+    auto *pull_memory = context.evaluation_context.memory;
+    // place default aggregation values on the frame
+    for (const auto &elem : self_.aggregations_) {
+      frame[elem.output_sym] = DefaultAggregationOpValue(elem, pull_memory);
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(elem.output_sym.name())) {
+        context.frame_change_collector->ResetTrackingValue(elem.output_sym.name());
+      }
+    }
+
+    // place null as remember values on the frame
+    for (const Symbol &remember_sym : self_.remember_) {
+      frame[remember_sym] = TypedValue(pull_memory);
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(remember_sym.name())) {
+        context.frame_change_collector->ResetTrackingValue(remember_sym.name());
+      }
+    }
+  }
+
+  /**
+   * Places the aggregation and remember values of the current group on the
+   * frame.
+   */
+  void PlaceAggregationValues(Frame &frame) {
+    // place aggregation values on the frame
+    auto aggregation_values_it = aggregation_it_->second.values_.begin();
+    for (const auto &aggregation_elem : self_.aggregations_)
+      frame[aggregation_elem.output_sym] = *aggregation_values_it++;
+
+    // place remember values on the frame
+    auto remember_values_it = aggregation_it_->second.remember_.begin();
+    for (const Symbol &remember_sym : self_.remember_) frame[remember_sym] = *remember_values_it++;
   }
 
   /**
    * Performs a single accumulation.
    */
   void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator) {
+    ProcessOne(frame, evaluator, &aggregation_, &reused_group_by_);
+  }
+
+  /**
+   * Performs the accumulations of a pulled batch. The group-by values of the
+   * whole batch are evaluated and hashed first, so the slots of the
+   * aggregation table can be prefetched before they are probed.
+   */
+  void ProcessBatch(MultiFrame &multi_frame, ExecutionContext &context) {
+    batch_group_by_.resize(multi_frame.size());
+    batch_hashes_.resize(multi_frame.size());
+    for (size_t i = 0; i < multi_frame.size(); ++i) {
+      ExpressionEvaluator evaluator(&multi_frame[i], context.symbol_table, context.evaluation_context,
+                                    context.db_accessor, storage::View::NEW);
+      auto &group_by = batch_group_by_[i];
+      group_by.clear();
+      for (Expression *expression : self_.group_by_) {
+        group_by.emplace_back(expression->Accept(evaluator));
+      }
+      batch_hashes_[i] = aggregation_.Hash(group_by);
+      aggregation_.Prefetch(batch_hashes_[i]);
+    }
+
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    for (size_t i = 0; i < multi_frame.size(); ++i) {
+      ExpressionEvaluator evaluator(&multi_frame[i], context.symbol_table, context.evaluation_context,
+                                    context.db_accessor, storage::View::NEW);
+      auto res = aggregation_.try_emplace_hashed(batch_hashes_[i], batch_group_by_[i], mem);
+      auto &agg_value = res.first->second;
+      if (res.second /*was newly inserted*/) EnsureInitialized(multi_frame[i], &agg_value);
+      Update(&evaluator, &agg_value);
+    }
+  }
+
+  /**
+   * Performs a single accumulation into the given aggregation table, using
+   * `group_by` as the buffer for the group-by values.
+   */
+  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator, AggregationMap *aggregation,
+                  utils::pmr::vector<TypedValue> *group_by) {
     // Preallocated group_by, since most of the time the aggregation key won't be unique
-    reused_group_by_.clear();
+    group_by->clear();
     evaluator->ResetPropertyLookupCache();
 
     for (Expression *expression : self_.group_by_) {
-      reused_group_by_.emplace_back(expression->Accept(*evaluator));
+      group_by->emplace_back(expression->Accept(*evaluator));
     }
-    auto *mem = aggregation_.get_allocator().GetMemoryResource();
-    auto res = aggregation_.try_emplace(reused_group_by_, mem);
+    auto *mem = aggregation->get_allocator().GetMemoryResource();
+    auto res = aggregation->try_emplace(*group_by, mem);
     auto &agg_value = res.first->second;
     if (res.second /*was newly inserted*/) EnsureInitialized(frame, &agg_value);
     Update(evaluator, &agg_value);
@@ -6024,12 +6632,13 @@ class HashJoinCursor : public Cursor {
         ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                       storage::View::OLD);
         auto right_value = self_.hash_join_condition_->expression2_->Accept(evaluator);
-        if (hashtable_.contains(right_value)) {
+        auto left_frames_it = hashtable_.find(right_value);
+        if (left_frames_it != hashtable_.end()) {
           // If so, finish pulling for now and proceed to joining the pulled frame
           right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
           common_value_found_ = true;
-          common_value = right_value;
-          left_op_frame_it_ = hashtable_[common_value].begin();
+          left_op_frames_ = &left_frames_it->second;
+          left_op_frame_it_ = left_op_frames_->begin();
           break;
         }
       }
@@ -6043,7 +6652,7 @@ class HashJoinCursor : public Cursor {
     left_op_frame_it_++;
     // When all left frames with the common value have been joined, move on to pulling and joining the next right
     // frame
-    if (common_value_found_ && left_op_frame_it_ == hashtable_[common_value].end()) {
+    if (common_value_found_ && left_op_frame_it_ == left_op_frames_->end()) {
       common_value_found_ = false;
     }
 
@@ -6060,6 +6669,7 @@ class HashJoinCursor : public Cursor {
     right_op_cursor_->Reset();
     hashtable_.clear();
     right_op_frame_.clear();
+    left_op_frames_ = nullptr;
     left_op_frame_it_ = {};
     hash_join_initialized_ = false;
     common_value_found_ = false;
@@ -6081,14 +6691,17 @@ class HashJoinCursor : public Cursor {
   const HashJoin &self_;
   const UniqueCursorPtr left_op_cursor_;
   const UniqueCursorPtr right_op_cursor_;
-  utils::pmr::unordered_map<TypedValue, utils::pmr::vector<utils::pmr::vector<TypedValue>>, TypedValue::Hash,
-                            TypedValue::BoolEqual>
+  // The table isn't modified once it's built, so the entries don't move while
+  // they are joined.
+  utils::DenseHashMap<TypedValue, utils::pmr::vector<utils::pmr::vector<TypedValue>>, TypedValue::Hash,
+                      TypedValue::BoolEqual>
       hashtable_;
   utils::pmr::vector<TypedValue> right_op_frame_;
-  utils::pmr::vector<utils::pmr::vector<TypedValue>>::iterator left_op_frame_it_;
+  // Left frames with the join value of the right frame which is being joined.
+  const utils::pmr::vector<utils::pmr::vector<TypedValue>> *left_op_frames_{nullptr};
+  utils::pmr::vector<utils::pmr::vector<TypedValue>>::const_iterator left_op_frame_it_;
   bool hash_join_initialized_{false};
   bool common_value_found_{false};
-  TypedValue common_value;
 };
 }  // namespace
 
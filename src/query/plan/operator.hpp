@@ -30,13 +30,16 @@
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/visitor.hpp"
 
 namespace memgraph::query {
 
 struct ExecutionContext;
+class CompiledExpression;
 class ExpressionEvaluator;
 class Frame;
+class MultiFrame;
 class SymbolTable;
 
 namespace plan {
@@ -60,6 +63,28 @@ class Cursor {
   /// @throws QueryRuntimeException if something went wrong with execution
   virtual bool Pull(Frame &, ExecutionContext &) = 0;
 
+  /// Run a batched iteration of a @c LogicalOperator.
+  ///
+  /// Fills the @c MultiFrame with up to its capacity of results. Cursors
+  /// implementing this natively pay the virtual dispatch, profiling and abort
+  /// checks once per batch instead of once per row. The default
+  /// implementation adapts @c Pull by pulling into the given @c Frame and
+  /// copying each result into the batch, so operators which stay row based
+  /// (and their inputs) keep working unchanged.
+  ///
+  /// A batch which isn't full means that the cursor is exhausted and it must
+  /// not be pulled again (until it is @c Reset).
+  ///
+  /// @param Frame Scratch frame used by row based cursors. It must be the same
+  ///     frame on every call.
+  /// @param MultiFrame Batch to be filled. It is cleared by the call.
+  /// @param ExecutionContext Used to get the position of symbols in frame and
+  ///     other information.
+  ///
+  /// @return false if no results were pulled.
+  /// @throws QueryRuntimeException if something went wrong with execution
+  virtual bool PullMultiple(Frame &, MultiFrame &, ExecutionContext &);
+
   /// Resets the Cursor to its initial state.
   virtual void Reset() = 0;
 
@@ -808,6 +833,11 @@ class ScanAllByLabelPropertyRange : public memgraph::query::plan::ScanAll {
   storage::PropertyId property_;
   std::optional<Bound> lower_bound_;
   std::optional<Bound> upper_bound_;
+  /// Properties of the composite index used for the scan, empty when the scan
+  /// uses the label+property index of `property_`. The leading properties must
+  /// equal `prefix_values_` and the next one is `property_`.
+  std::vector<storage::PropertyId> composite_properties_;
+  std::vector<Expression *> prefix_values_;
 
   std::string ToString() const override;
 
@@ -826,6 +856,11 @@ class ScanAllByLabelPropertyRange : public memgraph::query::plan::ScanAll {
       object->upper_bound_.emplace(
           utils::Bound<Expression *>(upper_bound_->value()->Clone(storage), upper_bound_->type()));
     }
+    object->composite_properties_ = composite_properties_;
+    object->prefix_values_.reserve(prefix_values_.size());
+    for (auto *value : prefix_values_) {
+      object->prefix_values_.push_back(value->Clone(storage));
+    }
     return object;
   }
 };
@@ -862,6 +897,11 @@ class ScanAllByLabelPropertyValue : public memgraph::query::plan::ScanAll {
   storage::LabelId label_;
   storage::PropertyId property_;
   Expression *expression_;
+  /// Properties of the composite index used for the scan, empty when the scan
+  /// uses the label+property index of `property_`. The leading properties must
+  /// equal `prefix_values_` and the next one is `property_`.
+  std::vector<storage::PropertyId> composite_properties_;
+  std::vector<Expression *> prefix_values_;
 
   std::string ToString() const override;
 
@@ -873,6 +913,11 @@ class ScanAllByLabelPropertyValue : public memgraph::query::plan::ScanAll {
     object->label_ = label_;
     object->property_ = property_;
     object->expression_ = expression_ ? expression_->Clone(storage) : nullptr;
+    object->composite_properties_ = composite_properties_;
+    object->prefix_values_.reserve(prefix_values_.size());
+    for (auto *value : prefix_values_) {
+      object->prefix_values_.push_back(value->Clone(storage));
+    }
     return object;
   }
 };
@@ -1041,6 +1086,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     ExpandCursor(const Expand &, utils::MemoryResource *);
     ExpandCursor(const Expand &, int64_t input_degree, int64_t existing_node_degree, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullMultiple(Frame &, MultiFrame &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
     ExpansionInfo GetExpansionInfo(Frame &);
@@ -1366,6 +1412,7 @@ class Filter : public memgraph::query::plan::LogicalOperator {
    public:
     FilterCursor(const Filter &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullMultiple(Frame &, MultiFrame &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
@@ -1373,6 +1420,14 @@ class Filter : public memgraph::query::plan::LogicalOperator {
     const Filter &self_;
     const UniqueCursorPtr input_cursor_;
     const std::vector<UniqueCursorPtr> pattern_filter_cursors_;
+    // Filter expression compiled on the first pull, when the parameters of
+    // the query are known.
+    std::unique_ptr<CompiledExpression> expression_;
+    // Input batch of PullMultiple, created on the first batched pull. Rows
+    // from input_batch_pos_ onwards haven't been filtered yet.
+    std::unique_ptr<MultiFrame> input_batch_;
+    size_t input_batch_pos_{0};
+    bool input_exhausted_{false};
   };
 };
 
@@ -1425,12 +1480,19 @@ class Produce : public memgraph::query::plan::LogicalOperator {
    public:
     ProduceCursor(const Produce &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullMultiple(Frame &, MultiFrame &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
+    void ProduceRow(Frame &frame, ExecutionContext &context);
+
     const Produce &self_;
     const UniqueCursorPtr input_cursor_;
+    // Named expressions compiled on the first pull, when the parameters of
+    // the query are known.
+    std::vector<Symbol> symbols_;
+    std::vector<CompiledExpression> expressions_;
   };
 };
 
@@ -2904,5 +2966,10 @@ class PeriodicSubquery : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Threads shared by all queries which execute a part of their work in
+/// parallel. The thread executing the query also takes part in the work, so
+/// the pool holds one thread less than `query_parallel_workers`.
+utils::ThreadPool &ParallelExecutionPool();
+
 }  // namespace plan
 }  // namespace memgraph::query
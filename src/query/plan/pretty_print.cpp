@@ -481,6 +481,10 @@ bool PlanToJsonVisitor::PreVisit(ScanAllByLabelPropertyRange &op) {
   self["property"] = ToJson(op.property_, *dba_);
   self["lower_bound"] = op.lower_bound_ ? ToJson(*op.lower_bound_, *dba_) : json();
   self["upper_bound"] = op.upper_bound_ ? ToJson(*op.upper_bound_, *dba_) : json();
+  if (!op.composite_properties_.empty()) {
+    self["composite_properties"] = ToJson(op.composite_properties_, *dba_);
+    self["prefix_values"] = ToJson(op.prefix_values_, *dba_);
+  }
   self["output_symbol"] = ToJson(op.output_symbol_);
 
   op.input_->Accept(*this);
@@ -496,6 +500,10 @@ bool PlanToJsonVisitor::PreVisit(ScanAllByLabelPropertyValue &op) {
   self["label"] = ToJson(op.label_, *dba_);
   self["property"] = ToJson(op.property_, *dba_);
   self["expression"] = ToJson(op.expression_, *dba_);
+  if (!op.composite_properties_.empty()) {
+    self["composite_properties"] = ToJson(op.composite_properties_, *dba_);
+    self["prefix_values"] = ToJson(op.prefix_values_, *dba_);
+  }
   self["output_symbol"] = ToJson(op.output_symbol_);
 
   op.input_->Accept(*this);
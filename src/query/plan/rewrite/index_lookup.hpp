@@ -726,6 +726,16 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     std::optional<storage::LabelPropertyIndexStats> index_stats;
   };
 
+  struct CompositeIndex {
+    LabelIx label;
+    std::vector<storage::PropertyId> properties;
+    // Equality filters on the leading properties of the index, in index order.
+    std::vector<FilterInfo> prefix_filters;
+    // Range filter on the property following the prefix.
+    std::optional<FilterInfo> range_filter;
+    int64_t vertex_count;
+  };
+
   bool DefaultPreVisit() override { throw utils::NotYetImplemented("optimizing index lookup"); }
 
   void SetOnParent(const std::shared_ptr<LogicalOperator> &input) {
@@ -917,6 +927,70 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return found;
   }
 
+  // Finds the composite index which matches the most properties of the node
+  // with equality filters on its leading properties and an optional range
+  // filter on the next one. Only indices matching at least two properties are
+  // considered, otherwise a label+property index is as good. Ties are broken
+  // by the number of indexed vertices. If no such index exists, nullopt is
+  // returned.
+  std::optional<CompositeIndex> FindBestCompositeIndex(const Symbol &symbol,
+                                                       const std::unordered_set<Symbol> &bound_symbols) {
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    auto composite_indices = db_->ListCompositeIndices();
+    if (composite_indices.empty()) return std::nullopt;
+
+    std::unordered_map<storage::PropertyId, FilterInfo> equal_filters;
+    std::unordered_map<storage::PropertyId, FilterInfo> range_filters;
+    for (const auto &filter : filters_.PropertyFilters(symbol)) {
+      if (filter.property_filter->is_symbol_in_value_ || !are_bound(filter.used_symbols)) continue;
+      const auto property = GetProperty(filter.property_filter->property_);
+      if (filter.property_filter->type_ == PropertyFilter::Type::EQUAL) {
+        equal_filters.emplace(property, filter);
+      } else if (filter.property_filter->type_ == PropertyFilter::Type::RANGE) {
+        range_filters.emplace(property, filter);
+      }
+    }
+    if (equal_filters.empty()) return std::nullopt;
+
+    std::optional<CompositeIndex> found;
+    for (const auto &label : filters_.FilteredLabels(symbol)) {
+      const auto label_id = GetLabel(label);
+      for (const auto &[index_label, properties] : composite_indices) {
+        if (index_label != label_id) continue;
+        CompositeIndex candidate{.label = label, .properties = properties};
+        for (const auto &property : properties) {
+          auto it = equal_filters.find(property);
+          if (it == equal_filters.end()) break;
+          candidate.prefix_filters.push_back(it->second);
+        }
+        if (candidate.prefix_filters.empty()) continue;
+        if (candidate.prefix_filters.size() < properties.size()) {
+          auto it = range_filters.find(properties[candidate.prefix_filters.size()]);
+          if (it != range_filters.end()) candidate.range_filter = it->second;
+        }
+        const auto matched = candidate.prefix_filters.size() + (candidate.range_filter ? 1 : 0);
+        if (matched < 2) continue;
+        candidate.vertex_count = db_->VerticesCount(label_id, properties);
+        if (found) {
+          const auto found_matched = found->prefix_filters.size() + (found->range_filter ? 1 : 0);
+          if (matched < found_matched || (matched == found_matched && candidate.vertex_count >= found->vertex_count)) {
+            continue;
+          }
+        }
+        found = std::move(candidate);
+      }
+    }
+    return found;
+  }
+
   // Creates a ScanAll by the best possible index for the `node_symbol`. If the node
   // does not have at least a label, no indexed lookup can be created and
   // `nullptr` is returned. The operator is chained after `input`. Optional
@@ -959,6 +1033,13 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       // Without labels, we cannot generate any indexed ScanAll.
       return nullptr;
     }
+    // Prefer a composite index matching several properties at once. Index
+    // hints name label+property indices, so they take precedence.
+    if (!max_vertex_count && index_hints_.label_property_index_hints_.empty()) {
+      if (auto composite = FindBestCompositeIndex(node_symbol, bound_symbols)) {
+        return GenScanByCompositeIndex(input, node_symbol, view, *composite);
+      }
+    }
     auto found_index = FindBestLabelPropertyIndex(node_symbol, bound_symbols);
     if (found_index &&
         // Use label+property index if we satisfy max_vertex_count.
@@ -1021,6 +1102,42 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
     return std::make_unique<ScanAllByLabel>(input, node_symbol, GetLabel(label), view);
   }
+
+  std::unique_ptr<ScanAll> GenScanByCompositeIndex(const std::shared_ptr<LogicalOperator> &input,
+                                                   const Symbol &node_symbol, storage::View view,
+                                                   const CompositeIndex &index) {
+    std::vector<Expression *> prefix_values;
+    prefix_values.reserve(index.prefix_filters.size());
+    for (const auto &filter : index.prefix_filters) {
+      prefix_values.push_back(filter.property_filter->value_);
+      filter_exprs_for_removal_.insert(filter.expression);
+      filters_.EraseFilter(filter);
+    }
+    std::vector<Expression *> removed_expressions;
+    filters_.EraseLabelFilter(node_symbol, index.label, &removed_expressions);
+    filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
+
+    const auto label = GetLabel(index.label);
+    if (index.range_filter) {
+      const auto range_filter = *index.range_filter->property_filter;
+      filter_exprs_for_removal_.insert(index.range_filter->expression);
+      filters_.EraseFilter(*index.range_filter);
+      auto scan = std::make_unique<ScanAllByLabelPropertyRange>(input, node_symbol, label,
+                                                                GetProperty(range_filter.property_),
+                                                                range_filter.lower_bound_, range_filter.upper_bound_,
+                                                                view);
+      scan->composite_properties_ = index.properties;
+      scan->prefix_values_ = std::move(prefix_values);
+      return scan;
+    }
+    auto *last_value = prefix_values.back();
+    prefix_values.pop_back();
+    auto scan = std::make_unique<ScanAllByLabelPropertyValue>(
+        input, node_symbol, label, index.properties[prefix_values.size()], last_value, view);
+    scan->composite_properties_ = index.properties;
+    scan->prefix_values_ = std::move(prefix_values);
+    return scan;
+  }
 };
 
 }  // namespace impl
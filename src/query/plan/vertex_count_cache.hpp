@@ -77,6 +77,15 @@ class VertexCountCache {
     return bounds_vertex_count.at(bounds);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    return db_->VerticesCount(label, properties);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &values) {
+    return db_->VerticesCount(label, properties, values);
+  }
+
   int64_t EdgesCount(storage::EdgeTypeId edge_type) {
     if (edge_type_edge_count_.find(edge_type) == edge_type_edge_count_.end())
       edge_type_edge_count_[edge_type] = db_->EdgesCount(edge_type);
@@ -117,6 +126,10 @@ class VertexCountCache {
     return db_->LabelPropertyIndexExists(label, property);
   }
 
+  std::vector<std::pair<storage::LabelId, std::vector<storage::PropertyId>>> ListCompositeIndices() {
+    return db_->ListCompositeIndices();
+  }
+
   bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) { return db_->EdgeTypeIndexExists(edge_type); }
 
   bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) {
@@ -0,0 +1,192 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/procedure/graph_projection.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <latch>
+
+#include "flags/query.hpp"
+#include "query/db_accessor.hpp"
+#include "query/plan/operator.hpp"
+#include "utils/on_scope_exit.hpp"
+
+namespace memgraph::query::procedure {
+
+namespace {
+
+/// Number of vertex ranges per worker when reading the edges, so workers which
+/// get ranges of low degree vertices can help with the rest.
+constexpr size_t kRangesPerWorker = 4;
+
+size_t NumWorkers() { return std::max<uint64_t>(FLAGS_query_parallel_workers, 1); }
+
+/// Calls `func(i)` for every `i` in [0, num_tasks) from the calling thread and
+/// the workers of `plan::ParallelExecutionPool`.
+template <typename TFunc>
+void RunInParallel(DbAccessor *dba, size_t num_tasks, const TFunc &func) {
+  if (num_tasks == 0) return;
+  std::atomic<size_t> next_task{0};
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> first_error;
+  auto run_worker = [&]() {
+    try {
+      for (auto task = next_task.fetch_add(1); task < num_tasks; task = next_task.fetch_add(1)) {
+        func(task);
+      }
+    } catch (...) {
+      next_task.store(num_tasks);
+      auto locked_error = first_error.Lock();
+      if (!*locked_error) *locked_error = std::current_exception();
+    }
+  };
+
+  {
+    dba->SetConcurrentReaders(true);
+    utils::OnScopeExit reset_concurrent_readers{[dba] { dba->SetConcurrentReaders(false); }};
+
+    const auto num_helpers = std::min(NumWorkers(), num_tasks) - 1;
+    std::latch helpers_done{static_cast<std::ptrdiff_t>(num_helpers)};
+    for (size_t i = 0; i < num_helpers; ++i) {
+      plan::ParallelExecutionPool().AddTask([&, dba] {
+        dba->TrackCurrentThreadAllocations();
+        run_worker();
+        dba->UntrackCurrentThreadAllocations();
+        helpers_done.count_down();
+      });
+    }
+    run_worker();
+    helpers_done.wait();
+  }
+
+  if (auto error = *first_error.Lock()) std::rethrow_exception(error);
+}
+
+}  // namespace
+
+std::optional<uint64_t> GraphProjection::IndexOf(storage::Gid gid) const {
+  auto it = std::lower_bound(vertex_ids.begin(), vertex_ids.end(), gid);
+  if (it == vertex_ids.end() || *it != gid) return std::nullopt;
+  return it - vertex_ids.begin();
+}
+
+std::shared_ptr<const GraphProjection> BuildGraphProjection(DbAccessor *dba, storage::View view,
+                                                            const GraphProjectionFilter &filter) {
+  auto projection = std::make_shared<GraphProjection>();
+  projection->weighted = filter.weight_property.has_value();
+
+  // Collect the vertices. Without a label index all vertices are scanned and
+  // filtered by the label.
+  const bool use_label_index = filter.label && dba->LabelIndexExists(*filter.label);
+  auto chunks = use_label_index ? dba->ChunkedVertices(view, *filter.label, NumWorkers())
+                                : dba->ChunkedVertices(view, NumWorkers());
+  std::vector<std::vector<VertexAccessor>> chunk_vertices(chunks.size());
+  RunInParallel(dba, chunks.size(), [&](size_t chunk) {
+    for (auto vertex : chunks[chunk]) {
+      if (filter.label && !use_label_index) {
+        auto has_label = vertex.HasLabel(view, *filter.label);
+        if (has_label.HasError() || !*has_label) continue;
+      }
+      chunk_vertices[chunk].push_back(vertex);
+    }
+  });
+
+  std::vector<VertexAccessor> vertices;
+  for (auto &chunk : chunk_vertices) {
+    vertices.insert(vertices.end(), chunk.begin(), chunk.end());
+    chunk = {};
+  }
+  std::sort(vertices.begin(), vertices.end(), [](const auto &lhs, const auto &rhs) { return lhs.Gid() < rhs.Gid(); });
+  projection->vertex_ids.reserve(vertices.size());
+  std::transform(vertices.begin(), vertices.end(), std::back_inserter(projection->vertex_ids),
+                 [](const auto &vertex) { return vertex.Gid(); });
+
+  // Collect the outgoing edges of contiguous ranges of vertices, so the
+  // ranges can be concatenated into the CSR arrays.
+  struct Range {
+    std::vector<uint64_t> degrees;
+    std::vector<uint64_t> targets;
+    std::vector<double> weights;
+  };
+  const auto num_ranges = std::min(vertices.size(), NumWorkers() * kRangesPerWorker);
+  std::vector<Range> ranges(num_ranges);
+  std::vector<storage::EdgeTypeId> edge_types;
+  if (filter.edge_type) edge_types.push_back(*filter.edge_type);
+  RunInParallel(dba, num_ranges, [&](size_t range_index) {
+    auto &range = ranges[range_index];
+    const auto begin = vertices.size() * range_index / num_ranges;
+    const auto end = vertices.size() * (range_index + 1) / num_ranges;
+    range.degrees.reserve(end - begin);
+    for (auto i = begin; i < end; ++i) {
+      uint64_t degree = 0;
+      auto out_edges = vertices[i].OutEdges(view, edge_types);
+      if (out_edges.HasValue()) {
+        for (const auto &edge : out_edges->edges) {
+          auto target = projection->IndexOf(edge.To().Gid());
+          if (!target) continue;
+          range.targets.push_back(*target);
+          if (filter.weight_property) {
+            double weight = 1.0;
+            auto value = edge.GetProperty(view, *filter.weight_property);
+            if (value.HasValue() && value->IsInt()) weight = static_cast<double>(value->ValueInt());
+            if (value.HasValue() && value->IsDouble()) weight = value->ValueDouble();
+            range.weights.push_back(weight);
+          }
+          ++degree;
+        }
+      }
+      range.degrees.push_back(degree);
+    }
+  });
+
+  projection->offsets.reserve(vertices.size() + 1);
+  projection->offsets.push_back(0);
+  for (auto &range : ranges) {
+    for (auto degree : range.degrees) {
+      projection->offsets.push_back(projection->offsets.back() + degree);
+    }
+    projection->targets.insert(projection->targets.end(), range.targets.begin(), range.targets.end());
+    projection->weights.insert(projection->weights.end(), range.weights.begin(), range.weights.end());
+    range = {};
+  }
+  return projection;
+}
+
+std::shared_ptr<const GraphProjection> GraphProjectionCache::Get(DbAccessor *dba, storage::View view,
+                                                                 const GraphProjectionFilter &filter) {
+  const auto transaction_id = dba->GetTransactionId().value_or(0);
+  const auto command_id = dba->GetStorageAccessor()->GetTransaction()->command_id;
+  auto matches = [&](const Entry &entry) {
+    return entry.transaction_id == transaction_id && entry.command_id == command_id && entry.view == view &&
+           entry.filter == filter;
+  };
+
+  {
+    auto entries = entries_.Lock();
+    // Projections of older snapshots can't be used anymore.
+    std::erase_if(*entries, [&](const Entry &entry) {
+      return entry.transaction_id != transaction_id || entry.command_id != command_id;
+    });
+    auto it = std::find_if(entries->begin(), entries->end(), matches);
+    if (it != entries->end()) return it->projection;
+  }
+
+  auto projection = BuildGraphProjection(dba, view, filter);
+  auto entries = entries_.Lock();
+  auto it = std::find_if(entries->begin(), entries->end(), matches);
+  if (it != entries->end()) return it->projection;
+  entries->push_back({transaction_id, command_id, view, filter, projection});
+  return projection;
+}
+
+}  // namespace memgraph::query::procedure
@@ -0,0 +1,85 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::query {
+class DbAccessor;
+}  // namespace memgraph::query
+
+namespace memgraph::query::procedure {
+
+/// Read-only projection of the graph in the compressed sparse row (CSR)
+/// format, used by query modules which run whole-graph algorithms.
+///
+/// Vertices are numbered from 0 in the order of their gids. The outgoing
+/// edges of the vertex `i` are stored in `targets[offsets[i]]` up to
+/// `targets[offsets[i + 1]]`, each as the number of the target vertex. Edges
+/// to vertices which aren't part of the projection are left out.
+struct GraphProjection {
+  std::vector<storage::Gid> vertex_ids;
+  std::vector<uint64_t> offsets;
+  std::vector<uint64_t> targets;
+  /// Weight of each edge, empty if the projection has no weight property.
+  /// Edges without a numeric weight have the weight 1.
+  std::vector<double> weights;
+  bool weighted{false};
+
+  /// Returns the number of the vertex with the given gid, if it is part of
+  /// the projection.
+  std::optional<uint64_t> IndexOf(storage::Gid gid) const;
+};
+
+/// Parameters of a projection. Unset filters include everything.
+struct GraphProjectionFilter {
+  std::optional<storage::LabelId> label;
+  std::optional<storage::EdgeTypeId> edge_type;
+  std::optional<storage::PropertyId> weight_property;
+
+  friend bool operator==(const GraphProjectionFilter &, const GraphProjectionFilter &) = default;
+};
+
+/// Builds the projection of the graph seen by the current command of the
+/// transaction. The vertices and edges are read in parallel by the workers of
+/// `plan::ParallelExecutionPool`.
+std::shared_ptr<const GraphProjection> BuildGraphProjection(DbAccessor *dba, storage::View view,
+                                                            const GraphProjectionFilter &filter);
+
+/// Projections built during the execution of a query, so procedures called
+/// for every row of the query don't rebuild them. A projection is reused only
+/// while the transaction snapshot (transaction and command id) is the same.
+class GraphProjectionCache {
+ public:
+  std::shared_ptr<const GraphProjection> Get(DbAccessor *dba, storage::View view, const GraphProjectionFilter &filter);
+
+ private:
+  struct Entry {
+    uint64_t transaction_id;
+    uint64_t command_id;
+    storage::View view;
+    GraphProjectionFilter filter;
+    std::shared_ptr<const GraphProjection> projection;
+  };
+
+  utils::Synchronized<std::vector<Entry>, utils::SpinLock> entries_;
+};
+
+}  // namespace memgraph::query::procedure
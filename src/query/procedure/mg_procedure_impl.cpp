@@ -3572,6 +3572,81 @@ mgp_error mgp_graph_iter_vertices(mgp_graph *graph, mgp_memory *memory, mgp_vert
   return WrapExceptions([graph, memory] { return NewRawMgpObject<mgp_vertices_iterator>(memory, graph); }, result);
 }
 
+mgp_error mgp_graph_projection_create(mgp_graph *graph, const char *label, const char *edge_type,
+                                      const char *weight_property, mgp_memory *memory, mgp_graph_projection **result) {
+  return WrapExceptions(
+      [=] {
+        if (std::holds_alternative<memgraph::query::SubgraphDbAccessor *>(graph->impl)) {
+          throw std::invalid_argument("Graph projections of subgraphs are not supported");
+        }
+        auto *dba = graph->getImpl();
+        memgraph::query::procedure::GraphProjectionFilter filter;
+        if (label) filter.label = dba->NameToLabel(label);
+        if (edge_type) filter.edge_type = dba->NameToEdgeType(edge_type);
+        if (weight_property) filter.weight_property = dba->NameToProperty(weight_property);
+
+        std::shared_ptr<const memgraph::query::procedure::GraphProjection> projection;
+        if (graph->ctx) {
+          if (!graph->ctx->graph_projection_cache) {
+            graph->ctx->graph_projection_cache = std::make_shared<memgraph::query::procedure::GraphProjectionCache>();
+          }
+          projection = graph->ctx->graph_projection_cache->Get(dba, graph->view, filter);
+        } else {
+          projection = memgraph::query::procedure::BuildGraphProjection(dba, graph->view, filter);
+        }
+        return NewRawMgpObject<mgp_graph_projection>(memory, std::move(projection));
+      },
+      result);
+}
+
+void mgp_graph_projection_destroy(mgp_graph_projection *projection) { DeleteRawMgpObject(projection); }
+
+mgp_error mgp_graph_projection_vertices_count(mgp_graph_projection *projection, size_t *result) {
+  return WrapExceptions([projection] { return projection->impl->vertex_ids.size(); }, result);
+}
+
+mgp_error mgp_graph_projection_edges_count(mgp_graph_projection *projection, size_t *result) {
+  return WrapExceptions([projection] { return projection->impl->targets.size(); }, result);
+}
+
+mgp_error mgp_graph_projection_offsets(mgp_graph_projection *projection, const uint64_t **result) {
+  return WrapExceptions([projection] { return projection->impl->offsets.data(); }, result);
+}
+
+mgp_error mgp_graph_projection_targets(mgp_graph_projection *projection, const uint64_t **result) {
+  return WrapExceptions([projection] { return projection->impl->targets.data(); }, result);
+}
+
+mgp_error mgp_graph_projection_weights(mgp_graph_projection *projection, const double **result) {
+  return WrapExceptions(
+      [projection]() -> const double * {
+        if (!projection->impl->weighted) return nullptr;
+        return projection->impl->weights.data();
+      },
+      result);
+}
+
+mgp_error mgp_graph_projection_vertex_id(mgp_graph_projection *projection, size_t index, mgp_vertex_id *result) {
+  return WrapExceptions(
+      [projection, index] {
+        if (index >= projection->impl->vertex_ids.size()) {
+          throw std::out_of_range("Vertex index exceeds the number of vertices in the projection!");
+        }
+        return mgp_vertex_id{.as_int = projection->impl->vertex_ids[index].AsInt()};
+      },
+      result);
+}
+
+mgp_error mgp_graph_projection_vertex_index(mgp_graph_projection *projection, mgp_vertex_id id, size_t *result) {
+  return WrapExceptions(
+      [projection, id] {
+        auto index = projection->impl->IndexOf(memgraph::storage::Gid::FromInt(id.as_int));
+        if (!index) throw std::out_of_range("The vertex is not part of the projection!");
+        return static_cast<size_t>(*index);
+      },
+      result);
+}
+
 mgp_error mgp_vertices_iterator_underlying_graph_is_mutable(mgp_vertices_iterator *it, int *result) {
   return mgp_graph_is_mutable(it->graph, result);
 }
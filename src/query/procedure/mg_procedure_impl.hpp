@@ -27,6 +27,7 @@
 
 #include "query/db_accessor.hpp"
 #include "query/procedure/cypher_type_ptr.hpp"
+#include "query/procedure/graph_projection.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/memory.hpp"
@@ -730,6 +731,19 @@ struct mgp_vertices_iterator {
   std::optional<mgp_vertex> current_v;
 };
 
+struct mgp_graph_projection {
+  using allocator_type = memgraph::utils::Allocator<mgp_graph_projection>;
+
+  mgp_graph_projection(std::shared_ptr<const memgraph::query::procedure::GraphProjection> impl,
+                       memgraph::utils::MemoryResource *memory)
+      : memory(memory), impl(std::move(impl)) {}
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  std::shared_ptr<const memgraph::query::procedure::GraphProjection> impl;
+};
+
 struct mgp_type {
   memgraph::query::procedure::CypherTypePtr impl;
 };
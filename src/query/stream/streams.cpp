@@ -32,14 +32,18 @@
 #include "query/stream/sources.hpp"
 #include "query/typed_value.hpp"
 #include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
 #include "utils/on_scope_exit.hpp"
 #include "utils/pmr/string.hpp"
+#include "utils/timer.hpp"
 #include "utils/variant_helpers.hpp"
 
 namespace memgraph::metrics {
 extern const Event MessagesConsumed;
+extern const Event StreamQueriesExecuted;
+extern const Event StreamBatchLatency_us;
 }  // namespace memgraph::metrics
 
 namespace memgraph::query::stream {
@@ -83,6 +87,31 @@ std::pair<TypedValue /*query*/, TypedValue /*parameters*/> ExtractTransformation
   return {query_value, params_value};
 }
 
+/// Consecutive transformation results with the same query text, which are
+/// executed one after another with their own parameters.
+struct QueryBatch {
+  std::string query;
+  std::vector<storage::PropertyValue> parameters;
+};
+
+/// Groups the results of the transformation into batches. Only consecutive
+/// results are grouped, so the queries are executed in the order in which the
+/// transformation returned them.
+std::vector<QueryBatch> GroupTransformationResults(const utils::pmr::vector<mgp_result_record> &rows,
+                                                   const std::string_view transformation_name,
+                                                   const std::string_view stream_name) {
+  std::vector<QueryBatch> batches;
+  for (const auto &row : rows) {
+    auto [query_value, params_value] = ExtractTransformationResult(row.values, transformation_name, stream_name);
+    const std::string_view query{query_value.ValueString()};
+    if (batches.empty() || batches.back().query != query) {
+      batches.push_back({.query = std::string{query}, .parameters = {}});
+    }
+    batches.back().parameters.emplace_back(params_value);
+  }
+  return batches;
+}
+
 template <typename TMessage>
 void CallCustomTransformation(const std::string &transformation_name, const std::vector<TMessage> &messages,
                               mgp_result &result, storage::Storage::Accessor &storage_accessor,
@@ -521,6 +550,7 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
     utils::OnScopeExit interpreter_cleanup{
         [interpreter_context, interpreter]() { interpreter_context->interpreters->erase(interpreter.get()); }};
 
+    utils::Timer timer;
     memgraph::metrics::IncrementCounter(memgraph::metrics::MessagesConsumed, messages.size());
     CallCustomTransformation(transformation_name, messages, result, *accessor, *memory_resource, stream_name);
 
@@ -532,32 +562,45 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
       interpreter->Abort();
     }};
 
+    const auto batches = GroupTransformationResults(result.rows, transformation_name, stream_name);
     const static storage::PropertyValue::map_t empty_parameters{};
     uint32_t i = 0;
     while (true) {
       try {
         interpreter->BeginTransaction();
-        for (auto &row : result.rows) {
-          spdlog::trace("Processing row in stream '{}'", stream_name);
-          auto [query_value, params_value] = ExtractTransformationResult(row.values, transformation_name, stream_name);
-          storage::PropertyValue params_prop{params_value};
-          std::string query{query_value.ValueString()};
-          spdlog::trace("Executing query '{}' in stream '{}'", query, stream_name);
-          auto prepare_result = interpreter->Prepare(
-              query,
-              [=](storage::Storage const *) { return params_prop.IsMap() ? params_prop.ValueMap() : empty_parameters; },
-              {});
-          if (!owner->IsAuthorized(prepare_result.privileges, "", &up_to_date_policy)) {
-            throw StreamsException{
-                "Couldn't execute query '{}' for stream '{}' because the owner is not authorized to execute the "
-                "query!",
-                query, stream_name};
+        for (const auto &batch : batches) {
+          spdlog::trace("Executing query '{}' {} time(s) in stream '{}'", batch.query, batch.parameters.size(),
+                        stream_name);
+          // The privileges depend only on the query text, so they are checked
+          // once per batch. The parsed query and its plan are taken from the
+          // caches after the first execution.
+          bool is_authorized = false;
+          for (const auto &params : batch.parameters) {
+            auto prepare_result = interpreter->Prepare(
+                batch.query,
+                [&params](storage::Storage const *) { return params.IsMap() ? params.ValueMap() : empty_parameters; },
+                {});
+            if (!is_authorized && !owner->IsAuthorized(prepare_result.privileges, "", &up_to_date_policy)) {
+              throw StreamsException{
+                  "Couldn't execute query '{}' for stream '{}' because the owner is not authorized to execute the "
+                  "query!",
+                  batch.query, stream_name};
+            }
+            is_authorized = true;
+            interpreter->PullAll(&stream);
           }
-          interpreter->PullAll(&stream);
         }
 
         spdlog::trace("Commit transaction in stream '{}'", stream_name);
         interpreter->CommitTransaction();
+
+        const auto elapsed = timer.Elapsed();
+        memgraph::metrics::IncrementCounter(memgraph::metrics::StreamQueriesExecuted, result.rows.size());
+        memgraph::metrics::Measure(memgraph::metrics::StreamBatchLatency_us,
+                                   std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+        spdlog::debug("Stream '{}' processed {} message(s) with {} query(s) in {} batch(es) in {:.3f}s ({:.0f} msg/s)",
+                      stream_name, messages.size(), result.rows.size(), batches.size(), elapsed.count(),
+                      elapsed.count() > 0 ? static_cast<double>(messages.size()) / elapsed.count() : 0.0);
         result.rows.clear();
         break;
       } catch (const query::TransactionSerializationException &e) {
@@ -11,15 +11,25 @@
 
 #include "query/time_to_live/time_to_live.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <thread>
+#include <variant>
+#include <vector>
 
+#include "dbms/database.hpp"
 #include "query/discard_value_stream.hpp"
 #include "query/interpreter.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/typed_value.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/bound.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/logging.hpp"
 #include "utils/temporal.hpp"
 
@@ -41,6 +51,171 @@ int GetPart(auto &current) {
 
 namespace memgraph::query::ttl {
 
+namespace {
+// Number of expired vertices deleted in a single transaction
+constexpr size_t kTtlBatchSize = 10000;
+
+/// Returns at most `kTtlBatchSize` vertices with the `label` whose `property`
+/// is a timestamp before `now_us`. The label+property index returns them in
+/// the order of expiry; without the index all vertices are scanned.
+std::vector<storage::VertexAccessor> CollectExpired(storage::Storage::Accessor *acc, storage::LabelId label,
+                                                    storage::PropertyId property, int64_t now_us) {
+  std::vector<storage::VertexAccessor> expired;
+  expired.reserve(kTtlBatchSize);
+  if (acc->LabelPropertyIndexExists(label, property)) {
+    const auto upper_bound = utils::MakeBoundExclusive(storage::PropertyValue(now_us));
+    for (auto vertex : acc->Vertices(label, property, std::nullopt, upper_bound, storage::View::OLD)) {
+      expired.push_back(vertex);
+      if (expired.size() == kTtlBatchSize) break;
+    }
+    return expired;
+  }
+  for (auto vertex : acc->Vertices(storage::View::OLD)) {
+    const auto has_label = vertex.HasLabel(label, storage::View::OLD);
+    if (has_label.HasError() || !*has_label) continue;
+    const auto value = vertex.GetProperty(property, storage::View::OLD);
+    if (value.HasError()) continue;
+    const bool is_expired = (value->IsInt() && value->ValueInt() < now_us) ||
+                            (value->IsDouble() && value->ValueDouble() < static_cast<double>(now_us));
+    if (!is_expired) continue;
+    expired.push_back(vertex);
+    if (expired.size() == kTtlBatchSize) break;
+  }
+  return expired;
+}
+
+/// Deletes the expired vertices in batches by running a Cypher query, so
+/// triggers are executed for them.
+void DeleteExpiredWithQuery(Interpreter &interpreter, int64_t now_us) {
+  memgraph::query::DiscardValueResultStream result_stream;
+  bool finished = false;
+  while (!finished) {
+    try {
+      interpreter.BeginTransaction();
+      auto prepare_result =
+          interpreter.Prepare("MATCH (n:TTL) WHERE n.ttl < $now WITH n LIMIT $batch DETACH DELETE n;",
+                              [now_us](auto) {
+                                UserParameters params;
+                                params.emplace("now", now_us);
+                                params.emplace("batch", static_cast<int64_t>(kTtlBatchSize));
+                                return params;
+                              },
+                              {});
+      const auto pull_res = interpreter.PullAll(&result_stream);
+      auto get_value = [&](std::string_view key) {
+        int64_t n = 0;
+        // Empty set will not have a stats field (nothing happened, so nothing to report)
+        const auto stats = pull_res.find("stats");
+        if (stats != pull_res.end()) {
+          // TODO: C++26 will handle transparent comparator with at()
+          n = stats->second.ValueMap().find(key)->second.ValueInt();
+        }
+        return n;
+      };
+      const auto n_deleted = get_value("nodes-deleted");
+      finished = !pull_res.at("has_more").ValueBool() && n_deleted == 0;
+      spdlog::trace("Committing TTL batch transaction");
+      interpreter.CommitTransaction();
+      const auto n_edges_deleted = get_value("relationships-deleted");
+      spdlog::trace("Committed TTL batch deleted {} vertices and {} edges", n_deleted, n_edges_deleted);
+      // Telemetry
+      memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedNodes, n_deleted);
+      memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedEdges, n_edges_deleted);
+    } catch (const TransactionSerializationException &e) {
+      spdlog::trace("TTL serialization error; Aborting and retrying...");
+      interpreter.Abort();  // Retry later
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    } catch (const WriteQueryOnMainException & /* not used */) {
+      // MAIN not ready to handle write queries; abort and try later
+      spdlog::trace("MAIN not ready for write queries. TTL will try again later.");
+      interpreter.Abort();  // Retry later
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      break;
+    } catch (const WriteQueryOnReplicaException & /* not used */) {
+      // TTL cannot run on a REPLICA; ReplicationHandler needs to pause and restart ttl
+      spdlog::trace("TTL on REPLICA is not supported.");
+      interpreter.Abort();
+      // Shouldn't need this sleep; just make sure replication handler has time to pause
+      std::this_thread::sleep_for(std::chrono::seconds{1});
+      break;
+    } catch (const DatabaseContextRequiredException &e) {
+      // No database; we are shutting down
+      interpreter.Abort();
+      spdlog::trace("No database associated with TTL; shuting down...");
+      break;
+    }
+    std::this_thread::yield();
+  }
+}
+
+/// Deletes the expired vertices in batches directly through the storage,
+/// without parsing and planning a query. The :TTL(ttl) label+property index
+/// (created when TTL is enabled) keeps the vertices ordered by their expiry
+/// timestamp, so each batch is a range scan of the index up to the current
+/// time. Triggers are not executed for the deleted vertices.
+template <typename TDbAccess>
+void DeleteExpiredFromStorage(TDbAccess &db_acc, InterpreterContext *interpreter_context, int64_t now_us) {
+  auto *storage = db_acc->storage();
+  const auto label = storage->NameToLabel("TTL");
+  const auto property = storage->NameToProperty("ttl");
+
+  bool finished = false;
+  while (!finished) {
+    if (interpreter_context->repl_state->IsReplica()) {
+      // TTL cannot run on a REPLICA; ReplicationHandler needs to pause and restart ttl
+      spdlog::trace("TTL on REPLICA is not supported.");
+      // Shouldn't need this sleep; just make sure replication handler has time to pause
+      std::this_thread::sleep_for(std::chrono::seconds{1});
+      break;
+    }
+    if (interpreter_context->coordinator_state_.has_value() &&
+        interpreter_context->coordinator_state_->get().IsDataInstance() &&
+        !interpreter_context->repl_state->IsMainWriteable()) {
+      // MAIN not ready to handle write queries; try later
+      spdlog::trace("MAIN not ready for write queries. TTL will try again later.");
+      break;
+    }
+
+    auto acc = storage->Access();
+    auto expired = CollectExpired(acc.get(), label, property, now_us);
+    if (expired.empty()) break;
+    finished = expired.size() < kTtlBatchSize;
+
+    std::vector<storage::VertexAccessor *> nodes;
+    nodes.reserve(expired.size());
+    std::ranges::transform(expired, std::back_inserter(nodes), [](auto &vertex) { return &vertex; });
+    auto deleted = acc->DetachDelete(std::move(nodes), {}, true);
+    if (deleted.HasError()) {
+      acc->Abort();
+      if (deleted.GetError() == storage::Error::SERIALIZATION_ERROR) {
+        spdlog::trace("TTL serialization error; Aborting and retrying...");
+        finished = false;
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        continue;
+      }
+      spdlog::warn("TTL failed to delete expired vertices.");
+      break;
+    }
+    const auto n_deleted = deleted.GetValue() ? deleted.GetValue()->first.size() : 0;
+    const auto n_edges_deleted = deleted.GetValue() ? deleted.GetValue()->second.size() : 0;
+
+    spdlog::trace("Committing TTL batch transaction");
+    auto commit = acc->Commit({.is_main = true}, db_acc);
+    // A failed commit is already aborted; the next run retries the deletion.
+    // Failing to replicate to a SYNC replica still commits locally.
+    if (commit.HasError() && !std::holds_alternative<storage::ReplicationError>(commit.GetError())) {
+      spdlog::warn("TTL failed to commit the deletion of expired vertices.");
+      break;
+    }
+    spdlog::trace("Committed TTL batch deleted {} vertices and {} edges", n_deleted, n_edges_deleted);
+    // Telemetry
+    memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedNodes, n_deleted);
+    memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedEdges, n_edges_deleted);
+    std::this_thread::yield();
+  }
+}
+}  // namespace
+
 template <typename TDbAccess>
 void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context) {
   if (!enabled_) {
@@ -67,69 +242,18 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context) {
                                                         // register new interpreter into interpreter_context
   interpreter_context->interpreters->insert(interpreter.get());
 
-  auto TTL = [interpreter = std::move(interpreter)]() {
-    memgraph::query::DiscardValueResultStream result_stream;
-    bool finished = false;
+  auto TTL = [interpreter = std::move(interpreter), db_acc, interpreter_context]() mutable {
     // Using microseconds to be aligned with timestamp() query, could just use seconds
     const auto now = std::chrono::system_clock::now();
     const auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch());
     spdlog::trace("Running TTL at {}", now);
-    while (!finished) {
-      try {
-        interpreter->BeginTransaction();
-        auto prepare_result =
-            interpreter->Prepare("MATCH (n:TTL) WHERE n.ttl < $now WITH n LIMIT $batch DETACH DELETE n;",
-                                 [now_us](auto) {
-                                   UserParameters params;
-                                   params.emplace("now", now_us.count());
-                                   params.emplace("batch", 10000);
-                                   return params;
-                                 },
-                                 {});
-        const auto pull_res = interpreter->PullAll(&result_stream);
-        auto get_value = [&](std::string_view key) {
-          int64_t n = 0;
-          // Empty set will not have a stats field (nothing happened, so nothing to report)
-          const auto stats = pull_res.find("stats");
-          if (stats != pull_res.end()) {
-            // TODO: C++26 will handle transparent comparator with at()
-            n = stats->second.ValueMap().find(key)->second.ValueInt();
-          }
-          return n;
-        };
-        const auto n_deleted = get_value("nodes-deleted");
-        finished = !pull_res.at("has_more").ValueBool() && n_deleted == 0;
-        spdlog::trace("Committing TTL batch transaction");
-        interpreter->CommitTransaction();
-        const auto n_edges_deleted = get_value("relationships-deleted");
-        spdlog::trace("Committed TTL batch deleted {} vertices and {} edges", n_deleted, n_edges_deleted);
-        // Telemetry
-        memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedNodes, n_deleted);
-        memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedEdges, n_edges_deleted);
-      } catch (const TransactionSerializationException &e) {
-        spdlog::trace("TTL serialization error; Aborting and retrying...");
-        interpreter->Abort();  // Retry later
-        std::this_thread::sleep_for(std::chrono::milliseconds{10});
-      } catch (const WriteQueryOnMainException & /* not used */) {
-        // MAIN not ready to handle write queries; abort and try later
-        spdlog::trace("MAIN not ready for write queries. TTL will try again later.");
-        interpreter->Abort();  // Retry later
-        std::this_thread::sleep_for(std::chrono::milliseconds{10});
-        break;
-      } catch (const WriteQueryOnReplicaException & /* not used */) {
-        // TTL cannot run on a REPLICA; ReplicationHandler needs to pause and restart ttl
-        spdlog::trace("TTL on REPLICA is not supported.");
-        interpreter->Abort();
-        // Shouldn't need this sleep; just make sure replication handler has time to pause
-        std::this_thread::sleep_for(std::chrono::seconds{1});
-        break;
-      } catch (const DatabaseContextRequiredException &e) {
-        // No database; we are shutting down
-        interpreter->Abort();
-        spdlog::trace("No database associated with TTL; shuting down...");
-        break;
-      }
-      std::this_thread::yield();
+    // Triggers are only executed for queries run by an interpreter, so the
+    // expired vertices are deleted directly through the storage only when the
+    // database has no triggers.
+    if (db_acc->trigger_store()->HasTriggers()) {
+      DeleteExpiredWithQuery(*interpreter, now_us.count());
+    } else {
+      DeleteExpiredFromStorage(db_acc, interpreter_context, now_us.count());
     }
     spdlog::trace("Finished TTL run from {}", now);
   };
@@ -48,7 +48,8 @@ struct ReplicationClient {
           [this, cb = std::forward<F>(callback), reconnect = false]() mutable {
             try {
               {
-                auto stream{rpc_client_.Stream<memgraph::replication_coordination_glue::FrequentHeartbeatRpc>()};
+                auto stream{
+                    heartbeat_rpc_client_.Stream<memgraph::replication_coordination_glue::FrequentHeartbeatRpc>()};
                 stream.AwaitResponse();
               }
               cb(reconnect, *this);
@@ -107,6 +108,10 @@ struct ReplicationClient {
   std::string name_;
   communication::ClientContext rpc_context_;
   rpc::Client rpc_client_;
+  // Heartbeats use their own connection, which the replica serves on a
+  // dedicated thread, so they aren't queued behind long requests (e.g.
+  // snapshot transfers) on `rpc_client_`
+  rpc::Client heartbeat_rpc_client_;
   std::chrono::seconds replica_check_frequency_;
   // True only when we are migrating from V1 or V2 to V3 in replication durability
   // and we want to set replica to listen to main
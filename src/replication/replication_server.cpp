@@ -28,15 +28,21 @@ auto CreateServerContext(const memgraph::replication::ReplicationServerConfig &c
 // have only a single main server. Also, the single-threaded guarantee
 // simplifies the rest of the implementation.
 constexpr auto kReplicationServerThreads = 1;
+// Heartbeats are sent on their own connection and served by a dedicated
+// thread, so they are answered while a long request (e.g. a snapshot) is
+// processed.
+constexpr auto kReplicationServerHeartbeatThreads = 1;
 }  // namespace
 
 ReplicationServer::ReplicationServer(const memgraph::replication::ReplicationServerConfig &config)
     : rpc_server_context_{CreateServerContext(config)},
-      rpc_server_{config.repl_server, &rpc_server_context_, kReplicationServerThreads} {
-  rpc_server_.Register<replication_coordination_glue::FrequentHeartbeatRpc>([](auto *req_reader, auto *res_builder) {
-    spdlog::debug("Received FrequentHeartbeatRpc");
-    replication_coordination_glue::FrequentHeartbeatHandler(req_reader, res_builder);
-  });
+      rpc_server_{config.repl_server, &rpc_server_context_, kReplicationServerThreads,
+                  kReplicationServerHeartbeatThreads} {
+  rpc_server_.RegisterDedicated<replication_coordination_glue::FrequentHeartbeatRpc>(
+      [](auto *req_reader, auto *res_builder) {
+        spdlog::debug("Received FrequentHeartbeatRpc");
+        replication_coordination_glue::FrequentHeartbeatHandler(req_reader, res_builder);
+      });
 }
 
 ReplicationServer::~ReplicationServer() {
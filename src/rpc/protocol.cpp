@@ -67,10 +67,14 @@ void Session::Execute() {
     throw SessionException("Session trying to execute a RPC call of an incorrect version!");
   }
 
-  // Access to `callbacks_` and `extended_callbacks_` is done here without
-  // acquiring the `mutex_` because we don't allow RPC registration after the
-  // server was started so those two maps will never be updated when we `find`
-  // over them.
+  // Access to `callbacks_`, `extended_callbacks_` and `dedicated_rpcs_` is
+  // done here without acquiring the `mutex_` because we don't allow RPC
+  // registration after the server was started so those maps will never be
+  // updated when we `find` over them.
+  if (first_request_) {
+    first_request_ = false;
+    dedicated_ = server_->dedicated_rpcs_.contains(req_id);
+  }
   auto it = server_->callbacks_.find(req_id);
   auto extended_it = server_->extended_callbacks_.end();
   if (it == server_->callbacks_.end()) {
@@ -58,11 +58,19 @@ class Session {
    */
   void Execute();
 
+  /**
+   * Returns true if the first request of the session was a dedicated RPC, so
+   * the session should be served by the dedicated workers of the server.
+   */
+  bool IsDedicated() const { return dedicated_; }
+
  private:
   Server *server_;
   io::network::Endpoint endpoint_;
   communication::InputStream *input_stream_;
   communication::OutputStream *output_stream_;
+  bool first_request_{true};
+  bool dedicated_{false};
 };
 
 }  // namespace memgraph::rpc
@@ -13,8 +13,10 @@
 
 namespace memgraph::rpc {
 
-Server::Server(io::network::Endpoint endpoint, communication::ServerContext *context, size_t workers_count)
-    : server_(std::move(endpoint), this, context, -1, context->use_ssl() ? "RPCS" : "RPC", workers_count) {}
+Server::Server(io::network::Endpoint endpoint, communication::ServerContext *context, size_t workers_count,
+               size_t dedicated_workers_count)
+    : server_(std::move(endpoint), this, context, -1, context->use_ssl() ? "RPCS" : "RPC", workers_count,
+              dedicated_workers_count) {}
 
 bool Server::Start() { return server_.Start(); }
 
@@ -13,6 +13,7 @@
 
 #include <map>
 #include <mutex>
+#include <set>
 #include <vector>
 
 #include "communication/server.hpp"
@@ -26,7 +27,7 @@ namespace memgraph::rpc {
 class Server {
  public:
   Server(io::network::Endpoint endpoint, communication::ServerContext *context,
-         size_t workers_count = std::thread::hardware_concurrency());
+         size_t workers_count = std::thread::hardware_concurrency(), size_t dedicated_workers_count = 0);
   Server(const Server &) = delete;
   Server(Server &&) = delete;
   Server &operator=(const Server &) = delete;
@@ -57,6 +58,18 @@ class Server {
     SPDLOG_TRACE("[RpcServer] register {} -> {}", rpc.req_type.name, rpc.res_type.name);
   }
 
+  /// Registers an RPC whose connections are served by the dedicated workers.
+  /// A connection is moved to them if its first request is a dedicated RPC,
+  /// so short requests (e.g. heartbeats) sent on their own connection are
+  /// answered even while the regular workers process long requests. Any later
+  /// request on such a connection is served by the dedicated workers as well.
+  template <class TRequestResponse>
+  void RegisterDedicated(std::function<void(slk::Reader *, slk::Builder *)> callback) {
+    Register<TRequestResponse>(std::move(callback));
+    auto guard = std::lock_guard{lock_};
+    dedicated_rpcs_.insert(TRequestResponse::Request::kType.id);
+  }
+
   template <class TRequestResponse>
   void Register(std::function<void(const io::network::Endpoint &, slk::Reader *, slk::Builder *)> callback) {
     auto guard = std::lock_guard{lock_};
@@ -89,6 +102,7 @@ class Server {
   std::mutex lock_;
   std::map<utils::TypeId, RpcCallback> callbacks_;
   std::map<utils::TypeId, RpcExtendedCallback> extended_callbacks_;
+  std::set<utils::TypeId> dedicated_rpcs_;
 
   communication::Server<Session, Server> server_;
 };
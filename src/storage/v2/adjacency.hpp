@@ -0,0 +1,167 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/small_vector.hpp"
+
+namespace memgraph::storage {
+
+// Edge lists of a vertex keep their entries in insertion order, so looking up
+// the edges of one type means scanning the whole list. A frozen edge list
+// keeps its entries grouped by edge type and sorted by the gid of the
+// neighbouring vertex, except for the last few entries which were added since
+// the last merge (see `Vertex::in_edges_unmerged`). Lookups binary search the
+// sorted part and scan the unmerged tail.
+//
+// Lists are frozen in bulk (`FreezeAdjacency`) or lazily once they grow to a
+// configured degree. Every modification of an edge list must go through the
+// functions below so a frozen list stays frozen.
+
+using AdjacencyEntry = std::tuple<EdgeTypeId, Vertex *, EdgeRef>;
+using AdjacencyList = utils::small_vector<AdjacencyEntry>;
+
+inline constexpr uint8_t kAdjacencyMaxUnmerged = kAdjacencyNotFrozen - 1;
+
+/// Order of a frozen edge list: entries are grouped by edge type and sorted by
+/// the gid of the neighbouring vertex inside each group.
+struct FrozenAdjacencyOrder {
+  using Key = std::pair<EdgeTypeId, Gid>;
+
+  static Key ToKey(const AdjacencyEntry &entry) {
+    return {std::get<EdgeTypeId>(entry), std::get<Vertex *>(entry)->gid};
+  }
+
+  bool operator()(const AdjacencyEntry &lhs, const AdjacencyEntry &rhs) const { return ToKey(lhs) < ToKey(rhs); }
+  bool operator()(const AdjacencyEntry &lhs, EdgeTypeId rhs) const { return std::get<EdgeTypeId>(lhs) < rhs; }
+  bool operator()(EdgeTypeId lhs, const AdjacencyEntry &rhs) const { return lhs < std::get<EdgeTypeId>(rhs); }
+  bool operator()(const AdjacencyEntry &lhs, const Key &rhs) const { return ToKey(lhs) < rhs; }
+  bool operator()(const Key &lhs, const AdjacencyEntry &rhs) const { return lhs < ToKey(rhs); }
+};
+
+inline bool IsFrozen(uint8_t unmerged) { return unmerged != kAdjacencyNotFrozen; }
+
+/// Sorts the edge list into the frozen order, merging the unmerged tail if the
+/// list is already frozen.
+inline void FreezeEdges(AdjacencyList &edges, uint8_t &unmerged) {
+  if (unmerged == 0) return;
+  if (!IsFrozen(unmerged)) {
+    std::sort(edges.begin(), edges.end(), FrozenAdjacencyOrder{});
+  } else {
+    auto middle = edges.end() - unmerged;
+    std::sort(middle, edges.end(), FrozenAdjacencyOrder{});
+    std::inplace_merge(edges.begin(), middle, edges.end(), FrozenAdjacencyOrder{});
+  }
+  unmerged = 0;
+}
+
+/// Freezes both edge lists of the vertex. The caller must have exclusive
+/// access to the vertex.
+inline void FreezeAdjacency(Vertex *vertex) {
+  FreezeEdges(vertex->in_edges, vertex->in_edges_unmerged);
+  FreezeEdges(vertex->out_edges, vertex->out_edges_unmerged);
+}
+
+/// Appends the entry to the edge list. An unfrozen list is frozen once it
+/// reaches `freeze_degree` entries, 0 means never.
+inline void AppendEdge(AdjacencyList &edges, uint8_t &unmerged, const AdjacencyEntry &entry,
+                       uint64_t freeze_degree = 0) {
+  edges.push_back(entry);
+  if (IsFrozen(unmerged)) {
+    if (++unmerged == kAdjacencyMaxUnmerged) FreezeEdges(edges, unmerged);
+  } else if (freeze_degree != 0 && edges.size() >= freeze_degree) {
+    FreezeEdges(edges, unmerged);
+  }
+}
+
+/// Returns the position of the entry in the edge list, or `edges.end()`.
+inline AdjacencyList::iterator FindEdge(AdjacencyList &edges, uint8_t unmerged, const AdjacencyEntry &entry) {
+  if (!IsFrozen(unmerged)) return std::find(edges.begin(), edges.end(), entry);
+  auto sorted_end = edges.end() - unmerged;
+  auto [first, last] =
+      std::equal_range(edges.begin(), sorted_end, FrozenAdjacencyOrder::ToKey(entry), FrozenAdjacencyOrder{});
+  auto it = std::find(first, last, entry);
+  if (it != last) return it;
+  return std::find(sorted_end, edges.end(), entry);
+}
+
+/// Removes the entry at `it` from the edge list.
+inline void EraseEdge(AdjacencyList &edges, uint8_t &unmerged, AdjacencyList::iterator it) {
+  if (IsFrozen(unmerged)) {
+    if (it < edges.end() - unmerged) {
+      // Shifting the rest of the list keeps both parts ordered
+      std::rotate(it, it + 1, edges.end());
+      edges.pop_back();
+      return;
+    }
+    --unmerged;
+  }
+  std::swap(*it, edges.back());
+  edges.pop_back();
+}
+
+/// Removes the last entry of the edge list.
+inline void PopBackEdge(AdjacencyList &edges, uint8_t &unmerged) {
+  edges.pop_back();
+  if (IsFrozen(unmerged) && unmerged > 0) --unmerged;
+}
+
+/// Replaces the entry at `it` with `entry`.
+inline void ReplaceEdge(AdjacencyList &edges, uint8_t &unmerged, AdjacencyList::iterator it,
+                        const AdjacencyEntry &entry) {
+  if (!IsFrozen(unmerged)) {
+    *it = entry;
+    return;
+  }
+  EraseEdge(edges, unmerged, it);
+  AppendEdge(edges, unmerged, entry);
+}
+
+/// Moves the entries for which `keep` returns false to the end of the edge
+/// list and returns the first of them. The caller must erase them before
+/// releasing the vertex lock, `unmerged` already accounts for their removal.
+template <typename TKeep>
+AdjacencyList::iterator PartitionEdges(AdjacencyList &edges, uint8_t &unmerged, TKeep keep) {
+  if (!IsFrozen(unmerged)) return std::partition(edges.begin(), edges.end(), keep);
+  auto removed_unmerged = std::count_if(edges.end() - unmerged, edges.end(), [&](auto &edge) { return !keep(edge); });
+  auto middle = std::stable_partition(edges.begin(), edges.end(), keep);
+  unmerged -= static_cast<uint8_t>(removed_unmerged);
+  return middle;
+}
+
+/// Calls `func` for every entry of the frozen edge list with the given edge
+/// type, limited to the given neighbour if it isn't null.
+template <typename TFunc>
+void ForEachFrozenEdge(const AdjacencyList &edges, uint8_t unmerged, EdgeTypeId edge_type, const Vertex *neighbour,
+                       TFunc &&func) {
+  auto sorted_end = edges.end() - unmerged;
+  auto [first, last] = neighbour ? std::equal_range(edges.begin(), sorted_end,
+                                                    FrozenAdjacencyOrder::Key{edge_type, neighbour->gid},
+                                                    FrozenAdjacencyOrder{})
+                                 : std::equal_range(edges.begin(), sorted_end, edge_type, FrozenAdjacencyOrder{});
+  std::for_each(first, last, func);
+  for (auto it = sorted_end; it != edges.end(); ++it) {
+    auto const &[type, vertex, _] = *it;
+    if (type != edge_type || (neighbour && vertex != neighbour)) continue;
+    func(*it);
+  }
+}
+
+}  // namespace memgraph::storage
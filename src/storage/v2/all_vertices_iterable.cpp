@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -14,8 +14,12 @@
 namespace memgraph::storage {
 
 auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipList<Vertex>::Iterator end,
-                            std::optional<VertexAccessor> *vertex, Storage *storage, Transaction *tx, View view) {
+                            std::optional<Gid> upper_gid, std::optional<VertexAccessor> *vertex, Storage *storage,
+                            Transaction *tx, View view) {
   while (it != end) {
+    if (upper_gid && it->gid >= *upper_gid) {
+      return end;
+    }
     if (not VertexAccessor::IsVisible(&*it, tx, view)) {
       ++it;
       continue;
@@ -28,15 +32,15 @@ auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipLis
 
 AllVerticesIterable::Iterator::Iterator(AllVerticesIterable *self, utils::SkipList<Vertex>::Iterator it)
     : self_(self),
-      it_(AdvanceToVisibleVertex(it, self->vertices_accessor_.end(), &self->vertex_, self->storage_, self->transaction_,
-                                 self->view_)) {}
+      it_(AdvanceToVisibleVertex(it, self->vertices_accessor_.end(), self->upper_gid_, &self->vertex_, self->storage_,
+                                 self->transaction_, self->view_)) {}
 
 VertexAccessor const &AllVerticesIterable::Iterator::operator*() const { return *self_->vertex_; }
 
 AllVerticesIterable::Iterator &AllVerticesIterable::Iterator::operator++() {
   ++it_;
-  it_ = AdvanceToVisibleVertex(it_, self_->vertices_accessor_.end(), &self_->vertex_, self_->storage_,
-                               self_->transaction_, self_->view_);
+  it_ = AdvanceToVisibleVertex(it_, self_->vertices_accessor_.end(), self_->upper_gid_, &self_->vertex_,
+                               self_->storage_, self_->transaction_, self_->view_);
   return *this;
 }
 
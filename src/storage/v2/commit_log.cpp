@@ -12,6 +12,8 @@
 #include "storage/v2/commit_log.hpp"
 #include "utils/memory.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <mutex>
 
 namespace memgraph::storage {
@@ -62,6 +64,32 @@ uint64_t CommitLog::OldestActive() {
   return oldest_active_;
 }
 
+bool CommitLog::AllFinished(uint64_t begin, uint64_t end) {
+  auto guard = std::lock_guard{lock_};
+  // All ids before the oldest active one are finished and their blocks may be
+  // deleted already.
+  begin = std::max(begin, oldest_active_);
+  if (begin >= end) return true;
+  // No id after the last block was marked.
+  if (end > next_start_) return false;
+
+  Block *block = head_;
+  uint64_t block_start = head_start_;
+  while (begin < end) {
+    while (begin >= block_start + kIdsInBlock) {
+      block = block->next;
+      block_start += kIdsInBlock;
+    }
+    const uint64_t idx_in_field = begin % kIdsInField;
+    const uint64_t count = std::min(kIdsInField - idx_in_field, end - begin);
+    const uint64_t mask = (count == kIdsInField ? std::numeric_limits<uint64_t>::max() : (1ULL << count) - 1)
+                          << idx_in_field;
+    if ((block->field[(begin - block_start) / kIdsInField] & mask) != mask) return false;
+    begin += count;
+  }
+  return true;
+}
+
 void CommitLog::UpdateOldestActive() {
   while (head_) {
     // This is necessary for amortized constant complexity. If we always start
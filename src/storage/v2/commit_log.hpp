@@ -53,6 +53,9 @@ class CommitLog final {
   /// Retrieve the oldest transaction still not marked as finished.
   uint64_t OldestActive();
 
+  /// Check whether all ids in the range [begin, end) are marked as finished.
+  bool AllFinished(uint64_t begin, uint64_t end);
+
  private:
   static constexpr uint64_t kBlockSize = 8192;
   static constexpr uint64_t kIdsInField = sizeof(uint64_t) * 8;
@@ -14,6 +14,8 @@
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <string>
+#include <vector>
 
 #include "flags/coord_flag_env_handler.hpp"
 #include "flags/coordination.hpp"
@@ -46,7 +48,13 @@ struct SalientConfig {
     bool enable_label_index_auto_creation{false};
     bool enable_edge_type_index_auto_creation{false};
     bool delta_on_identical_property_update{true};
+    bool merge_property_deltas{false};
     bool property_store_compression_enabled{false};
+    bool freeze_adjacency{false};
+    uint64_t freeze_adjacency_degree{10000};
+    bool label_property_index_hash_lookups{false};
+    std::vector<std::string> dictionary_encoded_properties;
+    uint64_t dictionary_max_strings{100000};
     friend bool operator==(const Items &lrh, const Items &rhs) = default;
   } items;
 
@@ -100,6 +108,8 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    uint64_t workers{1};                   // threads unlinking deltas and cleaning up indices, including the GC thread
+    uint64_t max_transactions_per_run{0};  // 0 means periodic runs unlink all transactions they can
     friend bool operator==(const Gc &lrh, const Gc &rhs) = default;
   } gc;  // SYSTEM FLAG
 
@@ -114,15 +124,18 @@ struct Config {
 
     std::chrono::milliseconds snapshot_interval{std::chrono::minutes(2)};  // PER DATABASE
     uint64_t snapshot_retention_count{3};                                  // PER DATABASE
+    uint64_t snapshot_skip_threshold_percent{0};                           // PER DATABASE
 
     uint64_t wal_file_size_kibibytes{20 * 1024};  // PER DATABASE
     uint64_t wal_file_flush_every_n_tx{100000};   // PER DATABASE
+    bool wal_group_commit{false};                 // PER DATABASE
 
     bool snapshot_on_exit{false};                      // PER DATABASE
     bool restore_replication_state_on_startup{false};  // PER INSTANCE
 
     uint64_t items_per_batch{1'000'000};  // PER DATABASE
     uint64_t recovery_thread_count{8};    // PER INSTANCE SYSTEM FLAG
+    uint64_t snapshot_thread_count{8};    // PER INSTANCE SYSTEM FLAG
 
     bool allow_parallel_schema_creation{false};  // PER DATABASE
     friend bool operator==(const Durability &lrh, const Durability &rhs) = default;
@@ -142,6 +155,8 @@ struct Config {
     std::filesystem::path id_name_mapper_directory{"storage/rocksdb_id_name_mapper"};
     std::filesystem::path durability_directory{"storage/rocksdb_durability"};
     std::filesystem::path wal_directory{"storage/rocksdb_wal"};
+    /// Number of vertices and edges kept in the cache shared by transactions.
+    uint64_t object_cache_size{100000};
     friend bool operator==(const DiskConfig &lrh, const DiskConfig &rhs) = default;
   } disk;
 
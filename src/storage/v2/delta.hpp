@@ -104,6 +104,8 @@ class PreviousPtr {
     storage_.store(value | kEdge, std::memory_order_release);
   }
 
+  void Reset() { storage_.store(0, std::memory_order_release); }
+
  private:
   std::atomic<uintptr_t> storage_;
 };
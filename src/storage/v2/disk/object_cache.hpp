@@ -0,0 +1,201 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "utils/event_counter.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::metrics {
+extern const Event DiskCacheHit;
+extern const Event DiskCacheMiss;
+extern const Event DiskCacheEviction;
+}  // namespace memgraph::metrics
+
+namespace memgraph::storage {
+
+/// Key and value of a vertex in the vertex column family. The key holds the
+/// labels of the vertex, so it can't be found by its gid without a scan.
+struct CachedDiskVertex {
+  std::string key;
+  std::string value;
+};
+
+/// Objects read from RocksDB, shared by all transactions of a `DiskStorage`, so
+/// transactions reading the same hot objects skip the RocksDB lookups.
+///
+/// Every object is cached with the range of start timestamps of transactions
+/// which see that version of it. The range begins with the start timestamp of
+/// the transaction which read it and ends with the commit timestamp of the
+/// first transaction which changed the object afterwards. Committing
+/// transactions call `Invalidate` for every object they wrote, once the writes
+/// are committed to RocksDB.
+///
+/// Invalidated objects are remembered together with the epoch of the
+/// invalidation. Readers take the epoch before reading from RocksDB and pass
+/// it to `Insert`, so a version which was changed while it was being read
+/// doesn't get cached.
+///
+/// The cache holds at most `capacity` objects and evicts them with the CLOCK
+/// algorithm. A capacity of 0 disables the cache.
+template <typename TObject>
+class DiskObjectCache final {
+ public:
+  explicit DiskObjectCache(uint64_t capacity) : capacity_(capacity) {}
+
+  DiskObjectCache(const DiskObjectCache &) = delete;
+  DiskObjectCache &operator=(const DiskObjectCache &) = delete;
+  DiskObjectCache(DiskObjectCache &&) = delete;
+  DiskObjectCache &operator=(DiskObjectCache &&) = delete;
+  ~DiskObjectCache() = default;
+
+  bool Enabled() const { return capacity_ != 0; }
+
+  uint64_t Epoch() const { return epoch_.load(std::memory_order_acquire); }
+
+  /// Returns the object if its cached version is the one seen by the
+  /// transaction with the given start timestamp, otherwise null.
+  std::shared_ptr<const TObject> Find(Gid gid, uint64_t start_timestamp) {
+    if (!Enabled()) return nullptr;
+    auto object = state_.WithLock([&](State &state) -> std::shared_ptr<const TObject> {
+      auto it = state.index.find(gid);
+      if (it == state.index.end()) return nullptr;
+      auto &entry = state.entries[it->second];
+      if (!entry.object || start_timestamp < entry.valid_from || start_timestamp >= entry.valid_until) return nullptr;
+      entry.referenced = true;
+      return entry.object;
+    });
+    metrics::IncrementCounter(object ? metrics::DiskCacheHit : metrics::DiskCacheMiss);
+    return object;
+  }
+
+  /// Caches the object read by the transaction with the given start timestamp.
+  /// @param epoch the epoch taken before the object was read
+  void Insert(Gid gid, TObject object, uint64_t start_timestamp, uint64_t epoch) {
+    if (!Enabled()) return;
+    auto shared_object = std::make_shared<const TObject>(std::move(object));
+    auto state = state_.Lock();
+    // The invalidations of evicted entries aren't known per object anymore.
+    if (epoch < state->evicted_epoch || start_timestamp < state->evicted_last_write) return;
+
+    if (auto it = state->index.find(gid); it != state->index.end()) {
+      auto &entry = state->entries[it->second];
+      // The object changed while it was being read or after the snapshot of
+      // the reader, which doesn't know for which transactions its version is
+      // valid.
+      if (epoch < entry.last_write_epoch || start_timestamp < entry.last_write) return;
+      // The same version is already cached.
+      if (entry.object && entry.valid_until == kInfinity) return;
+      entry.object = std::move(shared_object);
+      entry.valid_from = start_timestamp;
+      entry.valid_until = kInfinity;
+      return;
+    }
+
+    auto &entry = Acquire(*state, gid);
+    entry.object = std::move(shared_object);
+    entry.valid_from = start_timestamp;
+  }
+
+  /// Ends the validity of the cached version of the object, which was changed
+  /// by the transaction with the given commit timestamp.
+  void Invalidate(Gid gid, uint64_t commit_timestamp) {
+    if (!Enabled()) return;
+    auto state = state_.Lock();
+    const auto epoch = epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    auto it = state->index.find(gid);
+    auto &entry = it != state->index.end() ? state->entries[it->second] : Acquire(*state, gid);
+    if (entry.object) {
+      if (commit_timestamp > entry.valid_from) {
+        entry.valid_until = std::min(entry.valid_until, commit_timestamp);
+      } else {
+        // The reader started after the commit, but read the object before the
+        // writes were committed to RocksDB.
+        entry.object = nullptr;
+      }
+    }
+    entry.last_write = std::max(entry.last_write, commit_timestamp);
+    entry.last_write_epoch = epoch;
+  }
+
+  /// Number of cached objects.
+  size_t Size() {
+    return state_.WithLock([](const State &state) {
+      return static_cast<size_t>(std::count_if(state.entries.begin(), state.entries.end(),
+                                               [](const Entry &entry) { return entry.object != nullptr; }));
+    });
+  }
+
+ private:
+  static constexpr uint64_t kInfinity = std::numeric_limits<uint64_t>::max();
+
+  struct Entry {
+    Gid gid;
+    /// Null if only the last write of the object is remembered.
+    std::shared_ptr<const TObject> object;
+    uint64_t valid_from{0};
+    uint64_t valid_until{kInfinity};
+    uint64_t last_write{0};
+    uint64_t last_write_epoch{0};
+    bool referenced{false};
+  };
+
+  struct State {
+    std::vector<Entry> entries;
+    std::unordered_map<Gid, size_t> index;
+    size_t hand{0};
+    /// Latest invalidation of the evicted entries.
+    uint64_t evicted_last_write{0};
+    uint64_t evicted_epoch{0};
+  };
+
+  /// Returns a new entry for `gid`, evicting an entry which wasn't referenced
+  /// since the clock hand passed it the last time if the cache is full.
+  Entry &Acquire(State &state, Gid gid) {
+    if (state.entries.size() < capacity_) {
+      state.index.emplace(gid, state.entries.size());
+      return state.entries.emplace_back(Entry{.gid = gid});
+    }
+    while (true) {
+      const auto index = state.hand;
+      state.hand = (state.hand + 1) % state.entries.size();
+      auto &entry = state.entries[index];
+      if (entry.referenced) {
+        entry.referenced = false;
+        continue;
+      }
+      if (entry.object) metrics::IncrementCounter(metrics::DiskCacheEviction);
+      state.evicted_last_write = std::max(state.evicted_last_write, entry.last_write);
+      state.evicted_epoch = std::max(state.evicted_epoch, entry.last_write_epoch);
+      state.index.erase(entry.gid);
+      entry = Entry{.gid = gid};
+      state.index.emplace(gid, index);
+      return entry;
+    }
+  }
+
+  uint64_t capacity_;
+  std::atomic<uint64_t> epoch_{0};
+  utils::Synchronized<State, utils::SpinLock> state_;
+};
+
+}  // namespace memgraph::storage
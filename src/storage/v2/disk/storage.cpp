@@ -240,7 +240,9 @@ bool IsPropertyValueWithinInterval(const PropertyValue &value,
 DiskStorage::DiskStorage(Config config)
     : Storage(config, StorageMode::ON_DISK_TRANSACTIONAL),
       kvstore_(std::make_unique<RocksDBStorage>()),
-      durable_metadata_(config) {
+      durable_metadata_(config),
+      vertex_cache_(config.disk.object_cache_size),
+      edge_cache_(config.disk.object_cache_size) {
   LoadPersistingMetadataInfo();
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
@@ -595,6 +597,15 @@ VerticesIterable DiskStorage::DiskAccessor::Vertices(LabelId label, PropertyId p
   return VerticesIterable(AllVerticesIterable(indexed_vertices->access(), storage_, &transaction_, view));
 }
 
+VerticesIterable DiskStorage::DiskAccessor::Vertices(LabelId /*label*/,
+                                                     const std::vector<PropertyId> & /*properties*/,
+                                                     const std::vector<PropertyValue> & /*prefix*/,
+                                                     const std::optional<utils::Bound<PropertyValue>> & /*lower_bound*/,
+                                                     const std::optional<utils::Bound<PropertyValue>> & /*upper_bound*/,
+                                                     View /*view*/) {
+  throw utils::NotYetImplemented("Composite index related operations are not yet supported using on-disk storage mode.");
+}
+
 VerticesIterable DiskStorage::DiskAccessor::Vertices(LabelId label, PropertyId property,
                                                      const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                                                      const std::optional<utils::Bound<PropertyValue>> &upper_bound,
@@ -1409,6 +1420,13 @@ std::optional<VertexAccessor> DiskStorage::FindVertex(storage::Gid gid, Transact
     }
   }
 
+  // The key starts with the labels of the vertex, so finding it by the gid
+  // needs a scan of the whole column family.
+  if (auto cached = vertex_cache_.Find(gid, transaction->start_timestamp)) {
+    return LoadVertexToMainMemoryCache(transaction, cached->key, cached->value, kDeserializeTimestamp);
+  }
+
+  const auto cache_epoch = vertex_cache_.Epoch();
   rocksdb::ReadOptions read_opts;
   auto strTs = utils::StringTimestamp(transaction->start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -1418,14 +1436,31 @@ std::optional<VertexAccessor> DiskStorage::FindVertex(storage::Gid gid, Transact
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
     if (Gid::FromString(utils::ExtractGidFromKey(key)) == gid) {
+      std::string value = it->value().ToString();
+      vertex_cache_.Insert(gid, {key, value}, transaction->start_timestamp, cache_epoch);
       // We should pass it->timestamp().ToString() instead of "0"
       // This is hack until RocksDB will support timestamp() in WBWI iterator
-      return LoadVertexToMainMemoryCache(transaction, key, it->value().ToString(), kDeserializeTimestamp);
+      return LoadVertexToMainMemoryCache(transaction, key, value, kDeserializeTimestamp);
     }
   }
   return std::nullopt;
 }
 
+std::string DiskStorage::ReadEdgeValue(Transaction *transaction, const rocksdb::ReadOptions &read_options,
+                                       const std::string &edge_gid) {
+  const auto gid = Gid::FromString(edge_gid);
+  if (auto cached = edge_cache_.Find(gid, transaction->start_timestamp)) {
+    return *cached;
+  }
+
+  const auto cache_epoch = edge_cache_.Epoch();
+  std::string edge_val_str;
+  auto edge_res = transaction->disk_transaction_->Get(read_options, kvstore_->edge_chandle, edge_gid, &edge_val_str);
+  MG_ASSERT(edge_res.ok(), "rocksdb: Failed to find edge with gid {} in edge column family", edge_gid);
+  edge_cache_.Insert(gid, edge_val_str, transaction->start_timestamp, cache_epoch);
+  return edge_val_str;
+}
+
 std::optional<EdgeAccessor> DiskStorage::CreateEdgeFromDisk(const VertexAccessor *from, const VertexAccessor *to,
                                                             Transaction *transaction, EdgeTypeId edge_type,
                                                             storage::Gid gid, const std::string_view properties,
@@ -1496,10 +1531,7 @@ std::vector<EdgeAccessor> DiskStorage::OutEdges(const VertexAccessor *src_vertex
       hops_limit->IncrementHopsCount(1);
       if (hops_limit->IsLimitReached()) break;
     }
-    std::string edge_val_str;
-    auto edge_res = transaction->disk_transaction_->Get(ro, kvstore_->edge_chandle, edge_gid_str, &edge_val_str);
-
-    MG_ASSERT(edge_res.ok(), "rocksdb: Failed to find edge with gid {} in edge column family", edge_gid_str);
+    const std::string edge_val_str = ReadEdgeValue(transaction, ro, edge_gid_str);
 
     auto edge_type_id = utils::ExtractEdgeTypeIdFromEdgeValue(edge_val_str);
     if (!edge_types.empty() && !utils::Contains(edge_types, edge_type_id)) continue;
@@ -1564,10 +1596,7 @@ std::vector<EdgeAccessor> DiskStorage::InEdges(const VertexAccessor *dst_vertex,
       hops_limit->IncrementHopsCount(1);
       if (hops_limit->IsLimitReached()) break;
     }
-    std::string edge_val_str;
-    auto edge_res = transaction->disk_transaction_->Get(ro, kvstore_->edge_chandle, edge_gid_str, &edge_val_str);
-
-    MG_ASSERT(edge_res.ok(), "rocksdb: Failed to find edge with gid {} in edge column family", edge_gid_str);
+    const std::string edge_val_str = ReadEdgeValue(transaction, ro, edge_gid_str);
 
     auto edge_type_id = utils::ExtractEdgeTypeIdFromEdgeValue(edge_val_str);
     if (!edge_types.empty() && !utils::Contains(edge_types, edge_type_id)) continue;
@@ -1771,6 +1800,9 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
         case MetadataDelta::Action::POINT_INDEX_CREATE:
         case MetadataDelta::Action::POINT_INDEX_DROP:
           throw utils::NotYetImplemented("Point index is not implemented for DiskStorage.");
+        case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+          throw utils::NotYetImplemented("Composite indices are not implemented for DiskStorage.");
       }
     }
   } else if (transaction_.deltas.empty() ||
@@ -1845,6 +1877,10 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
   delete transaction_.disk_transaction_;
   transaction_.disk_transaction_ = nullptr;
 
+  if (commit_timestamp_) {
+    disk_storage->InvalidateCachedObjects(&transaction_, *commit_timestamp_);
+  }
+
   spdlog::trace("rocksdb: Commit successful");
   if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     disk_storage->indices_.text_index_.Commit();
@@ -2082,6 +2118,16 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor:
       "Edge-type index related operations are not yet supported using on-disk storage mode.");
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::CreateIndex(
+    LabelId /*label*/, const std::vector<PropertyId> & /*properties*/) {
+  throw utils::NotYetImplemented("Composite index related operations are not yet supported using on-disk storage mode.");
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::DropIndex(
+    LabelId /*label*/, const std::vector<PropertyId> & /*properties*/) {
+  throw utils::NotYetImplemented("Composite index related operations are not yet supported using on-disk storage mode.");
+}
+
 utils::BasicResult<storage::StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::CreatePointIndex(
     storage::LabelId /*label*/, storage::PropertyId /*property*/) {
   throw utils::NotYetImplemented("Point index related operations are not yet supported using on-disk storage mode.");
@@ -2194,6 +2240,29 @@ Transaction DiskStorage::CreateTransaction(IsolationLevel isolation_level, Stora
 
 uint64_t DiskStorage::GetCommitTimestamp() { return timestamp_++; }
 
+void DiskStorage::InvalidateCachedObjects(Transaction *transaction, uint64_t commit_timestamp) {
+  auto invalidate_vertices = [this, commit_timestamp](const auto &vertex_acc) {
+    for (const Vertex &vertex : vertex_acc) {
+      if (VertexNeedsToBeSerialized(vertex)) vertex_cache_.Invalidate(vertex.gid, commit_timestamp);
+    }
+  };
+  invalidate_vertices(transaction->vertices_->access());
+  for (const auto &vec : transaction->index_storage_) {
+    invalidate_vertices(vec->access());
+  }
+  for (const auto &[vertex_gid, _] : transaction->vertices_to_delete_) {
+    vertex_cache_.Invalidate(Gid::FromString(vertex_gid), commit_timestamp);
+  }
+
+  // Deserialized edges are written again on commit as well, see `FlushModifiedEdges`.
+  for (const auto &[edge_gid, _] : transaction->modified_edges_) {
+    edge_cache_.Invalidate(edge_gid, commit_timestamp);
+  }
+  for (const auto &[edge_gid, _] : transaction->edges_to_delete_) {
+    edge_cache_.Invalidate(Gid::FromString(edge_gid), commit_timestamp);
+  }
+}
+
 std::unique_ptr<Storage::Accessor> DiskStorage::Access(std::optional<IsolationLevel> override_isolation_level) {
   auto isolation_level = override_isolation_level.value_or(isolation_level_);
   if (isolation_level != IsolationLevel::SNAPSHOT_ISOLATION) {
@@ -2229,7 +2298,8 @@ IndicesInfo DiskStorage::DiskAccessor::ListAllIndices() const {
   auto &text_index = storage_->indices_.text_index_;
   return {disk_label_index->ListIndices(), disk_label_property_index->ListIndices(),
           {/* edge type indices */},       {/* edge_type_property */},
-          text_index.ListIndices(),        {/*  */}};
+          text_index.ListIndices(),        {/*  */},
+          {/* label_property_composite */}};
 }
 ConstraintsInfo DiskStorage::DiskAccessor::ListAllConstraints() const {
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
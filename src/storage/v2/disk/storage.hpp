@@ -15,6 +15,7 @@
 #include "storage/v2/constraints/constraint_violation.hpp"
 #include "storage/v2/disk/durable_metadata.hpp"
 #include "storage/v2/disk/edge_import_mode_cache.hpp"
+#include "storage/v2/disk/object_cache.hpp"
 #include "storage/v2/disk/rocksdb_storage.hpp"
 #include "storage/v2/edge_import_mode.hpp"
 #include "storage/v2/id_types.hpp"
@@ -73,6 +74,11 @@ class DiskStorage final : public Storage {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              const std::vector<PropertyValue> &prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
     std::optional<EdgeAccessor> FindEdge(Gid gid, View view) override;
 
     EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
@@ -102,6 +108,16 @@ class DiskStorage final : public Storage {
       return 10;
     }
 
+    uint64_t ApproximateVertexCount(LabelId /*label*/,
+                                    const std::vector<PropertyId> & /*properties*/) const override {
+      return 10;
+    }
+
+    uint64_t ApproximateVertexCount(LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+                                    const std::vector<PropertyValue> & /*values*/) const override {
+      return 10;
+    }
+
     uint64_t ApproximateEdgeCount(EdgeTypeId /*edge_type*/) const override { return 10; }
 
     uint64_t ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/) const override { return 10; }
@@ -173,6 +189,13 @@ class DiskStorage final : public Storage {
       return disk_storage->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyIndexExists(LabelId /*label*/, const std::vector<PropertyId> & /*properties*/) const override {
+      // Composite indices don't exist for on disk
+      return false;
+    }
+
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListCompositeIndices() const override { return {}; }
+
     bool EdgeTypeIndexExists(EdgeTypeId edge_type) const override;
 
     bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId proeprty) const override;
@@ -200,6 +223,9 @@ class DiskStorage final : public Storage {
 
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label, PropertyId property) override;
 
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+        LabelId label, const std::vector<PropertyId> &properties) override;
+
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type,
                                                                       bool unique_access_needed = true) override;
 
@@ -210,6 +236,9 @@ class DiskStorage final : public Storage {
 
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label, PropertyId property) override;
 
+    utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+        LabelId label, const std::vector<PropertyId> &properties) override;
+
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type) override;
 
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type, PropertyId property) override;
@@ -332,6 +361,11 @@ class DiskStorage final : public Storage {
 
   std::optional<VertexAccessor> FindVertex(Gid gid, Transaction *transaction, View view);
 
+  /// Reads the value of the edge from the edge column family, or from the
+  /// edge cache if it was read by an earlier transaction.
+  std::string ReadEdgeValue(Transaction *transaction, const rocksdb::ReadOptions &read_options,
+                            const std::string &edge_gid);
+
   std::optional<EdgeAccessor> CreateEdgeFromDisk(const VertexAccessor *from, const VertexAccessor *to,
                                                  Transaction *transaction, EdgeTypeId edge_type, storage::Gid gid,
                                                  std::string_view properties, std::string_view old_disk_key,
@@ -381,11 +415,17 @@ class DiskStorage final : public Storage {
 
   uint64_t GetCommitTimestamp();
 
+  /// Invalidates the cached versions of the vertices and edges written by the
+  /// committed transaction.
+  void InvalidateCachedObjects(Transaction *transaction, uint64_t commit_timestamp);
+
   std::unique_ptr<RocksDBStorage> kvstore_;
   DurableMetadata durable_metadata_;
   EdgeImportMode edge_import_status_{EdgeImportMode::INACTIVE};
   std::unique_ptr<EdgeImportModeCache> edge_import_mode_cache_{nullptr};
   std::atomic<uint64_t> vertex_count_{0};
+  DiskObjectCache<CachedDiskVertex> vertex_cache_;
+  DiskObjectCache<std::string> edge_cache_;
   /// Disk does not have point index, yet an empty/null object is needed to make in_memory code for point index simple.
   static PointIndexStorage empty_point_index_;
 };
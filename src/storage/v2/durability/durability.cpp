@@ -43,6 +43,7 @@
 #include "utils/logging.hpp"
 #include "utils/memory_tracker.hpp"
 #include "utils/message.hpp"
+#include "utils/string.hpp"
 #include "utils/timer.hpp"
 namespace memgraph::metrics {
 extern const Event SnapshotRecoveryLatency_us;
@@ -205,6 +206,19 @@ void RecoverIndicesAndStats(const RecoveredIndicesAndConstraints::IndicesMetadat
   }
   spdlog::info("Label+property indices are recreated.");
 
+  // Recover composite label+property indices.
+  spdlog::info("Recreating {} composite label+property indices from metadata.",
+               indices_metadata.label_property_composite.size());
+  for (const auto &[label, properties] : indices_metadata.label_property_composite) {
+    if (!mem_label_property_index->CreateIndex(label, properties, vertices->access(), parallel_exec_info))
+      throw RecoveryFailure("The composite label+property index must be created here!");
+    std::vector<std::string> property_names;
+    for (const auto &property : properties) property_names.emplace_back(name_id_mapper->IdToName(property.AsUint()));
+    spdlog::info("Index on :{}({}) is recreated from metadata", name_id_mapper->IdToName(label.AsUint()),
+                 utils::Join(property_names, ", "));
+  }
+  spdlog::info("Composite label+property indices are recreated.");
+
   // Recover label+property indices statistics.
   spdlog::info("Recreating {} label+property indices statistics from metadata.",
                indices_metadata.label_property_stats.size());
@@ -382,7 +396,7 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
     utils::UUID &uuid, ReplicationStorageState &repl_storage_state, utils::SkipList<Vertex> *vertices,
     utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata, std::atomic<uint64_t> *edge_count,
     NameIdMapper *name_id_mapper, Indices *indices, Constraints *constraints, Config const &config,
-    uint64_t *wal_seq_num, EnumStore *enum_store, SchemaInfo *schema_info,
+    uint64_t *wal_seq_num, EnumStore *enum_store, SchemaInfo *schema_info, StringDictionary *string_dictionary,
     std::function<std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>(Gid)> find_edge) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
   spdlog::info("Recovering persisted data using snapshot ({}) and WAL directory ({}).", snapshot_directory_,
@@ -421,7 +435,8 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
       try {
         recovered_snapshot =
             LoadSnapshot(path, vertices, edges, edges_metadata, epoch_history, name_id_mapper, edge_count, config,
-                         enum_store, config.salient.items.enable_schema_info ? schema_info : nullptr);
+                         enum_store, config.salient.items.enable_schema_info ? schema_info : nullptr,
+                         string_dictionary);
         spdlog::info("Snapshot recovery successful!");
         break;
       } catch (const RecoveryFailure &e) {
@@ -560,7 +575,8 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
       try {
         auto info = LoadWal(wal_file.path, &indices_constraints, last_loaded_timestamp, vertices, edges, name_id_mapper,
                             edge_count, config.salient.items, enum_store,
-                            config.salient.items.enable_schema_info ? schema_info : nullptr, find_edge);
+                            config.salient.items.enable_schema_info ? schema_info : nullptr, string_dictionary,
+                            find_edge);
         recovery_info.next_vertex_id = std::max(recovery_info.next_vertex_id, info.next_vertex_id);
         recovery_info.next_edge_id = std::max(recovery_info.next_edge_id, info.next_edge_id);
         recovery_info.next_timestamp = std::max(recovery_info.next_timestamp, info.next_timestamp);
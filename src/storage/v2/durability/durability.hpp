@@ -30,6 +30,7 @@
 #include "storage/v2/name_id_mapper.hpp"
 #include "storage/v2/replication/replication_storage_state.hpp"
 #include "storage/v2/schema_info.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/vertex.hpp"
 #include "utils/skip_list.hpp"
 
@@ -139,7 +140,7 @@ struct Recovery {
       utils::UUID &uuid, ReplicationStorageState &repl_storage_state, utils::SkipList<Vertex> *vertices,
       utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata, std::atomic<uint64_t> *edge_count,
       NameIdMapper *name_id_mapper, Indices *indices, Constraints *constraints, Config const &config,
-      uint64_t *wal_seq_num, EnumStore *enum_store, SchemaInfo *schema_info,
+      uint64_t *wal_seq_num, EnumStore *enum_store, SchemaInfo *schema_info, StringDictionary *string_dictionary,
       std::function<std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>(Gid)> find_edge);
 
   const std::filesystem::path snapshot_directory_;
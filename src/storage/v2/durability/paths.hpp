@@ -21,6 +21,9 @@ namespace memgraph::storage::durability {
 static const std::string kSnapshotDirectory{"snapshots"};
 static const std::string kWalDirectory{"wal"};
 static const std::string kBackupDirectory{".backup"};
+// Subdirectory of the snapshot directory for the parts of a snapshot which is
+// being created.
+static const std::string kSnapshotSegmentsDirectory{".segments"};
 static const std::string kLockFile{".lock"};
 
 // This is the prefix used for Snapshot and WAL filenames. It is a timestamp
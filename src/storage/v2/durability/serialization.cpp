@@ -192,6 +192,8 @@ void Encoder::SetPosition(uint64_t position) { file_.SetPosition(utils::OutputFi
 
 void Encoder::Sync() { file_.Sync(); }
 
+void Encoder::SyncWritten() { file_.SyncWritten(); }
+
 void Encoder::Finalize() {
   file_.Sync();
   file_.Close();
@@ -201,7 +203,9 @@ void Encoder::DisableFlushing() { file_.DisableFlushing(); }
 
 void Encoder::EnableFlushing() { file_.EnableFlushing(); }
 
-void Encoder::TryFlushing() { file_.TryFlushing(); }
+bool Encoder::TryFlushing() { return file_.TryFlushing(); }
+
+void Encoder::WaitForFlushing() { file_.WaitForFlushing(); }
 
 std::pair<const uint8_t *, size_t> Encoder::CurrentFileBuffer() const { return file_.CurrentBuffer(); }
 
@@ -535,6 +539,8 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::DELTA_POINT_INDEX_DROP:
     case Marker::DELTA_TYPE_CONSTRAINT_CREATE:
     case Marker::DELTA_TYPE_CONSTRAINT_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return std::nullopt;
@@ -665,6 +671,8 @@ bool Decoder::SkipPropertyValue() {
     case Marker::DELTA_POINT_INDEX_DROP:
     case Marker::DELTA_TYPE_CONSTRAINT_CREATE:
     case Marker::DELTA_TYPE_CONSTRAINT_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return false;
@@ -68,14 +68,18 @@ class Encoder final : public BaseEncoder {
 
   void Sync();
 
+  void SyncWritten();
+
   void Finalize();
 
   // Disable flushing of the internal buffer.
   void DisableFlushing();
   // Enable flushing of the internal buffer.
   void EnableFlushing();
-  // Try flushing the internal buffer.
-  void TryFlushing();
+  // Try flushing the internal buffer, returns whether it was flushed.
+  bool TryFlushing();
+  // Wait until flushing of the internal buffer isn't disabled.
+  void WaitForFlushing();
   // Get the current internal buffer with its size.
   std::pair<const uint8_t *, size_t> CurrentFileBuffer() const;
 
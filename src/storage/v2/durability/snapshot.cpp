@@ -11,6 +11,7 @@
 
 #include "storage/v2/durability/snapshot.hpp"
 
+#include <algorithm>
 #include <thread>
 
 #include "flags/experimental.hpp"
@@ -41,6 +42,7 @@
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
 #include "utils/message.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
@@ -237,7 +239,8 @@ std::vector<BatchInfo> ReadBatchInfos(Decoder &snapshot) {
 
 template <typename TFunc>
 void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &edges, const uint64_t from_offset,
-                      const uint64_t edges_count, const SalientConfig::Items items, TFunc get_property_from_id) {
+                      const uint64_t edges_count, const SalientConfig::Items items, StringDictionary *string_dictionary,
+                      TFunc get_property_from_id) {
   Decoder snapshot;
   snapshot.Initialize(path, kSnapshotMagic);
 
@@ -296,7 +299,7 @@ void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &
           if (!value) throw RecoveryFailure("Couldn't read edge property value!");
           read_properties.emplace_back(get_property_from_id(*key), std::move(*value));
         }
-        props.InitProperties(std::move(read_properties));
+        props.InitProperties(std::move(read_properties), string_dictionary);
       }
     } else {
       spdlog::debug("Ensuring edge {} doesn't have any properties.", *gid);
@@ -317,8 +320,9 @@ void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &
 // Returns the gid of the last recovered vertex
 template <typename TLabelFromIdFunc, typename TPropertyFromIdFunc>
 uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<Vertex> &vertices,
-                             SchemaInfo *schema_info, const uint64_t from_offset, const uint64_t vertices_count,
-                             TLabelFromIdFunc get_label_from_id, TPropertyFromIdFunc get_property_from_id) {
+                             SchemaInfo *schema_info, StringDictionary *string_dictionary, const uint64_t from_offset,
+                             const uint64_t vertices_count, TLabelFromIdFunc get_label_from_id,
+                             TPropertyFromIdFunc get_property_from_id) {
   Decoder snapshot;
   snapshot.Initialize(path, kSnapshotMagic);
   if (!snapshot.SetPosition(from_offset))
@@ -389,7 +393,7 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<
         if (!value) throw RecoveryFailure("Couldn't read vertex property value!");
         read_properties.emplace_back(get_property_from_id(*key), std::move(*value));
       }
-      props.InitProperties(std::move(read_properties));
+      props.InitProperties(std::move(read_properties), string_dictionary);
     }
 
     // Update schema info
@@ -650,7 +654,8 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
                                         utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
                                         std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                         NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                                        SchemaInfo *schema_info, SalientConfig::Items items) {
+                                        SchemaInfo *schema_info, StringDictionary *string_dictionary,
+                                        SalientConfig::Items items) {
   RecoveryInfo ret;
   RecoveredIndicesAndConstraints indices_constraints;
 
@@ -752,7 +757,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
               if (!value) throw RecoveryFailure("Couldn't read edge property value!");
               SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for edge {}.",
                            name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
-              props.SetProperty(get_property_from_id(*key), *value);
+              props.SetProperty(get_property_from_id(*key), *value, string_dictionary);
             }
           }
         } else {
@@ -828,7 +833,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
           if (!value) throw RecoveryFailure("Couldn't read the vertex property value!");
           SPDLOG_TRACE("Recovered property \"{}\" with value \"{}\" for vertex {}.",
                        name_id_mapper->IdToName(snapshot_id_map.at(*key)), *value, *gid);
-          props.SetProperty(get_property_from_id(*key), *value);
+          props.SetProperty(get_property_from_id(*key), *value, string_dictionary);
         }
       }
 
@@ -1131,7 +1136,8 @@ RecoveredSnapshot LoadSnapshotVersion15(const std::filesystem::path &path, utils
                                         utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
                                         std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                         NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                                        SchemaInfo *schema_info, const Config &config) {
+                                        SchemaInfo *schema_info, StringDictionary *string_dictionary,
+                                        const Config &config) {
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
 
@@ -1216,9 +1222,9 @@ RecoveredSnapshot LoadSnapshotVersion15(const std::filesystem::path &path, utils
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
-          [path, edges, items = config.salient.items, &get_property_from_id](const size_t /*batch_index*/,
-                                                                             const BatchInfo &batch) {
-            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
+          [path, edges, items = config.salient.items, string_dictionary, &get_property_from_id](
+              const size_t /*batch_index*/, const BatchInfo &batch) {
+            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, string_dictionary, get_property_from_id);
           },
           edge_batches);
     }
@@ -1235,10 +1241,11 @@ RecoveredSnapshot LoadSnapshotVersion15(const std::filesystem::path &path, utils
     const auto vertex_batches = ReadBatchInfos(snapshot);
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
-        [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid](
-            const size_t batch_index, const BatchInfo &batch) {
-          const auto last_vertex_gid_in_batch = LoadPartialVertices(
-              path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id, get_property_from_id);
+        [path, vertices, schema_info, string_dictionary, &vertex_batches, &get_label_from_id, &get_property_from_id,
+         &last_vertex_gid](const size_t batch_index, const BatchInfo &batch) {
+          const auto last_vertex_gid_in_batch =
+              LoadPartialVertices(path, *vertices, schema_info, string_dictionary, batch.offset, batch.count,
+                                  get_label_from_id, get_property_from_id);
           if (batch_index == vertex_batches.size() - 1) {
             last_vertex_gid = last_vertex_gid_in_batch;
           }
@@ -1423,7 +1430,8 @@ RecoveredSnapshot LoadSnapshotVersion16(const std::filesystem::path &path, utils
                                         utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
                                         std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                         NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                                        SchemaInfo *schema_info, const Config &config) {
+                                        SchemaInfo *schema_info, StringDictionary *string_dictionary,
+                                        const Config &config) {
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
 
@@ -1508,9 +1516,9 @@ RecoveredSnapshot LoadSnapshotVersion16(const std::filesystem::path &path, utils
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
-          [path, edges, items = config.salient.items, &get_property_from_id](const size_t /*batch_index*/,
-                                                                             const BatchInfo &batch) {
-            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
+          [path, edges, items = config.salient.items, string_dictionary, &get_property_from_id](
+              const size_t /*batch_index*/, const BatchInfo &batch) {
+            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, string_dictionary, get_property_from_id);
           },
           edge_batches);
     }
@@ -1527,10 +1535,11 @@ RecoveredSnapshot LoadSnapshotVersion16(const std::filesystem::path &path, utils
     const auto vertex_batches = ReadBatchInfos(snapshot);
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
-        [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid](
-            const size_t batch_index, const BatchInfo &batch) {
-          const auto last_vertex_gid_in_batch = LoadPartialVertices(
-              path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id, get_property_from_id);
+        [path, vertices, schema_info, string_dictionary, &vertex_batches, &get_label_from_id, &get_property_from_id,
+         &last_vertex_gid](const size_t batch_index, const BatchInfo &batch) {
+          const auto last_vertex_gid_in_batch =
+              LoadPartialVertices(path, *vertices, schema_info, string_dictionary, batch.offset, batch.count,
+                                  get_label_from_id, get_property_from_id);
           if (batch_index == vertex_batches.size() - 1) {
             last_vertex_gid = last_vertex_gid_in_batch;
           }
@@ -1769,7 +1778,8 @@ RecoveredSnapshot LoadSnapshotVersion17(const std::filesystem::path &path, utils
                                         utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
                                         std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                         NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                                        SchemaInfo *schema_info, const Config &config) {
+                                        SchemaInfo *schema_info, StringDictionary *string_dictionary,
+                                        const Config &config) {
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
 
@@ -1852,9 +1862,9 @@ RecoveredSnapshot LoadSnapshotVersion17(const std::filesystem::path &path, utils
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
-          [path, edges, items = config.salient.items, &get_property_from_id](const size_t /*batch_index*/,
-                                                                             const BatchInfo &batch) {
-            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
+          [path, edges, items = config.salient.items, string_dictionary, &get_property_from_id](
+              const size_t /*batch_index*/, const BatchInfo &batch) {
+            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, string_dictionary, get_property_from_id);
           },
           edge_batches);
     }
@@ -1871,10 +1881,11 @@ RecoveredSnapshot LoadSnapshotVersion17(const std::filesystem::path &path, utils
     const auto vertex_batches = ReadBatchInfos(snapshot);
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
-        [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid](
-            const size_t batch_index, const BatchInfo &batch) {
-          const auto last_vertex_gid_in_batch = LoadPartialVertices(
-              path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id, get_property_from_id);
+        [path, vertices, schema_info, string_dictionary, &vertex_batches, &get_label_from_id, &get_property_from_id,
+         &last_vertex_gid](const size_t batch_index, const BatchInfo &batch) {
+          const auto last_vertex_gid_in_batch =
+              LoadPartialVertices(path, *vertices, schema_info, string_dictionary, batch.offset, batch.count,
+                                  get_label_from_id, get_property_from_id);
           if (batch_index == vertex_batches.size() - 1) {
             last_vertex_gid = last_vertex_gid_in_batch;
           }
@@ -2156,8 +2167,8 @@ RecoveredSnapshot LoadSnapshotVersion18or19(const std::filesystem::path &path, u
                                             utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
                                             std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                             NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                                            SchemaInfo *schema_info, const Config &config,
-                                            memgraph::storage::EnumStore *enum_store) {
+                                            SchemaInfo *schema_info, StringDictionary *string_dictionary,
+                                            const Config &config, memgraph::storage::EnumStore *enum_store) {
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
 
@@ -2279,9 +2290,9 @@ RecoveredSnapshot LoadSnapshotVersion18or19(const std::filesystem::path &path, u
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
-          [path, edges, items = config.salient.items, &get_property_from_id](const size_t /*batch_index*/,
-                                                                             const BatchInfo &batch) {
-            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
+          [path, edges, items = config.salient.items, string_dictionary, &get_property_from_id](
+              const size_t /*batch_index*/, const BatchInfo &batch) {
+            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, string_dictionary, get_property_from_id);
           },
           edge_batches);
     }
@@ -2298,10 +2309,11 @@ RecoveredSnapshot LoadSnapshotVersion18or19(const std::filesystem::path &path, u
     const auto vertex_batches = ReadBatchInfos(snapshot);
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
-        [path, vertices, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid, schema_info](
-            const size_t batch_index, const BatchInfo &batch) {
-          const auto last_vertex_gid_in_batch = LoadPartialVertices(
-              path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id, get_property_from_id);
+        [path, vertices, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid, schema_info,
+         string_dictionary](const size_t batch_index, const BatchInfo &batch) {
+          const auto last_vertex_gid_in_batch =
+              LoadPartialVertices(path, *vertices, schema_info, string_dictionary, batch.offset, batch.count,
+                                  get_label_from_id, get_property_from_id);
           if (batch_index == vertex_batches.size() - 1) {
             last_vertex_gid = last_vertex_gid_in_batch;
           }
@@ -2600,7 +2612,8 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
                                utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, const Config &config,
-                               memgraph::storage::EnumStore *enum_store, SchemaInfo *schema_info) {
+                               memgraph::storage::EnumStore *enum_store, SchemaInfo *schema_info,
+                               StringDictionary *string_dictionary) {
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
 
@@ -2611,23 +2624,23 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   if (!IsVersionSupported(*version)) throw RecoveryFailure(fmt::format("Invalid snapshot version {}", *version));
   if (*version == 14U) {
     return LoadSnapshotVersion14(path, vertices, edges, edges_metadata, epoch_history, name_id_mapper, edge_count,
-                                 schema_info, config.salient.items);
+                                 schema_info, string_dictionary, config.salient.items);
   }
   if (*version == 15U) {
     return LoadSnapshotVersion15(path, vertices, edges, edges_metadata, epoch_history, name_id_mapper, edge_count,
-                                 schema_info, config);
+                                 schema_info, string_dictionary, config);
   }
   if (*version == 16U) {
     return LoadSnapshotVersion16(path, vertices, edges, edges_metadata, epoch_history, name_id_mapper, edge_count,
-                                 schema_info, config);
+                                 schema_info, string_dictionary, config);
   }
   if (*version == 17U) {
     return LoadSnapshotVersion17(path, vertices, edges, edges_metadata, epoch_history, name_id_mapper, edge_count,
-                                 schema_info, config);
+                                 schema_info, string_dictionary, config);
   }
   if (*version == 18U || *version == 19U) {
     return LoadSnapshotVersion18or19(path, vertices, edges, edges_metadata, epoch_history, name_id_mapper, edge_count,
-                                     schema_info, config, enum_store);
+                                     schema_info, string_dictionary, config, enum_store);
   }
 
   // Cleanup of loaded data in case of failure.
@@ -2743,9 +2756,9 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
-          [path, edges, items = config.salient.items, &get_property_from_id](const size_t /*batch_index*/,
-                                                                             const BatchInfo &batch) {
-            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
+          [path, edges, items = config.salient.items, string_dictionary, &get_property_from_id](
+              const size_t /*batch_index*/, const BatchInfo &batch) {
+            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, string_dictionary, get_property_from_id);
           },
           edge_batches);
     }
@@ -2762,10 +2775,11 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
     const auto vertex_batches = ReadBatchInfos(snapshot);
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
-        [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid](
-            const size_t batch_index, const BatchInfo &batch) {
-          const auto last_vertex_gid_in_batch = LoadPartialVertices(
-              path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id, get_property_from_id);
+        [path, vertices, schema_info, string_dictionary, &vertex_batches, &get_label_from_id, &get_property_from_id,
+         &last_vertex_gid](const size_t batch_index, const BatchInfo &batch) {
+          const auto last_vertex_gid_in_batch =
+              LoadPartialVertices(path, *vertices, schema_info, string_dictionary, batch.offset, batch.count,
+                                  get_label_from_id, get_property_from_id);
           if (batch_index == vertex_batches.size() - 1) {
             last_vertex_gid = last_vertex_gid_in_batch;
           }
@@ -2965,6 +2979,32 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       spdlog::info("Metadata of point indices are recovered.");
     }
 
+    // Recover composite label+property indices.
+    if (*version >= kCompositeIndicesVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Couldn't recover the number of composite label+property indices!");
+      spdlog::info("Recovering metadata of {} composite label+property indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Couldn't read label for composite label+property index!");
+        auto properties_count = snapshot.ReadUint();
+        if (!properties_count) throw RecoveryFailure("Couldn't read properties for composite label+property index!");
+        std::vector<PropertyId> properties;
+        properties.reserve(*properties_count);
+        for (uint64_t j = 0; j < *properties_count; ++j) {
+          auto property = snapshot.ReadUint();
+          if (!property) throw RecoveryFailure("Couldn't read property for composite label+property index!");
+          properties.emplace_back(get_property_from_id(*property));
+        }
+        AddRecoveredIndexConstraint(&indices_constraints.indices.label_property_composite,
+                                    {get_label_from_id(*label), std::move(properties)},
+                                    "The composite label+property index already exists!");
+        SPDLOG_TRACE("Recovered metadata of composite label+property index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)));
+      }
+      spdlog::info("Metadata of composite label+property indices are recovered.");
+    }
+
     // Recover text indices.
     // NOTE: while this is experimental and hence optional
     //       it must be last in the SECTION_INDICES
@@ -3202,6 +3242,106 @@ auto EnsureRetentionCountSnapshotsExist(const std::filesystem::path &snapshot_di
   return old_snapshot_files;
 }
 
+namespace {
+constexpr uint64_t kSnapshotSegmentCopyBufferSize = 1024UL * 1024UL;
+
+/// Objects of the edges or vertices section of a snapshot, or of a part of it.
+struct SnapshotSegment {
+  uint64_t count{0};
+  std::vector<BatchInfo> batches;
+  std::unordered_set<uint64_t> used_ids;
+};
+
+template <typename TIterator, typename TFunc>
+void EncodeSnapshotSegment(Encoder &encoder, TIterator first, TIterator last, uint64_t items_per_batch,
+                           SnapshotSegment &segment, const TFunc &encode_object) {
+  uint64_t items_in_current_batch = 0;
+  auto batch_start_offset = encoder.GetPosition();
+  for (; first != last; ++first) {
+    if (!encode_object(encoder, *first, segment.used_ids)) continue;
+    ++segment.count;
+    ++items_in_current_batch;
+    if (items_in_current_batch == items_per_batch) {
+      segment.batches.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+      batch_start_offset = encoder.GetPosition();
+      items_in_current_batch = 0;
+    }
+  }
+  if (items_in_current_batch > 0) {
+    segment.batches.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+  }
+}
+
+/// Encodes all objects with `encode_object` and appends them to the snapshot.
+/// Big sections are split into up to `thread_count` parts which are encoded
+/// in parallel into temporary segment files and then copied into the snapshot
+/// in order, so the result is the same as if it was encoded on one thread.
+template <typename TObject, typename TFunc>
+void EncodeSnapshotSection(Encoder &snapshot, const std::filesystem::path &path, utils::SkipList<TObject> *objects,
+                           uint64_t thread_count, uint64_t items_per_batch, SnapshotSegment &section,
+                           const TFunc &encode_object) {
+  auto acc = objects->access();
+  const auto num_segments = std::clamp<uint64_t>(acc.size() / std::max<uint64_t>(items_per_batch, 1), 1, thread_count);
+  auto split_points = acc.split_points(num_segments);
+  if (split_points.empty()) {
+    EncodeSnapshotSegment(snapshot, acc.begin(), acc.end(), items_per_batch, section, encode_object);
+    return;
+  }
+
+  std::vector<SnapshotSegment> segments(split_points.size() + 1);
+  // Segments are kept out of the snapshot directory, so they are never taken
+  // for snapshots.
+  const auto segment_directory = path.parent_path() / kSnapshotSegmentsDirectory;
+  utils::EnsureDirOrDie(segment_directory);
+  std::vector<std::filesystem::path> segment_paths;
+  segment_paths.reserve(segments.size());
+  for (size_t i = 0; i < segments.size(); ++i) {
+    segment_paths.emplace_back(segment_directory / fmt::format("{}_{}", path.filename().string(), i));
+  }
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(segments.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+      threads.emplace_back([&, i] {
+        auto first = i == 0 ? acc.begin() : split_points[i - 1];
+        auto last = i == split_points.size() ? acc.end() : split_points[i];
+        Encoder segment;
+        segment.Initialize(segment_paths[i], kSnapshotMagic, kVersion);
+        EncodeSnapshotSegment(segment, first, last, items_per_batch, segments[i], encode_object);
+        segment.Close();
+      });
+    }
+  }
+
+  // Batch offsets are relative to the segment files, move them to where the
+  // segments end up in the snapshot.
+  std::vector<uint8_t> buffer(kSnapshotSegmentCopyBufferSize);
+  for (size_t i = 0; i < segments.size(); ++i) {
+    {
+      Decoder segment;
+      MG_ASSERT(segment.Initialize(segment_paths[i], kSnapshotMagic), "Couldn't read snapshot segment file {}!",
+                segment_paths[i]);
+      const auto header_size = *segment.GetPosition();
+      const auto segment_offset = snapshot.GetPosition();
+      for (const auto &batch : segments[i].batches) {
+        section.batches.push_back(BatchInfo{segment_offset + batch.offset - header_size, batch.count});
+      }
+      auto remaining = *segment.GetSize() - header_size;
+      while (remaining > 0) {
+        const auto to_copy = std::min<uint64_t>(remaining, buffer.size());
+        MG_ASSERT(segment.Read(buffer.data(), to_copy), "Couldn't read snapshot segment file {}!", segment_paths[i]);
+        snapshot.Write(buffer.data(), to_copy);
+        remaining -= to_copy;
+      }
+    }
+    section.count += segments[i].count;
+    section.used_ids.merge(segments[i].used_ids);
+    utils::DeleteFile(segment_paths[i]);
+  }
+  utils::DeleteDir(segment_directory);
+}
+}  // namespace
+
 void CreateSnapshot(Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices,
                     utils::SkipList<Edge> *edges, utils::UUID const &uuid,
@@ -3252,10 +3392,6 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     write_offsets();
   }
 
-  // Object counters.
-  uint64_t edges_count = 0;
-  uint64_t vertices_count = 0;
-
   // Mapper data.
   std::unordered_set<uint64_t> used_ids;
   auto write_mapping = [&snapshot, &used_ids](auto mapping) {
@@ -3263,168 +3399,159 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     snapshot.WriteUint(mapping.AsUint());
   };
 
-  std::vector<BatchInfo> edge_batch_infos;
-  auto items_in_current_batch{0UL};
-  auto batch_start_offset{0UL};
+  const auto thread_count = storage->config_.durability.snapshot_thread_count;
+  const auto items_per_batch = storage->config_.durability.items_per_batch;
+  // Objects may be encoded on multiple threads, all reading through the same
+  // transaction.
+  const bool concurrent_readers = std::exchange(transaction->concurrent_readers, thread_count > 1);
+  utils::OnScopeExit restore_concurrent_readers{
+      [transaction, concurrent_readers] { transaction->concurrent_readers = concurrent_readers; }};
+
   // Store all edges.
+  SnapshotSegment edges_section;
   if (storage->config_.salient.items.properties_on_edges) {
     offset_edges = snapshot.GetPosition();
-    batch_start_offset = offset_edges;
-    auto acc = edges->access();
-    for (auto &edge : acc) {
-      // The edge visibility check must be done here manually because we don't
-      // allow direct access to the edges through the public API.
-      bool is_visible = true;
-      Delta *delta = nullptr;
-      {
-        auto guard = std::shared_lock{edge.lock};
-        is_visible = !edge.deleted;
-        delta = edge.delta;
-      }
-      ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
-        switch (delta.action) {
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            break;
-          case Delta::Action::RECREATE_OBJECT: {
-            is_visible = true;
-            break;
+    EncodeSnapshotSection(
+        snapshot, path, edges, thread_count, items_per_batch, edges_section,
+        [storage, transaction](Encoder &encoder, Edge &edge, std::unordered_set<uint64_t> &segment_used_ids) {
+          // The edge visibility check must be done here manually because we don't
+          // allow direct access to the edges through the public API.
+          bool is_visible = true;
+          Delta *delta = nullptr;
+          {
+            auto guard = std::shared_lock{edge.lock};
+            is_visible = !edge.deleted;
+            delta = edge.delta;
           }
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT: {
-            is_visible = false;
-            break;
+          ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
+            switch (delta.action) {
+              case Delta::Action::ADD_LABEL:
+              case Delta::Action::REMOVE_LABEL:
+              case Delta::Action::SET_PROPERTY:
+              case Delta::Action::ADD_IN_EDGE:
+              case Delta::Action::ADD_OUT_EDGE:
+              case Delta::Action::REMOVE_IN_EDGE:
+              case Delta::Action::REMOVE_OUT_EDGE:
+                break;
+              case Delta::Action::RECREATE_OBJECT: {
+                is_visible = true;
+                break;
+              }
+              case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+              case Delta::Action::DELETE_OBJECT: {
+                is_visible = false;
+                break;
+              }
+            }
+          });
+          if (!is_visible) return false;
+          EdgeRef edge_ref(&edge);
+          // Here we create an edge accessor that we will use to get the
+          // properties of the edge. The accessor is created with an invalid
+          // type and invalid from/to pointers because we don't know them here,
+          // but that isn't an issue because we won't use that part of the API
+          // here.
+          auto ea = EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, storage, transaction};
+
+          // Get edge data.
+          auto maybe_props = ea.Properties(View::OLD);
+          MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+
+          // Store the edge.
+          encoder.WriteMarker(Marker::SECTION_EDGE);
+          encoder.WriteUint(edge.gid.AsUint());
+          const auto &props = maybe_props.GetValue();
+          encoder.WriteUint(props.size());
+          for (const auto &item : props) {
+            segment_used_ids.insert(item.first.AsUint());
+            encoder.WriteUint(item.first.AsUint());
+            encoder.WritePropertyValue(item.second);
           }
-        }
-      });
-      if (!is_visible) continue;
-      EdgeRef edge_ref(&edge);
-      // Here we create an edge accessor that we will use to get the
-      // properties of the edge. The accessor is created with an invalid
-      // type and invalid from/to pointers because we don't know them here,
-      // but that isn't an issue because we won't use that part of the API
-      // here.
-      auto ea = EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, storage, transaction};
-
-      // Get edge data.
-      auto maybe_props = ea.Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-
-      // Store the edge.
-      {
-        snapshot.WriteMarker(Marker::SECTION_EDGE);
-        snapshot.WriteUint(edge.gid.AsUint());
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-      }
-
-      ++edges_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == storage->config_.durability.items_per_batch) {
-        edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
-    }
-  }
-
-  if (items_in_current_batch > 0) {
-    edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+          return true;
+        });
   }
 
-  std::vector<BatchInfo> vertex_batch_infos;
   // Store all vertices.
-  {
-    items_in_current_batch = 0;
-    offset_vertices = snapshot.GetPosition();
-    batch_start_offset = offset_vertices;
-    auto acc = vertices->access();
-    for (auto &vertex : acc) {
-      // The visibility check is implemented for vertices so we use it here.
-      auto va = VertexAccessor::Create(&vertex, storage, transaction, View::OLD);
-      if (!va) continue;
-
-      // Get vertex data.
-      // TODO (mferencevic): All of these functions could be written into a
-      // single function so that we traverse the undo deltas only once.
-      auto maybe_labels = va->Labels(View::OLD);
-      MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
-      auto maybe_props = va->Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-      auto maybe_in_edges = va->InEdges(View::OLD);
-      MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
-      auto maybe_out_edges = va->OutEdges(View::OLD);
-      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
-
-      // Store the vertex.
-      {
-        snapshot.WriteMarker(Marker::SECTION_VERTEX);
-        snapshot.WriteUint(vertex.gid.AsUint());
+  SnapshotSegment vertices_section;
+  offset_vertices = snapshot.GetPosition();
+  EncodeSnapshotSection(
+      snapshot, path, vertices, thread_count, items_per_batch, vertices_section,
+      [storage, transaction](Encoder &encoder, Vertex &vertex, std::unordered_set<uint64_t> &segment_used_ids) {
+        auto write_mapping = [&encoder, &segment_used_ids](auto mapping) {
+          segment_used_ids.insert(mapping.AsUint());
+          encoder.WriteUint(mapping.AsUint());
+        };
+
+        // The visibility check is implemented for vertices so we use it here.
+        auto va = VertexAccessor::Create(&vertex, storage, transaction, View::OLD);
+        if (!va) return false;
+
+        // Get vertex data.
+        // TODO (mferencevic): All of these functions could be written into a
+        // single function so that we traverse the undo deltas only once.
+        auto maybe_labels = va->Labels(View::OLD);
+        MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+        auto maybe_props = va->Properties(View::OLD);
+        MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+        auto maybe_in_edges = va->InEdges(View::OLD);
+        MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
+        auto maybe_out_edges = va->OutEdges(View::OLD);
+        MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+
+        // Store the vertex.
+        encoder.WriteMarker(Marker::SECTION_VERTEX);
+        encoder.WriteUint(vertex.gid.AsUint());
         const auto &labels = maybe_labels.GetValue();
-        snapshot.WriteUint(labels.size());
+        encoder.WriteUint(labels.size());
         for (const auto &item : labels) {
           write_mapping(item);
         }
         const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
+        encoder.WriteUint(props.size());
         for (const auto &item : props) {
           write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
+          encoder.WritePropertyValue(item.second);
         }
         const auto &in_edges = maybe_in_edges.GetValue().edges;
         const auto &out_edges = maybe_out_edges.GetValue().edges;
 
         if (storage->config_.salient.items.properties_on_edges) {
-          snapshot.WriteUint(in_edges.size());
+          encoder.WriteUint(in_edges.size());
           for (const auto &item : in_edges) {
-            snapshot.WriteUint(item.GidPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.FromVertex().Gid().AsUint());
+            encoder.WriteUint(item.GidPropertiesOnEdges().AsUint());
+            encoder.WriteUint(item.FromVertex().Gid().AsUint());
             write_mapping(item.EdgeType());
           }
-          snapshot.WriteUint(out_edges.size());
+          encoder.WriteUint(out_edges.size());
           for (const auto &item : out_edges) {
-            snapshot.WriteUint(item.GidPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.ToVertex().Gid().AsUint());
+            encoder.WriteUint(item.GidPropertiesOnEdges().AsUint());
+            encoder.WriteUint(item.ToVertex().Gid().AsUint());
             write_mapping(item.EdgeType());
           }
         } else {
-          snapshot.WriteUint(in_edges.size());
+          encoder.WriteUint(in_edges.size());
           for (const auto &item : in_edges) {
-            snapshot.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.FromVertex().Gid().AsUint());
+            encoder.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
+            encoder.WriteUint(item.FromVertex().Gid().AsUint());
             write_mapping(item.EdgeType());
           }
-          snapshot.WriteUint(out_edges.size());
+          encoder.WriteUint(out_edges.size());
           for (const auto &item : out_edges) {
-            snapshot.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.ToVertex().Gid().AsUint());
+            encoder.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
+            encoder.WriteUint(item.ToVertex().Gid().AsUint());
             write_mapping(item.EdgeType());
           }
         }
-      }
-
-      ++vertices_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == storage->config_.durability.items_per_batch) {
-        vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
-    }
+        return true;
+      });
 
-    if (items_in_current_batch > 0) {
-      vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-    }
-  }
+  // Object counters.
+  const uint64_t edges_count = edges_section.count;
+  const uint64_t vertices_count = vertices_section.count;
+  const auto &edge_batch_infos = edges_section.batches;
+  const auto &vertex_batch_infos = vertices_section.batches;
+  used_ids.merge(edges_section.used_ids);
+  used_ids.merge(vertices_section.used_ids);
 
   // Write indices.
   {
@@ -3535,6 +3662,21 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
       }
     }
 
+    // Write composite label+property indices.
+    {
+      auto *mem_label_property_index =
+          static_cast<InMemoryLabelPropertyIndex *>(storage->indices_.label_property_index_.get());
+      auto composite = mem_label_property_index->ListCompositeIndices();
+      snapshot.WriteUint(composite.size());
+      for (const auto &[label, properties] : composite) {
+        write_mapping(label);
+        snapshot.WriteUint(properties.size());
+        for (const auto &property : properties) {
+          write_mapping(property);
+        }
+      }
+    }
+
     // Write text indices.
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
       auto text_indices = storage->indices_.text_index_.ListIndices();
@@ -112,6 +112,8 @@ constexpr Marker OperationToMarker(StorageMetadataOperation operation) {
     add_case(TYPE_CONSTRAINT_DROP);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_DROP);
   }
 #undef add_case
 }
@@ -184,6 +186,8 @@ constexpr WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
     add_case(VERTEX_SET_PROPERTY);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_DROP);
 
     case Marker::TYPE_NULL:
     case Marker::TYPE_BOOL:
@@ -403,6 +407,29 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
       }
       break;
     }
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto label = decoder->ReadString();
+        if (!label) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_property_list.label = std::move(*label);
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          auto property = decoder->ReadString();
+          if (!property) throw RecoveryFailure("Invalid WAL data!");
+          delta.operation_label_property_list.properties.emplace_back(std::move(*property));
+        }
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        }
+      }
+      break;
+    }
     case WalDeltaData::Type::TYPE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::TYPE_CONSTRAINT_DROP: {
       if constexpr (read_data) {
@@ -664,6 +691,10 @@ bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
       return a.operation_label_properties.label == b.operation_label_properties.label &&
              a.operation_label_properties.properties == b.operation_label_properties.properties;
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return a.operation_label_property_list.label == b.operation_label_property_list.label &&
+             a.operation_label_property_list.properties == b.operation_label_property_list.properties;
     case WalDeltaData::Type::TYPE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::TYPE_CONSTRAINT_DROP:
       return a.operation_label_property_type.label == b.operation_label_property_type.label &&
@@ -822,6 +853,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
                      const std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
                      SalientConfig::Items items, EnumStore *enum_store, SchemaInfo *schema_info,
+                     StringDictionary *string_dictionary,
                      std::function<std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>(Gid)> find_edge) {
   spdlog::info("Trying to load WAL file {}.", path);
   RecoveryInfo ret;
@@ -911,7 +943,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
             schema_info->SetProperty(&*vertex, property_id, ExtendedPropertyType{property_value}, old_type);
           }
 
-          vertex->properties.SetProperty(property_id, property_value);
+          vertex->properties.SetProperty(property_id, property_value, string_dictionary);
           break;
         }
         case WalDeltaData::Type::EDGE_CREATE: {
@@ -1008,7 +1040,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
                                      items.properties_on_edges);
           }
 
-          edge->properties.SetProperty(property_id, property_value);
+          edge->properties.SetProperty(property_id, property_value, string_dictionary);
           break;
         }
         case WalDeltaData::Type::TRANSACTION_END: {
@@ -1084,6 +1116,28 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
                                          "The label property index doesn't exist!");
           break;
         }
+        case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_list.label));
+          std::vector<PropertyId> property_ids;
+          for (const auto &prop : delta.operation_label_property_list.properties) {
+            property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+          }
+          AddRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                      {label_id, std::move(property_ids)},
+                                      "The composite label property index already exists!");
+          break;
+        }
+        case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_list.label));
+          std::vector<PropertyId> property_ids;
+          for (const auto &prop : delta.operation_label_property_list.properties) {
+            property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+          }
+          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                         {label_id, std::move(property_ids)},
+                                         "The composite label property index doesn't exist!");
+          break;
+        }
         case WalDeltaData::Type::POINT_INDEX_CREATE: {
           auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
           auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
@@ -1343,6 +1397,8 @@ void WalFile::AppendTransactionEnd(uint64_t timestamp) {
 
 void WalFile::Sync() { wal_.Sync(); }
 
+void WalFile::SyncWritten() { wal_.SyncWritten(); }
+
 uint64_t WalFile::GetSize() { return wal_.GetSize(); }
 
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
@@ -1357,7 +1413,9 @@ void WalFile::DisableFlushing() { wal_.DisableFlushing(); }
 
 void WalFile::EnableFlushing() { wal_.EnableFlushing(); }
 
-void WalFile::TryFlushing() { wal_.TryFlushing(); }
+bool WalFile::TryFlushing() { return wal_.TryFlushing(); }
+
+void WalFile::WaitForFlushing() { wal_.WaitForFlushing(); }
 
 std::pair<const uint8_t *, size_t> WalFile::CurrentFileBuffer() const { return wal_.CurrentFileBuffer(); }
 
@@ -1433,6 +1491,15 @@ void EncodeLabelProperties(BaseEncoder &encoder, NameIdMapper &name_id_mapper, L
   }
 }
 
+void EncodeLabelPropertyList(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label,
+                             std::vector<PropertyId> const &properties) {
+  encoder.WriteString(name_id_mapper.IdToName(label.AsUint()));
+  encoder.WriteUint(properties.size());
+  for (const auto &property : properties) {
+    encoder.WriteString(name_id_mapper.IdToName(property.AsUint()));
+  }
+}
+
 void EncodeTypeConstraint(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label, PropertyId property,
                           TypeConstraintKind type) {
   encoder.WriteString(name_id_mapper.IdToName(label.AsUint()));
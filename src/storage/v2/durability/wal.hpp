@@ -29,6 +29,7 @@
 #include "storage/v2/name_id_mapper.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/schema_info.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/vertex.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/skip_list.hpp"
@@ -85,6 +86,8 @@ struct WalDeltaData {
     ENUM_ALTER_UPDATE,
     POINT_INDEX_CREATE,
     POINT_INDEX_DROP,
+    LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
   };
 
   Type type{Type::TRANSACTION_END};
@@ -126,6 +129,11 @@ struct WalDeltaData {
     std::set<std::string, std::less<>> properties;
   } operation_label_properties;
 
+  struct {
+    std::string label;
+    std::vector<std::string> properties;
+  } operation_label_property_list;
+
   struct {
     std::string label;
     std::string property;
@@ -222,6 +230,8 @@ constexpr bool IsWalDeltaDataTypeTransactionEndVersion15(const WalDeltaData::Typ
     case WalDeltaData::Type::POINT_INDEX_DROP:
     case WalDeltaData::Type::TYPE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::TYPE_CONSTRAINT_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
       return true;  // TODO: Still true?
       break;
   }
@@ -278,6 +288,8 @@ void EncodeEnumCreate(BaseEncoder &encoder, EnumStore const &enum_store, EnumTyp
 void EncodeLabel(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label);
 void EncodeLabelProperties(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label,
                            std::set<PropertyId> const &properties);
+void EncodeLabelPropertyList(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label,
+                             std::vector<PropertyId> const &properties);
 void EncodeTypeConstraint(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label, PropertyId property,
                           TypeConstraintKind type);
 void EncodeLabelProperty(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label, PropertyId prop);
@@ -295,6 +307,7 @@ RecoveryInfo LoadWal(std::filesystem::path const &path, RecoveredIndicesAndConst
                      std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
                      SalientConfig::Items items, EnumStore *enum_store, SchemaInfo *schema_info,
+                     StringDictionary *string_dictionary,
                      std::function<std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>(Gid)> find_edge);
 
 /// WalFile class used to append deltas and operations to the WAL file.
@@ -328,6 +341,10 @@ class WalFile {
 
   void Sync();
 
+  // Sync the data already written to the file. Safe to call while the file is
+  // appended to from another thread.
+  void SyncWritten();
+
   uint64_t GetSize();
 
   uint64_t SequenceNumber() const;
@@ -342,8 +359,10 @@ class WalFile {
   void DisableFlushing();
   // Enable flushing of the internal buffer.
   void EnableFlushing();
-  // Try flushing the internal buffer.
-  void TryFlushing();
+  // Try flushing the internal buffer, returns whether it was flushed.
+  bool TryFlushing();
+  // Wait until flushing of the internal buffer isn't disabled.
+  void WaitForFlushing();
   // Get the internal buffer with its size.
   std::pair<const uint8_t *, size_t> CurrentFileBuffer() const;
 
@@ -214,7 +214,7 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
     // "modify in-place". Additionally, the created delta will make other
     // transactions get a SERIALIZATION_ERROR.
     CreateAndLinkDelta(transaction, edge.ptr, Delta::SetPropertyTag(), from_vertex_, property, *current_value);
-    edge.ptr->properties.SetProperty(property, value);
+    edge.ptr->properties.SetProperty(property, value, storage_->string_dictionary_.get());
     storage_->indices_.UpdateOnSetProperty(edge_type_, property, value, from_vertex_, to_vertex_, edge_.ptr,
                                            *transaction_);
     if (schema_acc)
@@ -242,7 +242,7 @@ Result<bool> EdgeAccessor::InitProperties(const std::map<storage::PropertyId, st
 
   if (edge_.ptr->deleted) return Error::DELETED_OBJECT;
 
-  if (!edge_.ptr->properties.InitProperties(properties)) return false;
+  if (!edge_.ptr->properties.InitProperties(properties, storage_->string_dictionary_.get())) return false;
   utils::AtomicMemoryBlock([this, &properties, transaction_ = transaction_, edge_ = edge_, &schema_acc]() {
     for (const auto &[property, value] : properties) {
       CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), from_vertex_, property, PropertyValue());
@@ -275,7 +275,7 @@ Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> EdgeAc
   using ReturnType = decltype(edge_.ptr->properties.UpdateProperties(properties));
   std::optional<ReturnType> id_old_new_change;
   utils::AtomicMemoryBlock([this, &properties, &id_old_new_change, skip_duplicate_write, &schema_acc]() {
-    id_old_new_change.emplace(edge_.ptr->properties.UpdateProperties(properties));
+    id_old_new_change.emplace(edge_.ptr->properties.UpdateProperties(properties, storage_->string_dictionary_.get()));
     for (auto const &[property, old_value, new_value] : *id_old_new_change) {
       if (skip_duplicate_write && old_value == new_value) continue;
       CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), from_vertex_, property, old_value);
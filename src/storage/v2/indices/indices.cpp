@@ -51,19 +51,6 @@ void Indices::AbortEntries(std::pair<EdgeTypeId, PropertyId> edge_type_property,
       ->AbortEntries(edge_type_property, edges, exact_start_timestamp);
 }
 
-void Indices::RemoveObsoleteVertexEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const {
-  static_cast<InMemoryLabelIndex *>(label_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-}
-
-void Indices::RemoveObsoleteEdgeEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const {
-  static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-  static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())
-      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
-}
-
 void Indices::DropGraphClearIndices() {
   static_cast<InMemoryLabelIndex *>(label_index_.get())->DropGraphClearIndices();
   static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())->DropGraphClearIndices();
@@ -102,7 +89,8 @@ Indices::Indices(const Config &config, StorageMode storage_mode) {
   std::invoke([this, config, storage_mode]() {
     if (storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL || storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
       label_index_ = std::make_unique<InMemoryLabelIndex>();
-      label_property_index_ = std::make_unique<InMemoryLabelPropertyIndex>();
+      label_property_index_ =
+          std::make_unique<InMemoryLabelPropertyIndex>(config.salient.items.label_property_index_hash_lookups);
       edge_type_index_ = std::make_unique<InMemoryEdgeTypeIndex>();
       edge_type_property_index_ = std::make_unique<InMemoryEdgeTypePropertyIndex>();
     } else {
@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <span>
 #include <thread>
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
@@ -172,6 +173,78 @@ inline bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, Prop
       });
 }
 
+/// Helper function for composite label-property index garbage collection.
+/// Returns true if there's a reachable version of the vertex that has the given
+/// label and the given values of all `keys`.
+inline bool AnyVersionHasLabelProperties(const Vertex &vertex, LabelId label, std::span<PropertyId const> keys,
+                                         std::span<PropertyValue const> values, uint64_t timestamp) {
+  Delta const *delta;
+  bool deleted;
+  bool has_label;
+  std::vector<bool> current_values_equal_to_values(keys.size());
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    delta = vertex.delta;
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    if (delta == nullptr && (deleted || !has_label)) return false;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      current_values_equal_to_values[i] = vertex.properties.IsPropertyEqual(keys[i], values[i]);
+    }
+  }
+
+  auto all_equal = [&current_values_equal_to_values] {
+    return std::ranges::all_of(current_values_equal_to_values, [](bool equal) { return equal; });
+  };
+  if (!deleted && has_label && all_equal()) {
+    return true;
+  }
+
+  constexpr auto interesting = ActionSet<Delta::Action::ADD_LABEL, Delta::Action::REMOVE_LABEL,
+                                         Delta::Action::SET_PROPERTY, Delta::Action::RECREATE_OBJECT,
+                                         Delta::Action::DELETE_DESERIALIZED_OBJECT, Delta::Action::DELETE_OBJECT>{};
+  return AnyVersionSatisfiesPredicate<interesting>(timestamp, delta, [&, label](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+        if (delta.label.value == label) {
+          MG_ASSERT(!has_label, "Invalid database state!");
+          has_label = true;
+        }
+        break;
+      case Delta::Action::REMOVE_LABEL:
+        if (delta.label.value == label) {
+          MG_ASSERT(has_label, "Invalid database state!");
+          has_label = false;
+        }
+        break;
+      case Delta::Action::SET_PROPERTY:
+        for (size_t i = 0; i < keys.size(); ++i) {
+          if (delta.property.key == keys[i]) {
+            current_values_equal_to_values[i] = *delta.property.value == values[i];
+          }
+        }
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        MG_ASSERT(deleted, "Invalid database state!");
+        deleted = false;
+        break;
+      }
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT: {
+        MG_ASSERT(!deleted, "Invalid database state!");
+        deleted = true;
+        break;
+      }
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+    return !deleted && has_label && all_equal();
+  });
+}
+
 inline bool AnyVersionHasLabelProperty(const Edge &edge, PropertyId key, const PropertyValue &value,
                                        uint64_t timestamp) {
   Delta const *delta;
@@ -246,7 +319,7 @@ inline bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label,
   if (delta && transaction->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction->manyDeltasCache;
       if (auto resError = HasError(view, cache, &vertex, false); resError) return false;
@@ -282,6 +355,44 @@ inline bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label,
   return exists && !deleted && has_label && current_value_equal_to_value;
 }
 
+// Helper function for iterating through composite label-property index.
+// Returns true if this transaction can see the given vertex, and the visible
+// version has the given label and the given values of all `keys`.
+inline bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, std::span<PropertyId const> keys,
+                                             std::span<PropertyValue const> values, Transaction *transaction,
+                                             View view) {
+  bool exists = true;
+  bool deleted = false;
+  bool has_label = false;
+  std::vector<bool> current_values_equal_to_values(keys.size());
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    for (size_t i = 0; i < keys.size(); ++i) {
+      current_values_equal_to_values[i] = vertex.properties.IsPropertyEqual(keys[i], values[i]);
+    }
+    delta = vertex.delta;
+  }
+
+  if (delta && transaction->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+    ApplyDeltasForRead(transaction, delta, view, [&, label](const Delta &delta) {
+      // clang-format off
+      DeltaDispatch(delta, utils::ChainedOverloaded{
+        Deleted_ActionMethod(deleted),
+        Exists_ActionMethod(exists),
+        HasLabel_ActionMethod(has_label, label),
+        PropertyValuesMatch_ActionMethod(current_values_equal_to_values, keys, values)
+      });
+      // clang-format on
+    });
+  }
+
+  return exists && !deleted && has_label &&
+         std::ranges::all_of(current_values_equal_to_values, [](bool equal) { return equal; });
+}
+
 // Helper function for iterating through label-property index. Returns true if
 // this transaction can see the given vertex, and the visible version has the
 // given label and property.
@@ -337,6 +448,33 @@ inline void TryInsertLabelPropertyIndex(Vertex &vertex, std::pair<LabelId, Prope
   index_accessor.insert({std::move(value), &vertex, 0});
 }
 
+/// Returns the key of the vertex in a composite label-property index, which is
+/// the list of the values of `properties` in their order, or `std::nullopt` if
+/// any of the properties isn't set.
+inline std::optional<PropertyValue> CompositeIndexKey(const Vertex &vertex, std::span<PropertyId const> properties) {
+  PropertyValue::list_t values;
+  values.reserve(properties.size());
+  for (auto property : properties) {
+    auto value = vertex.properties.GetProperty(property);
+    if (value.IsNull()) return std::nullopt;
+    values.emplace_back(std::move(value));
+  }
+  return PropertyValue(std::move(values));
+}
+
+template <typename TIndexAccessor>
+inline void TryInsertLabelPropertiesIndex(Vertex &vertex, LabelId label, std::span<PropertyId const> properties,
+                                          TIndexAccessor &index_accessor) {
+  if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
+    return;
+  }
+  auto key = CompositeIndexKey(vertex, properties);
+  if (!key) {
+    return;
+  }
+  index_accessor.insert({std::move(*key), &vertex, 0});
+}
+
 template <typename TSkiplistIter, typename TIndex, typename TIndexKey, typename TFunc>
 inline void CreateIndexOnSingleThread(utils::SkipList<Vertex>::Accessor &vertices, TSkiplistIter it, TIndex &index,
                                       TIndexKey key, const TFunc &func) {
@@ -132,6 +132,19 @@ InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_ac
       storage_(storage),
       transaction_(transaction) {}
 
+InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                       utils::SkipList<Vertex>::ConstAccessor vertices_accessor, LabelId label,
+                                       View view, Storage *storage, Transaction *transaction, Vertex *lower_vertex,
+                                       Vertex *upper_vertex)
+    : pin_accessor_(std::move(vertices_accessor)),
+      index_accessor_(std::move(index_accessor)),
+      label_(label),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction),
+      lower_vertex_(lower_vertex),
+      upper_vertex_(upper_vertex) {}
+
 InMemoryLabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
       index_iterator_(index_iterator),
@@ -148,6 +161,11 @@ InMemoryLabelIndex::Iterable::Iterator &InMemoryLabelIndex::Iterable::Iterator::
 
 void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (self_->upper_vertex_ && index_iterator_->vertex >= self_->upper_vertex_) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+
     if (index_iterator_->vertex == current_vertex_) {
       continue;
     }
@@ -197,6 +215,36 @@ InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(
   return {it->second.access(), std::move(vertices_acc), label, view, storage, transaction};
 }
 
+std::vector<InMemoryLabelIndex::Iterable> InMemoryLabelIndex::ChunkedVertices(LabelId label, View view,
+                                                                              Storage *storage,
+                                                                              Transaction *transaction,
+                                                                              size_t num_chunks) {
+  const auto it = index_.find(label);
+  MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
+  const auto *mem_storage = static_cast<InMemoryStorage const *>(storage);
+
+  // Entries of the same vertex are adjacent, so splitting by vertex keeps all
+  // of them in the same chunk.
+  std::vector<Vertex *> boundaries;
+  {
+    auto index_acc = it->second.access();
+    for (const auto &point : index_acc.split_points(num_chunks)) {
+      if (boundaries.empty() || boundaries.back() != point->vertex) boundaries.push_back(point->vertex);
+    }
+  }
+
+  std::vector<Iterable> chunks;
+  chunks.reserve(boundaries.size() + 1);
+  Vertex *lower = nullptr;
+  for (size_t i = 0; i <= boundaries.size(); ++i) {
+    Vertex *upper = i < boundaries.size() ? boundaries[i] : nullptr;
+    chunks.emplace_back(it->second.access(), mem_storage->vertices_.access(), label, view, storage, transaction, lower,
+                        upper);
+    lower = upper;
+  }
+  return chunks;
+}
+
 void InMemoryLabelIndex::SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats) {
   auto locked_stats = stats_.Lock();
   locked_stats->insert_or_assign(label, stats);
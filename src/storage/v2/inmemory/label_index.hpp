@@ -66,6 +66,12 @@ class InMemoryLabelIndex : public storage::LabelIndex {
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
              LabelId label, View view, Storage *storage, Transaction *transaction);
 
+    /// Iterates only the entries whose vertex is in the [lower_vertex,
+    /// upper_vertex) range of the index order. `nullptr` means unbounded.
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+             LabelId label, View view, Storage *storage, Transaction *transaction, Vertex *lower_vertex,
+             Vertex *upper_vertex);
+
     class Iterator {
      public:
       Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
@@ -86,7 +92,10 @@ class InMemoryLabelIndex : public storage::LabelIndex {
       Vertex *current_vertex_;
     };
 
-    Iterator begin() { return {this, index_accessor_.begin()}; }
+    Iterator begin() {
+      return {this, lower_vertex_ ? index_accessor_.find_equal_or_greater(Entry{lower_vertex_, 0})
+                                  : index_accessor_.begin()};
+    }
     Iterator end() { return {this, index_accessor_.end()}; }
 
    private:
@@ -96,6 +105,8 @@ class InMemoryLabelIndex : public storage::LabelIndex {
     View view_;
     Storage *storage_;
     Transaction *transaction_;
+    Vertex *lower_vertex_{nullptr};
+    Vertex *upper_vertex_{nullptr};
   };
 
   uint64_t ApproximateVertexCount(LabelId label) const override;
@@ -107,6 +118,11 @@ class InMemoryLabelIndex : public storage::LabelIndex {
   Iterable Vertices(LabelId label, memgraph::utils::SkipList<memgraph::storage::Vertex>::ConstAccessor vertices_acc,
                     View view, Storage *storage, Transaction *transaction);
 
+  /// Splits the index entries of `label` into at most `num_chunks` disjoint
+  /// iterables of approximately equal size which can be consumed in parallel.
+  std::vector<Iterable> ChunkedVertices(LabelId label, View view, Storage *storage, Transaction *transaction,
+                                        size_t num_chunks);
+
   void SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats);
 
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const;
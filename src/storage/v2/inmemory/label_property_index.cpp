@@ -9,6 +9,8 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <bit>
 #include <chrono>
 #include <cstdint>
 #include <limits>
@@ -22,11 +24,87 @@
 #include "storage/v2/temporal.hpp"
 #include "utils/bound.hpp"
 #include "utils/counter.hpp"
+#include "utils/fnv.hpp"
 #include "utils/logging.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/temporal.hpp"
 
 namespace memgraph::storage {
 
+namespace {
+
+uint64_t MixHash(uint64_t hash) {
+  // splitmix64 finalizer, the hash lookup tables are sharded by the high bits
+  hash ^= hash >> 30U;
+  hash *= 0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27U;
+  hash *= 0x94d049bb133111ebULL;
+  hash ^= hash >> 31U;
+  return hash;
+}
+
+/// Returns a hash consistent with `PropertyValue` equality, or `std::nullopt`
+/// for values which aren't kept in the hash lookup tables.
+std::optional<uint64_t> HashForEqualityLookup(const PropertyValue &value) {
+  switch (value.type()) {
+    case PropertyValue::Type::Bool:
+      return MixHash(value.ValueBool() ? 1 : 0);
+    case PropertyValue::Type::Int:
+      // An integer is equal to a double if its conversion to double is equal.
+      // Adding 0.0 turns -0.0 into 0.0.
+      return MixHash(std::bit_cast<uint64_t>(static_cast<double>(value.ValueInt()) + 0.0));
+    case PropertyValue::Type::Double:
+      return MixHash(std::bit_cast<uint64_t>(value.ValueDouble() + 0.0));
+    case PropertyValue::Type::String:
+      return MixHash(utils::Fnv(value.ValueString()));
+    case PropertyValue::Type::Enum:
+      return MixHash(hash_value(value.ValueEnum()));
+    case PropertyValue::Type::Null:
+    case PropertyValue::Type::List:
+    case PropertyValue::Type::Map:
+    case PropertyValue::Type::TemporalData:
+    case PropertyValue::Type::ZonedTemporalData:
+    case PropertyValue::Type::Point2d:
+    case PropertyValue::Type::Point3d:
+      return std::nullopt;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+void InMemoryLabelPropertyIndex::HashLookup::Insert(uint64_t hash, Candidate candidate) {
+  shards_[ShardOf(hash)].WithLock([&](auto &buckets) { buckets[hash].push_back(candidate); });
+}
+
+void InMemoryLabelPropertyIndex::HashLookup::Remove(std::vector<std::pair<uint64_t, Candidate>> entries) {
+  std::sort(entries.begin(), entries.end());
+  auto it = entries.begin();
+  while (it != entries.end()) {
+    const auto hash = it->first;
+    auto bucket_end = std::find_if(it, entries.end(), [hash](const auto &entry) { return entry.first != hash; });
+    shards_[ShardOf(hash)].WithLock([&](auto &buckets) {
+      auto bucket = buckets.find(hash);
+      if (bucket == buckets.end()) return;
+      std::erase_if(bucket->second, [&](const Candidate &candidate) {
+        return std::binary_search(it, bucket_end, std::make_pair(hash, candidate));
+      });
+      if (bucket->second.empty()) buckets.erase(bucket);
+    });
+    it = bucket_end;
+  }
+}
+
+std::vector<InMemoryLabelPropertyIndex::HashLookup::Candidate> InMemoryLabelPropertyIndex::HashLookup::Find(
+    uint64_t hash) const {
+  auto candidates = shards_[ShardOf(hash)].WithReadLock([hash](const auto &buckets) {
+    auto bucket = buckets.find(hash);
+    return bucket == buckets.end() ? std::vector<Candidate>{} : bucket->second;
+  });
+  std::sort(candidates.begin(), candidates.end());
+  return candidates;
+}
+
 bool InMemoryLabelPropertyIndex::Entry::operator<(const Entry &rhs) const {
   if (value < rhs.value) {
     return true;
@@ -86,11 +164,42 @@ bool InMemoryLabelPropertyIndex::CreateIndex(
     return false;
   }
 
-  if (parallel_exec_info) {
-    return create_index_par(label, property, vertices, it, *parallel_exec_info);
+  const bool created = parallel_exec_info ? create_index_par(label, property, vertices, it, *parallel_exec_info)
+                                           : create_index_seq(label, property, vertices, it);
+
+  if (hash_lookups_enabled_) {
+    auto &hash_lookup = hash_lookups_[{label, property}];
+    for (const auto &entry : it->second.access()) {
+      if (auto hash = HashForEqualityLookup(entry.value)) {
+        hash_lookup.Insert(*hash, {entry.vertex, entry.timestamp});
+      }
+    }
+  }
+
+  return created;
+}
+
+bool InMemoryLabelPropertyIndex::CreateIndex(
+    LabelId label, const std::vector<PropertyId> &properties, utils::SkipList<Vertex>::Accessor vertices,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info) {
+  using Key = std::pair<LabelId, std::vector<PropertyId>>;
+  auto [it, emplaced] = composite_index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, properties),
+                                                 std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
   }
 
-  return create_index_seq(label, property, vertices, it);
+  using IndexAccessor = decltype(it->second.access());
+  auto insert = [](Vertex &vertex, const Key &key, IndexAccessor &index_accessor) {
+    TryInsertLabelPropertiesIndex(vertex, key.first, key.second, index_accessor);
+  };
+  if (parallel_exec_info) {
+    CreateIndexOnMultipleThreads(vertices, it, composite_index_, it->first, *parallel_exec_info, insert);
+  } else {
+    CreateIndexOnSingleThread(vertices, it, composite_index_, it->first, insert);
+  }
+  return true;
 }
 
 void InMemoryLabelPropertyIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update,
@@ -101,8 +210,21 @@ void InMemoryLabelPropertyIndex::UpdateOnAddLabel(LabelId added_label, Vertex *v
     }
     auto prop_value = vertex_after_update->properties.GetProperty(label_prop.second);
     if (!prop_value.IsNull()) {
+      auto *hash_lookup = GetHashLookup(label_prop.first, label_prop.second);
+      auto hash = hash_lookup ? HashForEqualityLookup(prop_value) : std::nullopt;
+      auto acc = storage.access();
+      auto [_, inserted] = acc.insert(Entry{std::move(prop_value), vertex_after_update, tx.start_timestamp});
+      if (inserted && hash) hash_lookup->Insert(*hash, {vertex_after_update, tx.start_timestamp});
+    }
+  }
+
+  for (auto &[label_props, storage] : composite_index_) {
+    if (label_props.first != added_label) {
+      continue;
+    }
+    if (auto key = CompositeIndexKey(*vertex_after_update, label_props.second)) {
       auto acc = storage.access();
-      acc.insert(Entry{std::move(prop_value), vertex_after_update, tx.start_timestamp});
+      acc.insert(Entry{std::move(*key), vertex_after_update, tx.start_timestamp});
     }
   }
 }
@@ -113,6 +235,16 @@ void InMemoryLabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const
     return;
   }
 
+  // The vertex already has the new value, so the composite keys are read from it
+  for (auto &[label_props, storage] : composite_index_) {
+    const auto &[label, properties] = label_props;
+    if (!utils::Contains(properties, property) || !utils::Contains(vertex->labels, label)) continue;
+    if (auto key = CompositeIndexKey(*vertex, properties)) {
+      auto acc = storage.access();
+      acc.insert(Entry{std::move(*key), vertex, tx.start_timestamp});
+    }
+  }
+
   auto index = indices_by_property_.find(property);
   if (index == indices_by_property_.end()) {
     return;
@@ -121,7 +253,11 @@ void InMemoryLabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const
   for (const auto &[label, storage] : index->second) {
     if (!utils::Contains(vertex->labels, label)) continue;
     auto acc = storage->access();
-    acc.insert(Entry{value, vertex, tx.start_timestamp});
+    auto [_, inserted] = acc.insert(Entry{value, vertex, tx.start_timestamp});
+    if (!inserted) continue;
+    if (auto *hash_lookup = GetHashLookup(label, property)) {
+      if (auto hash = HashForEqualityLookup(value)) hash_lookup->Insert(*hash, {vertex, tx.start_timestamp});
+    }
   }
 }
 
@@ -134,6 +270,7 @@ bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, PropertyId property) {
     }
   }
 
+  hash_lookups_.erase({label, property});
   return index_.erase({label, property}) > 0;
 }
 
@@ -150,6 +287,23 @@ std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyIndex::ListIndi
   return ret;
 }
 
+bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, const std::vector<PropertyId> &properties) {
+  return composite_index_.erase({label, properties}) > 0;
+}
+
+bool InMemoryLabelPropertyIndex::IndexExists(LabelId label, const std::vector<PropertyId> &properties) const {
+  return composite_index_.find({label, properties}) != composite_index_.end();
+}
+
+std::vector<std::pair<LabelId, std::vector<PropertyId>>> InMemoryLabelPropertyIndex::ListCompositeIndices() const {
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ret;
+  ret.reserve(composite_index_.size());
+  for (const auto &item : composite_index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
 void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) {
   auto maybe_stop = utils::ResettableCounter<2048>();
 
@@ -158,6 +312,13 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
     // before starting index, check if stop_requested
     if (token.stop_requested()) return;
 
+    auto *hash_lookup = GetHashLookup(label_id, prop_id);
+    std::vector<std::pair<uint64_t, HashLookup::Candidate>> removed_candidates;
+    // Removed from the hash lookup table in bulk once the index is processed
+    auto remove_candidates = utils::OnScopeExit{[&] {
+      if (!removed_candidates.empty()) hash_lookup->Remove(std::move(removed_candidates));
+    }};
+
     auto index_acc = index.access();
     auto it = index_acc.begin();
     auto end_it = index_acc.end();
@@ -174,6 +335,35 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
         bool redundant_duplicate = has_next && it->vertex == next_it->vertex && it->value == next_it->value;
         if (redundant_duplicate ||
             !AnyVersionHasLabelProperty(*it->vertex, label_id, prop_id, it->value, oldest_active_start_timestamp)) {
+          auto hash = hash_lookup ? HashForEqualityLookup(it->value) : std::nullopt;
+          HashLookup::Candidate candidate{it->vertex, it->timestamp};
+          if (index_acc.remove(*it) && hash) removed_candidates.emplace_back(*hash, candidate);
+        }
+      }
+      if (!has_next) break;
+      it = next_it;
+    }
+  }
+
+  for (auto &[label_props, index] : composite_index_) {
+    const auto &[label_id, prop_ids] = label_props;
+    if (token.stop_requested()) return;
+
+    auto index_acc = index.access();
+    auto it = index_acc.begin();
+    auto end_it = index_acc.end();
+    if (it == end_it) continue;
+    while (true) {
+      if (maybe_stop() && token.stop_requested()) return;
+
+      auto next_it = it;
+      ++next_it;
+
+      bool has_next = next_it != end_it;
+      if (it->timestamp < oldest_active_start_timestamp) {
+        bool redundant_duplicate = has_next && it->vertex == next_it->vertex && it->value == next_it->value;
+        if (redundant_duplicate || !AnyVersionHasLabelProperties(*it->vertex, label_id, prop_ids,
+                                                                 it->value.ValueList(), oldest_active_start_timestamp)) {
           index_acc.remove(*it);
         }
       }
@@ -184,21 +374,54 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator::Iterator(Iterable *self,
-                                                         utils::SkipList<Entry>::Iterator index_iterator)
+                                                         utils::SkipList<Entry>::Iterator index_iterator,
+                                                         size_t candidate_index)
     : self_(self),
       index_iterator_(index_iterator),
+      candidate_index_(candidate_index),
       current_vertex_accessor_(nullptr, self_->storage_, nullptr),
       current_vertex_(nullptr) {
   AdvanceUntilValid();
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator &InMemoryLabelPropertyIndex::Iterable::Iterator::operator++() {
-  ++index_iterator_;
+  if (self_->candidates_) {
+    ++candidate_index_;
+  } else {
+    ++index_iterator_;
+  }
   AdvanceUntilValid();
   return *this;
 }
 
+void InMemoryLabelPropertyIndex::Iterable::Iterator::AdvanceCandidatesUntilValid() {
+  const auto &candidates = *self_->candidates_;
+  for (; candidate_index_ < candidates.size(); ++candidate_index_) {
+    const auto &[vertex, timestamp] = candidates[candidate_index_];
+    if (vertex == current_vertex_) {
+      continue;
+    }
+
+    if (!CanSeeEntityWithTimestamp(timestamp, self_->transaction_)) {
+      continue;
+    }
+
+    // The candidate may have a different value with the same hash, the
+    // current version decides.
+    if (CurrentVersionHasLabelProperty(*vertex, self_->label_, self_->property_, self_->lower_bound_->value(),
+                                       self_->transaction_, self_->view_)) {
+      current_vertex_ = vertex;
+      current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->storage_, self_->transaction_);
+      break;
+    }
+  }
+}
+
 void InMemoryLabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
+  if (self_->candidates_) {
+    AdvanceCandidatesUntilValid();
+    return;
+  }
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
     if (index_iterator_->vertex == current_vertex_) {
       continue;
@@ -208,27 +431,45 @@ void InMemoryLabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
       continue;
     }
 
+    // The bounds of a composite index apply to the value following the prefix
+    const auto *bounded_value = &index_iterator_->value;
+    if (!self_->properties_.empty()) {
+      const auto &values = index_iterator_->value.ValueList();
+      // Entries are ordered by their prefix first, so once the prefix differs
+      // none of the following entries can match.
+      if (!std::equal(self_->prefix_.begin(), self_->prefix_.end(), values.begin())) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+      if (self_->prefix_.size() < values.size()) bounded_value = &values[self_->prefix_.size()];
+    }
+
     if (self_->lower_bound_) {
-      if (index_iterator_->value < self_->lower_bound_->value()) {
+      if (*bounded_value < self_->lower_bound_->value()) {
         continue;
       }
-      if (!self_->lower_bound_->IsInclusive() && index_iterator_->value == self_->lower_bound_->value()) {
+      if (!self_->lower_bound_->IsInclusive() && *bounded_value == self_->lower_bound_->value()) {
         continue;
       }
     }
     if (self_->upper_bound_) {
-      if (self_->upper_bound_->value() < index_iterator_->value) {
+      if (self_->upper_bound_->value() < *bounded_value) {
         index_iterator_ = self_->index_accessor_.end();
         break;
       }
-      if (!self_->upper_bound_->IsInclusive() && index_iterator_->value == self_->upper_bound_->value()) {
+      if (!self_->upper_bound_->IsInclusive() && *bounded_value == self_->upper_bound_->value()) {
         index_iterator_ = self_->index_accessor_.end();
         break;
       }
     }
 
-    if (CurrentVersionHasLabelProperty(*index_iterator_->vertex, self_->label_, self_->property_,
-                                       index_iterator_->value, self_->transaction_, self_->view_)) {
+    const bool visible =
+        self_->properties_.empty()
+            ? CurrentVersionHasLabelProperty(*index_iterator_->vertex, self_->label_, self_->property_,
+                                             index_iterator_->value, self_->transaction_, self_->view_)
+            : CurrentVersionHasLabelProperties(*index_iterator_->vertex, self_->label_, self_->properties_,
+                                               index_iterator_->value.ValueList(), self_->transaction_, self_->view_);
+    if (visible) {
       current_vertex_ = index_iterator_->vertex;
       current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->storage_, self_->transaction_);
       break;
@@ -241,7 +482,8 @@ InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor
                                                PropertyId property,
                                                const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                                                const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
-                                               Storage *storage, Transaction *transaction)
+                                               Storage *storage, Transaction *transaction,
+                                               std::optional<std::vector<HashLookup::Candidate>> candidates)
     : pin_accessor_(std::move(vertices_accessor)),
       index_accessor_(std::move(index_accessor)),
       label_(label),
@@ -250,7 +492,8 @@ InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor
       upper_bound_(upper_bound),
       view_(view),
       storage_(storage),
-      transaction_(transaction) {
+      transaction_(transaction),
+      candidates_(std::move(candidates)) {
   // We have to fix the bounds that the user provided to us. If the user
   // provided only one bound we should make sure that only values of that type
   // are returned by the iterator. We ensure this by supplying either an
@@ -360,10 +603,31 @@ InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor
   }
 }
 
+InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                               utils::SkipList<Vertex>::ConstAccessor vertices_accessor, LabelId label,
+                                               std::vector<PropertyId> properties, std::vector<PropertyValue> prefix,
+                                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                                               Storage *storage, Transaction *transaction)
+    : Iterable(std::move(index_accessor), std::move(vertices_accessor), label, properties.front(), lower_bound,
+               upper_bound, view, storage, transaction) {
+  MG_ASSERT(prefix.size() < properties.size() || (!lower_bound_ && !upper_bound_),
+            "A composite index lookup can't have bounds after a value for each property!");
+  properties_ = std::move(properties);
+  prefix_ = std::move(prefix);
+}
+
 InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Iterable::begin() {
   // If the bounds are set and don't have comparable types we don't yield any
   // items from the index.
-  if (!bounds_valid_) return {this, index_accessor_.end()};
+  if (!bounds_valid_) return end();
+  if (candidates_) return {this, index_accessor_.end(), 0};
+  if (!properties_.empty()) {
+    // Seek to the first entry with the prefix and the lower bound
+    PropertyValue::list_t start(prefix_.begin(), prefix_.end());
+    if (lower_bound_) start.push_back(lower_bound_->value());
+    return {this, index_accessor_.find_equal_or_greater(PropertyValue(std::move(start)))};
+  }
   auto index_iterator = index_accessor_.begin();
   if (lower_bound_) {
     index_iterator = index_accessor_.find_equal_or_greater(lower_bound_->value());
@@ -372,7 +636,7 @@ InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Itera
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Iterable::end() {
-  return {this, index_accessor_.end()};
+  return {this, index_accessor_.end(), candidates_ ? candidates_->size() : 0};
 }
 
 uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
@@ -410,6 +674,24 @@ uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(
   return acc.estimate_range_count(lower, upper, utils::SkipListLayerForCountEstimation(acc.size()));
 }
 
+uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label,
+                                                            const std::vector<PropertyId> &properties) const {
+  auto it = composite_index_.find({label, properties});
+  MG_ASSERT(it != composite_index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  return it->second.size();
+}
+
+uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                                            const std::vector<PropertyValue> &values) const {
+  auto it = composite_index_.find({label, properties});
+  MG_ASSERT(it != composite_index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  MG_ASSERT(values.size() == properties.size(), "A value is needed for each property of the composite index!");
+  auto acc = it->second.access();
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_count(PropertyValue(PropertyValue::list_t(values.begin(), values.end())),
+                            utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
 std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyIndex::ClearIndexStats() {
   std::vector<std::pair<LabelId, PropertyId>> deleted_indexes;
   auto locked_stats = stats_.Lock();
@@ -455,6 +737,9 @@ void InMemoryLabelPropertyIndex::RunGC() {
   for (auto &index_entry : index_) {
     index_entry.second.run_gc();
   }
+  for (auto &index_entry : composite_index_) {
+    index_entry.second.run_gc();
+  }
 }
 
 InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
@@ -467,8 +752,10 @@ InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
   auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+  // Candidates are collected after the vertices accessor pins the vertices
+  auto candidates = FindCandidates(label, property, lower_bound, upper_bound);
   return {it->second.access(), std::move(vertices_acc), label, property, lower_bound, upper_bound, view, storage,
-          transaction};
+          transaction, std::move(candidates)};
 }
 
 InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
@@ -479,8 +766,24 @@ InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
     Transaction *transaction) {
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
+  auto candidates = FindCandidates(label, property, lower_bound, upper_bound);
   return {it->second.access(), std::move(vertices_acc), label, property, lower_bound, upper_bound, view, storage,
-          transaction};
+          transaction, std::move(candidates)};
+}
+
+InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
+    LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+    Transaction *transaction) {
+  DMG_ASSERT(storage->storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL ||
+                 storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
+             "PropertyLabel index trying to access InMemory vertices from OnDisk!");
+  auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
+  auto it = composite_index_.find({label, properties});
+  MG_ASSERT(it != composite_index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  return {it->second.access(), std::move(vertices_acc), label, properties, std::move(prefix), lower_bound,
+          upper_bound, view, storage, transaction};
 }
 
 void InMemoryLabelPropertyIndex::AbortEntries(PropertyId property,
@@ -490,11 +793,17 @@ void InMemoryLabelPropertyIndex::AbortEntries(PropertyId property,
   if (it == indices_by_property_.end()) return;
 
   auto &indices = it->second;
-  for (const auto &[_, index] : indices) {
+  for (const auto &[label, index] : indices) {
+    auto *hash_lookup = GetHashLookup(label, property);
+    std::vector<std::pair<uint64_t, HashLookup::Candidate>> removed_candidates;
     auto index_acc = index->access();
     for (auto const &[value, vertex] : vertices) {
-      index_acc.remove(Entry{value, vertex, exact_start_timestamp});
+      auto hash = hash_lookup ? HashForEqualityLookup(value) : std::nullopt;
+      if (index_acc.remove(Entry{value, vertex, exact_start_timestamp}) && hash) {
+        removed_candidates.emplace_back(*hash, HashLookup::Candidate{vertex, exact_start_timestamp});
+      }
     }
+    if (!removed_candidates.empty()) hash_lookup->Remove(std::move(removed_candidates));
   }
 }
 
@@ -506,17 +815,45 @@ void InMemoryLabelPropertyIndex::AbortEntries(LabelId label,
       continue;
     }
 
+    auto *hash_lookup = GetHashLookup(label_prop.first, label_prop.second);
+    std::vector<std::pair<uint64_t, HashLookup::Candidate>> removed_candidates;
     auto index_acc = storage.access();
     for (const auto &[property, vertex] : vertices) {
       if (!property.IsNull()) {
-        index_acc.remove(Entry{property, vertex, exact_start_timestamp});
+        auto hash = hash_lookup ? HashForEqualityLookup(property) : std::nullopt;
+        if (index_acc.remove(Entry{property, vertex, exact_start_timestamp}) && hash) {
+          removed_candidates.emplace_back(*hash, HashLookup::Candidate{vertex, exact_start_timestamp});
+        }
       }
     }
+    if (!removed_candidates.empty()) hash_lookup->Remove(std::move(removed_candidates));
   }
 }
 
+std::optional<std::vector<InMemoryLabelPropertyIndex::HashLookup::Candidate>>
+InMemoryLabelPropertyIndex::FindCandidates(LabelId label, PropertyId property,
+                                           const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                           const std::optional<utils::Bound<PropertyValue>> &upper_bound) const {
+  if (!hash_lookups_enabled_ || !lower_bound || !upper_bound) return std::nullopt;
+  if (!lower_bound->IsInclusive() || !upper_bound->IsInclusive()) return std::nullopt;
+  if (lower_bound->value() != upper_bound->value()) return std::nullopt;
+  auto hash = HashForEqualityLookup(lower_bound->value());
+  if (!hash) return std::nullopt;
+  auto it = hash_lookups_.find({label, property});
+  if (it == hash_lookups_.end()) return std::nullopt;
+  return it->second.Find(*hash);
+}
+
+InMemoryLabelPropertyIndex::HashLookup *InMemoryLabelPropertyIndex::GetHashLookup(LabelId label, PropertyId property) {
+  if (!hash_lookups_enabled_) return nullptr;
+  auto it = hash_lookups_.find({label, property});
+  return it == hash_lookups_.end() ? nullptr : &it->second;
+}
+
 void InMemoryLabelPropertyIndex::DropGraphClearIndices() {
+  hash_lookups_.clear();
   index_.clear();
+  composite_index_.clear();
   indices_by_property_.clear();
   stats_->clear();
 }
@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include <array>
 #include <span>
+#include <unordered_map>
+#include <vector>
 
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
@@ -20,6 +23,7 @@
 #include "storage/v2/indices/label_property_index_stats.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/rw_lock.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
 namespace memgraph::storage {
@@ -38,13 +42,52 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     bool operator==(const PropertyValue &rhs) const;
   };
 
+  /// Exact-match lookup table of one index. It mirrors the entries of the
+  /// index skip list, bucketed by the hash of their value, so equality
+  /// lookups don't have to search the skip list. Only entries with a hashable
+  /// value (see `HashForEqualityLookup`) are kept in the table.
+  class HashLookup {
+   public:
+    struct Candidate {
+      Vertex *vertex;
+      uint64_t timestamp;
+
+      auto operator<=>(const Candidate &) const = default;
+    };
+
+    void Insert(uint64_t hash, Candidate candidate);
+
+    /// Removes the given entries. Entries are removed in bulk so that garbage
+    /// collection of a large bucket doesn't scan the bucket for each entry.
+    void Remove(std::vector<std::pair<uint64_t, Candidate>> entries);
+
+    /// Returns all entries with the given hash, ordered by vertex.
+    std::vector<Candidate> Find(uint64_t hash) const;
+
+   private:
+    static constexpr uint64_t kShardBits = 6;
+
+    static uint64_t ShardOf(uint64_t hash) { return hash >> (64 - kShardBits); }
+
+    std::array<utils::Synchronized<std::unordered_map<uint64_t, std::vector<Candidate>>, utils::RWSpinLock>,
+               1U << kShardBits>
+        shards_;
+  };
+
  public:
-  InMemoryLabelPropertyIndex() = default;
+  explicit InMemoryLabelPropertyIndex(bool hash_lookups = false) : hash_lookups_enabled_(hash_lookups) {}
 
   /// @throw std::bad_alloc
   bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
                    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info);
 
+  /// Creates a composite index over the ordered list of `properties`. A vertex
+  /// is indexed by the list of its values of all the properties, so it is only
+  /// indexed if it has all of them.
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, const std::vector<PropertyId> &properties, utils::SkipList<Vertex>::Accessor vertices,
+                   const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info);
+
   /// @throw std::bad_alloc
   void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
 
@@ -60,6 +103,12 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   std::vector<std::pair<LabelId, PropertyId>> ListIndices() const override;
 
+  bool DropIndex(LabelId label, const std::vector<PropertyId> &properties);
+
+  bool IndexExists(LabelId label, const std::vector<PropertyId> &properties) const;
+
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListCompositeIndices() const;
+
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
 
   void AbortEntries(PropertyId property, std::span<std::pair<PropertyValue, Vertex *> const> vertices,
@@ -79,27 +128,43 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   class Iterable {
    public:
+    /// If `candidates` are given, the iterable yields the candidates which
+    /// currently have the value of the (equal) bounds instead of searching the
+    /// index skip list.
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
              LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+             Transaction *transaction, std::optional<std::vector<HashLookup::Candidate>> candidates = std::nullopt);
+
+    /// Iterates a composite index. Only entries whose values start with
+    /// `prefix` are yielded, and the bounds apply to the value of the property
+    /// following the prefix.
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+             LabelId label, std::vector<PropertyId> properties, std::vector<PropertyValue> prefix,
+             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
              Transaction *transaction);
 
     class Iterator {
      public:
-      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator, size_t candidate_index = 0);
 
       VertexAccessor const &operator*() const { return current_vertex_accessor_; }
 
-      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
-      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+      bool operator==(const Iterator &other) const {
+        return index_iterator_ == other.index_iterator_ && candidate_index_ == other.candidate_index_;
+      }
+      bool operator!=(const Iterator &other) const { return !(*this == other); }
 
       Iterator &operator++();
 
      private:
       void AdvanceUntilValid();
+      void AdvanceCandidatesUntilValid();
 
       Iterable *self_;
       utils::SkipList<Entry>::Iterator index_iterator_;
+      size_t candidate_index_;
       VertexAccessor current_vertex_accessor_;
       Vertex *current_vertex_;
     };
@@ -118,6 +183,10 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     View view_;
     Storage *storage_;
     Transaction *transaction_;
+    std::optional<std::vector<HashLookup::Candidate>> candidates_;
+    // Set only for composite indices
+    std::vector<PropertyId> properties_;
+    std::vector<PropertyValue> prefix_;
   };
 
   uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
@@ -132,6 +201,13 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
                                   const std::optional<utils::Bound<PropertyValue>> &lower,
                                   const std::optional<utils::Bound<PropertyValue>> &upper) const override;
 
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const;
+
+  /// Estimates the number of vertices whose values of `properties` are equal
+  /// to `values`, which must have a value for each property.
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                  const std::vector<PropertyValue> &values) const;
+
   std::vector<std::pair<LabelId, PropertyId>> ClearIndexStats();
 
   std::vector<std::pair<LabelId, PropertyId>> DeleteIndexStats(const storage::LabelId &label);
@@ -154,11 +230,27 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
                     const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
                     Transaction *transaction);
 
+  Iterable Vertices(LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+                    Transaction *transaction);
+
   void DropGraphClearIndices() override;
 
  private:
+  /// Returns the candidates of an equality lookup if the index has a hash
+  /// lookup table and the bounds select a single hashable value.
+  std::optional<std::vector<HashLookup::Candidate>> FindCandidates(
+      LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+      const std::optional<utils::Bound<PropertyValue>> &upper_bound) const;
+
+  HashLookup *GetHashLookup(LabelId label, PropertyId property);
+
   std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
+  bool hash_lookups_enabled_;
+  std::map<std::pair<LabelId, PropertyId>, HashLookup> hash_lookups_;
   std::unordered_map<PropertyId, std::unordered_map<LabelId, utils::SkipList<Entry> *>> indices_by_property_;
+  std::map<std::pair<LabelId, std::vector<PropertyId>>, utils::SkipList<Entry>> composite_index_;
   utils::Synchronized<std::map<std::pair<LabelId, PropertyId>, storage::LabelPropertyIndexStats>,
                       utils::ReadPrioritizedRWLock>
       stats_;
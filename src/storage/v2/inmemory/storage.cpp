@@ -19,6 +19,7 @@
 #include "flags/general.hpp"
 #include "flags/run_time_configurable.hpp"
 #include "memory/global_memory_control.hpp"
+#include "storage/v2/adjacency.hpp"
 #include "storage/v2/durability/durability.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/edge_direction.hpp"
@@ -34,17 +35,23 @@
 #include "storage/v2/inmemory/unique_constraints.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/schema_info.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "utils/atomic_memory_block.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/stat.hpp"
+#include "utils/string.hpp"
 
+#include <latch>
 #include <mutex>
 #include <ranges>
 
 namespace memgraph::metrics {
 extern const Event PeakMemoryRes;
+extern const Event GCBacklogTransactions;
+extern const Event GCLag_ms;
+extern const Event GCLatency_us;
 }  // namespace memgraph::metrics
 
 namespace memgraph::storage {
@@ -82,6 +89,8 @@ constexpr auto ActionToStorageOperation(MetadataDelta::Action action) -> durabil
     add_case(ENUM_ALTER_UPDATE);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_DROP);
   }
 #undef add_case
 }
@@ -113,6 +122,33 @@ auto FindEdges(const View view, EdgeTypeId edge_type, const VertexAccessor *from
                                                                  : to_vertex->InEdges(view, {edge_type}, from_vertex);
 }
 
+// Range of timestamps checked in the commit log before merging a delta with a
+// delta of an older transaction.
+constexpr uint64_t kMaxMergeTimestampRange = 4096;
+
+// Removes the delta from the delta chain of `object`, whose lock must be held.
+// The delta keeps its `next` pointer for the readers which are already on it.
+// Its `prev` pointer is cleared, so the GC knows that it isn't linked anymore.
+template <typename TObj>
+void UnlinkMergedDelta(TObj &object, Delta &delta) {
+  auto *next = delta.next.load(std::memory_order_acquire);
+  auto prev = delta.prev.Get();
+  switch (prev.type) {
+    case PreviousPtr::Type::DELTA:
+      prev.delta->next.store(next, std::memory_order_release);
+      if (next != nullptr) next->prev.Set(prev.delta);
+      break;
+    case PreviousPtr::Type::VERTEX:
+    case PreviousPtr::Type::EDGE:
+      object.delta = next;
+      if (next != nullptr) next->prev.Set(&object);
+      break;
+    case PreviousPtr::Type::NULLPTR:
+      LOG_FATAL("Invalid pointer!");
+  }
+  delta.prev.Reset();
+}
+
 };  // namespace
 
 using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
@@ -125,6 +161,8 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
       global_locker_(file_retainer_.AddLocker()) {
   MG_ASSERT(config.salient.storage_mode != StorageMode::ON_DISK_TRANSACTIONAL,
             "Invalid storage mode sent to InMemoryStorage constructor!");
+  // Set up before the recovery so the recovered values get encoded
+  SetupStringDictionary();
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
       config_.durability.snapshot_on_exit || config_.durability.recover_on_startup) {
     // Create the directory initially to crash the database in case of
@@ -149,11 +187,15 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
               "storage directory, please stop it first before starting this "
               "process!",
               config_.durability.storage_directory);
+
+    // Segments of a snapshot which was being created when the process stopped.
+    utils::DeleteDir(recovery_.snapshot_directory_ / durability::kSnapshotSegmentsDirectory);
   }
   if (config_.durability.recover_on_startup) {
     auto info = recovery_.RecoverData(uuid(), repl_storage_state_, &vertices_, &edges_, &edges_metadata_, &edge_count_,
                                       name_id_mapper_.get(), &indices_, &constraints_, config_, &wal_seq_num_,
-                                      &enum_store_, &schema_info_, [this](Gid edge_gid) { return FindEdge(edge_gid); });
+                                      &enum_store_, &schema_info_, string_dictionary_.get(),
+                                      [this](Gid edge_gid) { return FindEdge(edge_gid); });
     if (info) {
       vertex_id_ = info->next_vertex_id;
       edge_id_ = info->next_edge_id;
@@ -163,6 +205,9 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
         spdlog::trace("Recovering last durable timestamp {}.", *info->last_durable_timestamp);
       }
     }
+    if (config_.salient.items.freeze_adjacency) {
+      FreezeAdjacencyExclusive();
+    }
   } else if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
              config_.durability.snapshot_on_exit) {
     bool files_moved = false;
@@ -210,9 +255,18 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
     };
   }
 
+  if (config_.gc.workers > 1) {
+    gc_workers_ = std::make_unique<utils::ThreadPool>(config_.gc.workers - 1);
+  }
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     // TODO: move out of storage have one global gc_runner_
-    gc_runner_.Run("Storage GC", config_.gc.interval, [this] { this->FreeMemory({}, true); });
+    gc_runner_.Run("Storage GC", config_.gc.interval, [this] {
+      // Runs limited by `max_transactions_per_run` are repeated until the
+      // backlog is worked off. The locks are released between the runs.
+      do {
+        this->FreeMemory({}, true);
+      } while (gc_run_limited_.exchange(false, std::memory_order_acq_rel) && !stop_source.stop_requested());
+    });
   }
   if (timestamp_ == kTimestampInitialId) {
     commit_log_.emplace();
@@ -232,8 +286,7 @@ InMemoryStorage::~InMemoryStorage() {
     repl_storage_state_.Reset();
   }
   if (wal_file_) {
-    wal_file_->FinalizeWal();
-    wal_file_ = std::nullopt;
+    ResetWalFile(true);
   }
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED) {
     snapshot_runner_.Stop();
@@ -436,10 +489,12 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
   utils::AtomicMemoryBlock(
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex, &schema_acc]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-        from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        AppendEdge(from_vertex->out_edges, from_vertex->out_edges_unmerged, {edge_type, to_vertex, edge},
+                   config_.freeze_adjacency_degree);
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-        to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        AppendEdge(to_vertex->in_edges, to_vertex->in_edges_unmerged, {edge_type, from_vertex, edge},
+                   config_.freeze_adjacency_degree);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -546,10 +601,12 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
   utils::AtomicMemoryBlock(
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex, &schema_acc]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-        from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        AppendEdge(from_vertex->out_edges, from_vertex->out_edges_unmerged, {edge_type, to_vertex, edge},
+                   config_.freeze_adjacency_degree);
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-        to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        AppendEdge(to_vertex->in_edges, to_vertex->in_edges_unmerged, {edge_type, from_vertex, edge},
+                   config_.freeze_adjacency_degree);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -637,21 +694,20 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
     MG_ASSERT(!to_vertex->deleted, "Invalid database state!");
   }
 
-  auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
+  auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges, uint8_t *unmerged) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto it = FindEdge(*edges, *unmerged, link);
     if (config_.properties_on_edges) {
       MG_ASSERT(it != edges->end(), "Invalid database state!");
     } else if (it == edges->end()) {
       return false;
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
+    EraseEdge(*edges, *unmerged, it);
     return true;
   };
 
-  auto op1 = delete_edge_from_storage(to_vertex, &old_from_vertex->out_edges);
-  auto op2 = delete_edge_from_storage(old_from_vertex, &to_vertex->in_edges);
+  auto op1 = delete_edge_from_storage(to_vertex, &old_from_vertex->out_edges, &old_from_vertex->out_edges_unmerged);
+  auto op2 = delete_edge_from_storage(old_from_vertex, &to_vertex->in_edges, &to_vertex->in_edges_unmerged);
 
   if (config_.properties_on_edges) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
@@ -668,9 +724,11 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
     if (schema_acc) schema_acc->DeleteEdge(old_from_vertex, to_vertex, edge_type, edge_ref);
 
     CreateAndLinkDelta(&transaction_, new_from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge_ref);
-    new_from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge_ref);
+    AppendEdge(new_from_vertex->out_edges, new_from_vertex->out_edges_unmerged, {edge_type, to_vertex, edge_ref},
+               config_.freeze_adjacency_degree);
     CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, new_from_vertex, edge_ref);
-    to_vertex->in_edges.emplace_back(edge_type, new_from_vertex, edge_ref);
+    AppendEdge(to_vertex->in_edges, to_vertex->in_edges_unmerged, {edge_type, new_from_vertex, edge_ref},
+               config_.freeze_adjacency_degree);
     if (schema_acc) schema_acc->CreateEdge(new_from_vertex, to_vertex, edge_type);
 
     auto *in_memory = static_cast<InMemoryStorage *>(storage_);
@@ -759,21 +817,20 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
     MG_ASSERT(!from_vertex->deleted, "Invalid database state!");
   }
 
-  auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
+  auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges, uint8_t *unmerged) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto it = FindEdge(*edges, *unmerged, link);
     if (config_.properties_on_edges) {
       MG_ASSERT(it != edges->end(), "Invalid database state!");
     } else if (it == edges->end()) {
       return false;
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
+    EraseEdge(*edges, *unmerged, it);
     return true;
   };
 
-  auto op1 = delete_edge_from_storage(old_to_vertex, &from_vertex->out_edges);
-  auto op2 = delete_edge_from_storage(from_vertex, &old_to_vertex->in_edges);
+  auto op1 = delete_edge_from_storage(old_to_vertex, &from_vertex->out_edges, &from_vertex->out_edges_unmerged);
+  auto op2 = delete_edge_from_storage(from_vertex, &old_to_vertex->in_edges, &old_to_vertex->in_edges_unmerged);
 
   if (config_.properties_on_edges) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
@@ -791,9 +848,11 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
     if (schema_acc) schema_acc->DeleteEdge(from_vertex, old_to_vertex, edge_type, edge_ref);
 
     CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, new_to_vertex, edge_ref);
-    from_vertex->out_edges.emplace_back(edge_type, new_to_vertex, edge_ref);
+    AppendEdge(from_vertex->out_edges, from_vertex->out_edges_unmerged, {edge_type, new_to_vertex, edge_ref},
+               config_.freeze_adjacency_degree);
     CreateAndLinkDelta(&transaction_, new_to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge_ref);
-    new_to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge_ref);
+    AppendEdge(new_to_vertex->in_edges, new_to_vertex->in_edges_unmerged, {edge_type, from_vertex, edge_ref},
+               config_.freeze_adjacency_degree);
     if (schema_acc) schema_acc->CreateEdge(from_vertex, new_to_vertex, edge_type);
 
     auto *in_memory = static_cast<InMemoryStorage *>(storage_);
@@ -858,20 +917,21 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeChangeType(EdgeAcces
   if (!PrepareForWrite(&transaction_, to_vertex)) return Error::SERIALIZATION_ERROR;
   MG_ASSERT(!to_vertex->deleted, "Invalid database state!");
 
-  auto change_edge_type_in_storage = [&edge_type, &edge_ref, &new_edge_type, this](auto *vertex, auto *edges) {
+  auto change_edge_type_in_storage = [&edge_type, &edge_ref, &new_edge_type, this](auto *vertex, auto *edges,
+                                                                                     uint8_t *unmerged) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto it = FindEdge(*edges, *unmerged, link);
     if (config_.properties_on_edges) {
       MG_ASSERT(it != edges->end(), "Invalid database state!");
     } else if (it == edges->end()) {
       return false;
     }
-    *it = std::tuple<EdgeTypeId, Vertex *, EdgeRef>{new_edge_type, vertex, edge_ref};
+    ReplaceEdge(*edges, *unmerged, it, std::tuple<EdgeTypeId, Vertex *, EdgeRef>{new_edge_type, vertex, edge_ref});
     return true;
   };
 
-  auto op1 = change_edge_type_in_storage(to_vertex, &from_vertex->out_edges);
-  auto op2 = change_edge_type_in_storage(from_vertex, &to_vertex->in_edges);
+  auto op1 = change_edge_type_in_storage(to_vertex, &from_vertex->out_edges, &from_vertex->out_edges_unmerged);
+  auto op2 = change_edge_type_in_storage(from_vertex, &to_vertex->in_edges, &to_vertex->in_edges_unmerged);
 
   MG_ASSERT((op1 && op2), "Invalid database state!");
 
@@ -901,6 +961,8 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
   MG_ASSERT(!transaction_.must_abort, "The transaction can't be committed!");
 
   auto could_replicate_all_sync_replicas = true;
+  // Group commit ticket of this transaction's WAL entry.
+  std::optional<uint64_t> wal_sync_ticket;
 
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
 
@@ -1027,6 +1089,9 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         if (is_main_or_replica_write) {
           could_replicate_all_sync_replicas =
               mem_storage->AppendToWal(transaction_, durability_commit_timestamp, std::move(db_acc));
+          if (mem_storage->config_.durability.wal_group_commit && mem_storage->wal_file_) {
+            wal_sync_ticket = mem_storage->wal_appended_ticket_;
+          }
 
           if (config_.enable_schema_info) {
             if (transaction_.deltas.size() < 16) {  // TODO Fine tune
@@ -1050,10 +1115,24 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
           mem_storage->repl_storage_state_.last_durable_timestamp_.store(durability_commit_timestamp);
         }
 
+        // Track the committed changes so periodic snapshots know how much changed since the last one
+        mem_storage->last_data_commit_timestamp_.store(*commit_timestamp_, std::memory_order_release);
+        mem_storage->committed_deltas_.fetch_add(transaction_.deltas.size() + transaction_.md_deltas.size(),
+                                                 std::memory_order_relaxed);
+
         // Install the new point index, if needed
         mem_storage->indices_.point_index_.InstallNewPointIndex(transaction_.point_index_change_collector_,
                                                                 transaction_.point_index_ctx_);
 
+        // Merge before the transaction is marked as finished. Until then the
+        // oldest active transaction can't be newer than this one, so the GC
+        // locks the object before unlinking the older deltas the merge walks.
+        // Transactions which aren't received from main on a replica keep their
+        // transaction id as the delta timestamp and aren't merged.
+        if (is_main_or_replica_write && config_.merge_property_deltas && !transaction_.deltas.empty()) {
+          MergePropertyDeltas();
+        }
+
         // TODO: can and should this be moved earlier?
         mem_storage->commit_log_->MarkFinished(start_timestamp);
 
@@ -1074,6 +1153,12 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
       }
     }  // Release engine lock because we don't have to hold it anymore
 
+    if (wal_sync_ticket) {
+      // The transaction is committed and visible, but the commit returns only
+      // once its WAL entry is durable.
+      mem_storage->WaitForWalSync(*wal_sync_ticket);
+    }
+
     if (unique_constraint_violation) {
       Abort();
       DMG_ASSERT(commit_timestamp_.has_value());
@@ -1215,6 +1300,82 @@ void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(std::unique_lock<std
   }
 }
 
+void InMemoryStorage::InMemoryAccessor::MergePropertyDeltas() {
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  auto const *const commit_timestamp_ptr = transaction_.commit_timestamp.get();
+  auto const commit_timestamp = *commit_timestamp_;
+  auto const start_timestamp = transaction_.start_timestamp;
+
+  // The oldest delta of this transaction for each property of the object.
+  std::vector<std::pair<PropertyId, Delta *>> oldest_deltas;
+  auto const find_property = [&](PropertyId property) {
+    return std::ranges::find(oldest_deltas, property, &std::pair<PropertyId, Delta *>::first);
+  };
+
+  auto const merge = [&](auto &object, Delta &head) {
+    auto guard = std::unique_lock{object.lock};
+    // The head was merged with an older delta of this transaction.
+    if (object.delta != &head) return;
+
+    // Deltas are applied from the newest to the oldest, so the value restored
+    // by the oldest delta of a property overwrites the values restored by the
+    // newer ones. Every reader that applies a delta of this transaction
+    // applies all of them, so only the oldest delta of a property is needed.
+    oldest_deltas.clear();
+    Delta *delta = &head;
+    for (; delta != nullptr && delta->timestamp == commit_timestamp_ptr;
+         delta = delta->next.load(std::memory_order_acquire)) {
+      if (delta->action != Delta::Action::SET_PROPERTY) continue;
+      auto it = find_property(delta->property.key);
+      if (it == oldest_deltas.end()) {
+        oldest_deltas.emplace_back(delta->property.key, delta);
+        continue;
+      }
+      UnlinkMergedDelta(object, *it->second);
+      it->second = delta;
+    }
+    if (oldest_deltas.empty() || delta == nullptr) return;
+
+    // The same holds for the deltas of the previous transaction on the object
+    // if no other transaction which started between the two commits can be
+    // running. Those would apply only the deltas of this transaction, which
+    // itself isn't marked as finished yet.
+    auto const *const older_timestamp_ptr = delta->timestamp;
+    auto const older_timestamp = older_timestamp_ptr->load(std::memory_order_acquire);
+    if (older_timestamp >= start_timestamp || commit_timestamp - older_timestamp > kMaxMergeTimestampRange ||
+        !mem_storage->commit_log_->AllFinished(older_timestamp + 1, start_timestamp) ||
+        !mem_storage->commit_log_->AllFinished(start_timestamp + 1, commit_timestamp)) {
+      return;
+    }
+    for (; delta != nullptr && delta->timestamp == older_timestamp_ptr;
+         delta = delta->next.load(std::memory_order_acquire)) {
+      if (delta->action != Delta::Action::SET_PROPERTY) continue;
+      auto it = find_property(delta->property.key);
+      if (it == oldest_deltas.end()) continue;
+      UnlinkMergedDelta(object, *it->second);
+      *it = oldest_deltas.back();
+      oldest_deltas.pop_back();
+      if (oldest_deltas.empty()) break;
+    }
+  };
+
+  for (auto &delta : transaction_.deltas) {
+    // Only the newest delta of this transaction on each object points to it.
+    auto prev = delta.prev.Get();
+    switch (prev.type) {
+      case PreviousPtr::Type::VERTEX:
+        merge(*prev.vertex, delta);
+        break;
+      case PreviousPtr::Type::EDGE:
+        merge(*prev.edge, delta);
+        break;
+      case PreviousPtr::Type::DELTA:
+      case PreviousPtr::Type::NULLPTR:
+        break;
+    }
+  }
+}
+
 void InMemoryStorage::InMemoryAccessor::Abort() {
   MG_ASSERT(is_transaction_active_, "The transaction is already terminated!");
 
@@ -1307,23 +1468,24 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                   }
                 }
                 // Setting the correct value
-                vertex->properties.SetProperty(current->property.key, *current->property.value);
+                vertex->properties.SetProperty(current->property.key, *current->property.value,
+                                               storage_->string_dictionary_.get());
                 break;
               }
               case Delta::Action::ADD_IN_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+                auto it = FindEdge(vertex->in_edges, vertex->in_edges_unmerged, link);
                 MG_ASSERT(it == vertex->in_edges.end(), "Invalid database state!");
-                vertex->in_edges.push_back(link);
+                AppendEdge(vertex->in_edges, vertex->in_edges_unmerged, link);
                 break;
               }
               case Delta::Action::ADD_OUT_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+                auto it = FindEdge(vertex->out_edges, vertex->out_edges_unmerged, link);
                 MG_ASSERT(it == vertex->out_edges.end(), "Invalid database state!");
-                vertex->out_edges.push_back(link);
+                AppendEdge(vertex->out_edges, vertex->out_edges_unmerged, link);
                 // Increment edge count. We only increment the count here because
                 // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
                 // redundant. Also, `Edge/RECREATE_OBJECT` isn't available when
@@ -1334,19 +1496,17 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
               case Delta::Action::REMOVE_IN_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+                auto it = FindEdge(vertex->in_edges, vertex->in_edges_unmerged, link);
                 MG_ASSERT(it != vertex->in_edges.end(), "Invalid database state!");
-                std::swap(*it, *vertex->in_edges.rbegin());
-                vertex->in_edges.pop_back();
+                EraseEdge(vertex->in_edges, vertex->in_edges_unmerged, it);
                 break;
               }
               case Delta::Action::REMOVE_OUT_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+                auto it = FindEdge(vertex->out_edges, vertex->out_edges_unmerged, link);
                 MG_ASSERT(it != vertex->out_edges.end(), "Invalid database state!");
-                std::swap(*it, *vertex->out_edges.rbegin());
-                vertex->out_edges.pop_back();
+                EraseEdge(vertex->out_edges, vertex->out_edges_unmerged, it);
                 // Decrement edge count. We only decrement the count here because
                 // the information in `REMOVE_IN_EDGE` and `Edge/DELETE_OBJECT` is
                 // redundant. Also, `Edge/DELETE_OBJECT` isn't available when edge
@@ -1399,7 +1559,8 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                  current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
             switch (current->action) {
               case Delta::Action::SET_PROPERTY: {
-                edge->properties.SetProperty(current->property.key, *current->property.value);
+                edge->properties.SetProperty(current->property.key, *current->property.value,
+                                             storage_->string_dictionary_.get());
                 if (!FLAGS_storage_properties_on_edges) break;
 
                 const auto &edge_types = index_stats.property_edge_type.p2et.find(current->property.key);
@@ -1584,6 +1745,21 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   return {};
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
+    LabelId label, const std::vector<PropertyId> &properties) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Creating composite index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  auto *mem_label_property_index =
+      static_cast<InMemoryLabelPropertyIndex *>(in_memory->indices_.label_property_index_.get());
+  if (!mem_label_property_index->CreateIndex(label, properties, in_memory->vertices_.access(), std::nullopt)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::label_property_composite_index_create, label, properties);
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveLabelPropertyIndices);
+  return {};
+}
+
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
     EdgeTypeId edge_type, bool unique_access_needed) {
   if (unique_access_needed) {
@@ -1639,6 +1815,21 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   return {};
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropIndex(
+    LabelId label, const std::vector<PropertyId> &properties) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Dropping composite index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  auto *mem_label_property_index =
+      static_cast<InMemoryLabelPropertyIndex *>(in_memory->indices_.label_property_index_.get());
+  if (!mem_label_property_index->DropIndex(label, properties)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::label_property_composite_index_drop, label, properties);
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveLabelPropertyIndices);
+  return {};
+}
+
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropIndex(
     EdgeTypeId edge_type) {
   MG_ASSERT(unique_guard_.owns_lock(), "Drop index requires a unique access to the storage!");
@@ -1789,6 +1980,42 @@ VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, View
   return VerticesIterable(mem_label_index->Vertices(label, view, storage_, &transaction_));
 }
 
+std::vector<VerticesIterable> InMemoryStorage::InMemoryAccessor::ChunkedVertices(View view, size_t num_chunks) {
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  // Boundaries are sampled once and used as gid keys, so vertices which are
+  // removed in the meantime can't break the partitioning.
+  std::vector<Gid> boundaries;
+  {
+    auto vertices_acc = mem_storage->vertices_.access();
+    for (const auto &point : vertices_acc.split_points(num_chunks)) {
+      boundaries.push_back(point->gid);
+    }
+  }
+
+  std::vector<VerticesIterable> chunks;
+  chunks.reserve(boundaries.size() + 1);
+  std::optional<Gid> lower;
+  for (size_t i = 0; i <= boundaries.size(); ++i) {
+    std::optional<Gid> upper = i < boundaries.size() ? std::optional<Gid>{boundaries[i]} : std::nullopt;
+    chunks.emplace_back(
+        AllVerticesIterable(mem_storage->vertices_.access(), storage_, &transaction_, view, lower, upper));
+    lower = upper;
+  }
+  return chunks;
+}
+
+std::vector<VerticesIterable> InMemoryStorage::InMemoryAccessor::ChunkedVertices(LabelId label, View view,
+                                                                                 size_t num_chunks) {
+  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
+  auto iterables = mem_label_index->ChunkedVertices(label, view, storage_, &transaction_, num_chunks);
+  std::vector<VerticesIterable> chunks;
+  chunks.reserve(iterables.size());
+  for (auto &iterable : iterables) {
+    chunks.emplace_back(std::move(iterable));
+  }
+  return chunks;
+}
+
 VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, PropertyId property, View view) {
   auto *mem_label_property_index =
       static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
@@ -1814,6 +2041,16 @@ VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
       mem_label_property_index->Vertices(label, property, lower_bound, upper_bound, view, storage_, &transaction_));
 }
 
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
+    LabelId label, const std::vector<PropertyId> &properties, const std::vector<PropertyValue> &prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  auto *mem_label_property_index =
+      static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
+  return VerticesIterable(mem_label_property_index->Vertices(label, properties, prefix, lower_bound, upper_bound,
+                                                             view, storage_, &transaction_));
+}
+
 EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, View view) {
   auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(storage_->indices_.edge_type_index_.get());
   return EdgesIterable(mem_edge_type_index->Edges(edge_type, view, storage_, &transaction_));
@@ -1892,8 +2129,31 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
                            [this]() { this->create_snapshot_handler(); });
     }
 
+    const bool bulk_import_finished = storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL;
     storage_mode_ = new_storage_mode;
+    // Analytical mode changes the data without tracking it in commits
+    data_resets_.fetch_add(1, std::memory_order_acq_rel);
     FreeMemory(std::move(main_guard), false);
+    if (bulk_import_finished && config_.salient.items.freeze_adjacency) {
+      FreezeAdjacency();
+    }
+  }
+}
+
+void InMemoryStorage::FreezeAdjacency() {
+  std::unique_lock main_guard{main_lock_};
+  FreezeAdjacencyExclusive();
+}
+
+void InMemoryStorage::FreezeAdjacencyExclusive() {
+  spdlog::trace("Freezing adjacency of '{}' started", name());
+  auto trace_on_exit = utils::OnScopeExit{[&] { spdlog::trace("Freezing adjacency of '{}' finished", name()); }};
+  // No transaction can be active, so edge lists can be reordered in place. The
+  // deltas refer to edges by value and are not affected by the new order.
+  auto vertices_acc = vertices_.access();
+  for (auto &vertex : vertices_acc) {
+    auto guard = std::unique_lock{vertex.lock};
+    storage::FreezeAdjacency(&vertex);
   }
 }
 
@@ -1938,6 +2198,8 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     return;
   }
 
+  utils::Timer timer;
+
   // Diagnostic trace
   spdlog::trace("Storage GC on '{}' started [{}]", name(), periodic ? "periodic" : "forced");
   auto trace_on_exit = utils::OnScopeExit{
@@ -2000,10 +2262,17 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // there are possible stale/duplicate entries that can be removed
   auto index_impact = IndexPerformanceTracker{};
 
+  // Periodic runs unlink at most `max_transactions_per_run` transactions, the rest is left for the following runs, so
+  // a large backlog doesn't keep the main lock for too long.
+  auto const max_transactions = periodic ? config_.gc.max_transactions_per_run : 0;
   auto const end_linked_undo_buffers = linked_undo_buffers.end();
   for (auto linked_entry = linked_undo_buffers.begin(); linked_entry != end_linked_undo_buffers;) {
-    auto const *const commit_timestamp_ptr = linked_entry->commit_timestamp_.get();
-    auto const commit_timestamp = commit_timestamp_ptr->load(std::memory_order_acquire);
+    if (max_transactions != 0 && unlinked_undo_buffers.size() == max_transactions) {
+      gc_run_limited_.store(true, std::memory_order_release);
+      break;
+    }
+
+    auto const commit_timestamp = linked_entry->commit_timestamp_->load(std::memory_order_acquire);
 
     // only process those that are no longer active
     if (commit_timestamp >= oldest_active_start_timestamp) {
@@ -2011,140 +2280,192 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
       continue;        // must continue to next transaction, because committed_transactions_ was not ordered
     }
 
-    // When unlinking a delta which is the first delta in its version chain,
-    // special care has to be taken to avoid the following race condition:
-    //
-    // [Vertex] --> [Delta A]
-    //
-    //    GC thread: Delta A is the first in its chain, it must be unlinked from
-    //               vertex and marked for deletion
-    //    TX thread: Update vertex and add Delta B with Delta A as next
-    //
-    // [Vertex] --> [Delta B] <--> [Delta A]
-    //
-    //    GC thread: Unlink delta from Vertex
-    //
-    // [Vertex] --> (nullptr)
-    //
-    // When processing a delta that is the first one in its chain, we
-    // obtain the corresponding vertex or edge lock, and then verify that this
-    // delta still is the first in its chain.
-    // When processing a delta that is in the middle of the chain we only
-    // process the final delta of the given transaction in that chain. We
-    // determine the owner of the chain (either a vertex or an edge), obtain the
-    // corresponding lock, and then verify that this delta is still in the same
-    // position as it was before taking the lock.
-    //
-    // Even though the delta chain is lock-free (both `next` and `prev`) the
-    // chain should not be modified without taking the lock from the object that
-    // owns the chain (either a vertex or an edge). Modifying the chain without
-    // taking the lock will cause subtle race conditions that will leave the
-    // chain in a broken state.
-    // The chain can be only read without taking any locks.
-
-    for (Delta &delta : linked_entry->deltas_) {
-      index_impact.update(delta.action);
-      while (true) {
-        auto prev = delta.prev.Get();
-        switch (prev.type) {
-          case PreviousPtr::Type::VERTEX: {
-            Vertex *vertex = prev.vertex;
-            auto vertex_guard = std::unique_lock{vertex->lock};
-            if (vertex->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            vertex->delta = nullptr;
-            if (vertex->deleted) {
-              DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
-              current_deleted_vertices.push_back(vertex->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::EDGE: {
-            Edge *edge = prev.edge;
-            auto edge_guard = std::unique_lock{edge->lock};
-            if (edge->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            edge->delta = nullptr;
-            if (edge->deleted) {
-              DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
-              current_deleted_edges.push_back(edge->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::DELTA: {
-            //              kTransactionInitialId
-            //                     │
-            //                     ▼
-            // ┌───────────────────┬─────────────┐
-            // │     Committed     │ Uncommitted │
-            // ├──────────┬────────┴─────────────┤
-            // │ Inactive │      Active          │
-            // └──────────┴──────────────────────┘
-            //            ▲
-            //            │
-            //  oldest_active_start_timestamp
-
-            if (prev.delta->timestamp == commit_timestamp_ptr) {
-              // The delta that is newer than this one is also a delta from this
-              // transaction. We skip the current delta and will remove it as a
-              // part of the suffix later.
+    // Will be unlinked, move to unlinked_undo_buffers
+    auto const to_move = linked_entry;
+    ++linked_entry;  // advanced to next before we move the list node
+    unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, to_move);
+  }
+
+  // The transactions are unlinked in chunks on the GC workers. Each chain is
+  // only changed under the lock of its owner, so the workers synchronize
+  // between themselves the same way they do with the running transactions.
+  struct UnlinkedObjects {
+    std::vector<Gid> deleted_vertices;
+    std::vector<Gid> deleted_edges;
+    IndexPerformanceTracker index_impact;
+  };
+  constexpr size_t kTransactionsPerChunk = 64;
+  std::vector<GCDeltas *> transactions_to_unlink;
+  transactions_to_unlink.reserve(unlinked_undo_buffers.size());
+  for (auto &gc_deltas : unlinked_undo_buffers) {
+    transactions_to_unlink.push_back(&gc_deltas);
+  }
+  auto const num_chunks = (transactions_to_unlink.size() + kTransactionsPerChunk - 1) / kTransactionsPerChunk;
+  std::vector<UnlinkedObjects> unlinked_per_chunk(num_chunks);
+
+  RunOnGcWorkers(num_chunks, [&](size_t chunk) {
+    auto &unlinked = unlinked_per_chunk[chunk];
+    auto const chunk_end = std::min((chunk + 1) * kTransactionsPerChunk, transactions_to_unlink.size());
+    for (auto i = chunk * kTransactionsPerChunk; i != chunk_end; ++i) {
+      auto &linked_entry = *transactions_to_unlink[i];
+      auto const *const commit_timestamp_ptr = linked_entry.commit_timestamp_.get();
+
+      // When unlinking a delta which is the first delta in its version chain,
+      // special care has to be taken to avoid the following race condition:
+      //
+      // [Vertex] --> [Delta A]
+      //
+      //    GC thread: Delta A is the first in its chain, it must be unlinked from
+      //               vertex and marked for deletion
+      //    TX thread: Update vertex and add Delta B with Delta A as next
+      //
+      // [Vertex] --> [Delta B] <--> [Delta A]
+      //
+      //    GC thread: Unlink delta from Vertex
+      //
+      // [Vertex] --> (nullptr)
+      //
+      // When processing a delta that is the first one in its chain, we
+      // obtain the corresponding vertex or edge lock, and then verify that this
+      // delta still is the first in its chain.
+      // When processing a delta that is in the middle of the chain we only
+      // process the final delta of the given transaction in that chain. We
+      // determine the owner of the chain (either a vertex or an edge), obtain the
+      // corresponding lock, and then verify that this delta is still in the same
+      // position as it was before taking the lock.
+      //
+      // Even though the delta chain is lock-free (both `next` and `prev`) the
+      // chain should not be modified without taking the lock from the object that
+      // owns the chain (either a vertex or an edge). Modifying the chain without
+      // taking the lock will cause subtle race conditions that will leave the
+      // chain in a broken state.
+      // The chain can be only read without taking any locks.
+
+      for (Delta &delta : linked_entry.deltas_) {
+        unlinked.index_impact.update(delta.action);
+        while (true) {
+          auto prev = delta.prev.Get();
+          switch (prev.type) {
+            case PreviousPtr::Type::VERTEX: {
+              Vertex *vertex = prev.vertex;
+              auto vertex_guard = std::unique_lock{vertex->lock};
+              if (vertex->delta != &delta) {
+                // Something changed, we're not the first delta in the chain
+                // anymore.
+                continue;
+              }
+              vertex->delta = nullptr;
+              if (vertex->deleted) {
+                DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
+                unlinked.deleted_vertices.push_back(vertex->gid);
+              }
               break;
             }
-
-            if (prev.delta->timestamp->load() < oldest_active_start_timestamp) {
-              // If previous is from another inactive transaction, no need to
-              // lock the edge/vertex, nothing will read this far or relink to
-              // us directly
+            case PreviousPtr::Type::EDGE: {
+              Edge *edge = prev.edge;
+              auto edge_guard = std::unique_lock{edge->lock};
+              if (edge->delta != &delta) {
+                // Something changed, we're not the first delta in the chain
+                // anymore.
+                continue;
+              }
+              edge->delta = nullptr;
+              if (edge->deleted) {
+                DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
+                unlinked.deleted_edges.push_back(edge->gid);
+              }
               break;
             }
+            case PreviousPtr::Type::DELTA: {
+              //              kTransactionInitialId
+              //                     │
+              //                     ▼
+              // ┌───────────────────┬─────────────┐
+              // │     Committed     │ Uncommitted │
+              // ├──────────┬────────┴─────────────┤
+              // │ Inactive │      Active          │
+              // └──────────┴──────────────────────┘
+              //            ▲
+              //            │
+              //  oldest_active_start_timestamp
+
+              if (prev.delta->timestamp == commit_timestamp_ptr) {
+                // The delta that is newer than this one is also a delta from this
+                // transaction. We skip the current delta and will remove it as a
+                // part of the suffix later.
+                break;
+              }
 
-            // Previous is either active (committed or uncommitted), we need to find
-            // the parent object in order to be able to use its lock.
-            auto parent = prev;
-            while (parent.type == PreviousPtr::Type::DELTA) {
-              parent = parent.delta->prev.Get();
-            }
+              if (prev.delta->timestamp->load() < oldest_active_start_timestamp) {
+                // If previous is from another inactive transaction, no need to
+                // lock the edge/vertex, nothing will read this far or relink to
+                // us directly
+                break;
+              }
 
-            auto const guard = std::invoke([&] {
-              switch (parent.type) {
-                case PreviousPtr::Type::VERTEX:
-                  return std::unique_lock{parent.vertex->lock};
-                case PreviousPtr::Type::EDGE:
-                  return std::unique_lock{parent.edge->lock};
-                case PreviousPtr::Type::DELTA:
-                case PreviousPtr::Type::NULLPTR:
-                  LOG_FATAL("Invalid database state!");
+              // Previous is either active (committed or uncommitted), we need to find
+              // the parent object in order to be able to use its lock.
+              auto parent = prev;
+              while (parent.type == PreviousPtr::Type::DELTA) {
+                parent = parent.delta->prev.Get();
               }
-            });
-            if (delta.prev.Get() != prev) {
-              // Something changed, we could now be the first delta in the
-              // chain.
-              continue;
+              if (parent.type == PreviousPtr::Type::NULLPTR) {
+                // A delta on the way was merged at commit, so the chain
+                // changed.
+                continue;
+              }
+
+              auto const guard = std::invoke([&] {
+                switch (parent.type) {
+                  case PreviousPtr::Type::VERTEX:
+                    return std::unique_lock{parent.vertex->lock};
+                  case PreviousPtr::Type::EDGE:
+                    return std::unique_lock{parent.edge->lock};
+                  case PreviousPtr::Type::DELTA:
+                  case PreviousPtr::Type::NULLPTR:
+                    LOG_FATAL("Invalid database state!");
+                }
+              });
+              if (delta.prev.Get() != prev) {
+                // Something changed, we could now be the first delta in the
+                // chain.
+                continue;
+              }
+              Delta *prev_delta = prev.delta;
+              prev_delta->next.store(nullptr, std::memory_order_release);
+              break;
+            }
+            case PreviousPtr::Type::NULLPTR: {
+              // The delta was merged with an older one at commit and is
+              // already unlinked.
+              break;
             }
-            Delta *prev_delta = prev.delta;
-            prev_delta->next.store(nullptr, std::memory_order_release);
-            break;
-          }
-          case PreviousPtr::Type::NULLPTR: {
-            LOG_FATAL("Invalid pointer!");
           }
+          break;
         }
-        break;
       }
     }
+  });
 
-    // Now unlinked, move to unlinked_undo_buffers
-    auto const to_move = linked_entry;
-    ++linked_entry;  // advanced to next before we move the list node
-    unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, to_move);
+  for (auto &unlinked : unlinked_per_chunk) {
+    current_deleted_vertices.insert(current_deleted_vertices.end(), unlinked.deleted_vertices.begin(),
+                                    unlinked.deleted_vertices.end());
+    current_deleted_edges.insert(current_deleted_edges.end(), unlinked.deleted_edges.begin(),
+                                 unlinked.deleted_edges.end());
+    index_impact.merge(unlinked.index_impact);
   }
 
+  // Transactions left for the following runs, and how long the oldest of them has been waiting
+  auto const gc_backlog = linked_undo_buffers.size();
+  auto gc_lag = std::chrono::steady_clock::duration::zero();
+  auto const now = std::chrono::steady_clock::now();
+  for (auto const &gc_deltas : linked_undo_buffers) {
+    gc_lag = std::max(gc_lag, now - gc_deltas.handed_over_);
+  }
+  memgraph::metrics::SetGaugeValue(memgraph::metrics::GCBacklogTransactions, gc_backlog);
+  memgraph::metrics::SetGaugeValue(memgraph::metrics::GCLag_ms,
+                                   std::chrono::duration_cast<std::chrono::milliseconds>(gc_lag).count());
+
   if (!linked_undo_buffers.empty()) {
     // some were not able to be collected, add them back to committed_transactions_ for the next GC run
     committed_transactions_.WithLock([&linked_undo_buffers](auto &committed_transactions) {
@@ -2177,15 +2498,35 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // after the last currently active transaction is finished.
   // This operation is very expensive as it traverses through all of the items
   // in every index every time.
+  // The indices and constraints don't share any state, so each of them is
+  // cleaned up by a separate task on the GC workers.
   if (auto token = stop_source.get_token(); !token.stop_requested()) {
+    std::vector<std::function<void()>> cleanup_tasks;
     if (index_cleanup_vertex_needed || index_cleanup_vertex_performance) {
-      indices_.RemoveObsoleteVertexEntries(oldest_active_start_timestamp, token);
-      auto *mem_unique_constraints = static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get());
-      mem_unique_constraints->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      cleanup_tasks.emplace_back([&] {
+        static_cast<InMemoryLabelIndex *>(indices_.label_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      });
+      cleanup_tasks.emplace_back([&] {
+        static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      });
+      cleanup_tasks.emplace_back([&] {
+        static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      });
     }
     if (index_cleanup_edge_needed || index_cleanup_edge_performance) {
-      indices_.RemoveObsoleteEdgeEntries(oldest_active_start_timestamp, token);
+      cleanup_tasks.emplace_back([&] {
+        static_cast<InMemoryEdgeTypeIndex *>(indices_.edge_type_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      });
+      cleanup_tasks.emplace_back([&] {
+        static_cast<InMemoryEdgeTypePropertyIndex *>(indices_.edge_type_property_index_.get())
+            ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+      });
     }
+    RunOnGcWorkers(cleanup_tasks.size(), [&](size_t task) { cleanup_tasks[task](); });
   }
 
   {
@@ -2265,12 +2606,47 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
       }
     }
   }
+
+  memgraph::metrics::Measure(memgraph::metrics::GCLatency_us,
+                             std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count());
 }
 
 // tell the linker he can find the CollectGarbage definitions here
 template void InMemoryStorage::CollectGarbage<true>(std::unique_lock<utils::ResourceLock> main_guard, bool periodic);
 template void InMemoryStorage::CollectGarbage<false>(std::unique_lock<utils::ResourceLock> main_guard, bool periodic);
 
+void InMemoryStorage::RunOnGcWorkers(size_t num_tasks, const std::function<void(size_t)> &task) {
+  std::atomic<size_t> next_task{0};
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> first_error;
+  auto run_tasks = [&] {
+    try {
+      for (auto i = next_task.fetch_add(1, std::memory_order_acq_rel); i < num_tasks;
+           i = next_task.fetch_add(1, std::memory_order_acq_rel)) {
+        task(i);
+      }
+    } catch (...) {
+      // Stop the other workers from taking new tasks
+      next_task.store(num_tasks, std::memory_order_release);
+      first_error.WithLock([](auto &error) {
+        if (!error) error = std::current_exception();
+      });
+    }
+  };
+
+  auto const num_helpers = gc_workers_ && num_tasks > 1 ? std::min(config_.gc.workers - 1, num_tasks - 1) : 0;
+  std::latch helpers_done{static_cast<std::ptrdiff_t>(num_helpers)};
+  for (size_t i = 0; i < num_helpers; ++i) {
+    gc_workers_->AddTask([&] {
+      run_tasks();
+      helpers_done.count_down();
+    });
+  }
+  run_tasks();
+  helpers_done.wait();
+
+  if (auto error = *first_error.Lock()) std::rethrow_exception(error);
+}
+
 StorageInfo InMemoryStorage::GetBaseInfo() {
   StorageInfo info{};
   info.vertex_count = vertices_.size();
@@ -2341,27 +2717,91 @@ bool InMemoryStorage::InitializeWalFile(memgraph::replication::ReplicationEpoch
   if (!wal_file_) {
     wal_file_.emplace(recovery_.wal_directory_, uuid(), epoch.id(), config_.salient.items, name_id_mapper_.get(),
                       wal_seq_num_++, &file_retainer_);
+    std::lock_guard sync_guard{wal_sync_lock_};
+    wal_sync_file_ = &*wal_file_;
   }
 
   return true;
 }
 
 void InMemoryStorage::FinalizeWalFile() {
-  ++wal_unsynced_transactions_;
-  if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
-    wal_file_->Sync();
-    wal_unsynced_transactions_ = 0;
+  if (config_.durability.wal_group_commit) {
+    // The committer syncs the file once the engine lock is released.
+    ++wal_appended_ticket_;
+  } else {
+    ++wal_unsynced_transactions_;
+    if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
+      wal_file_->Sync();
+      wal_unsynced_transactions_ = 0;
+    }
   }
   if (wal_file_->GetSize() / 1024 >= config_.durability.wal_file_size_kibibytes) {
-    wal_file_->FinalizeWal();
-    wal_file_ = std::nullopt;
+    ResetWalFile(true);
     wal_unsynced_transactions_ = 0;
   } else {
     // Try writing the internal buffer if possible, if not
     // the data should be written as soon as it's possible
     // (triggered by the new transaction commit, or some
     // reading thread EnabledFlushing)
-    wal_file_->TryFlushing();
+    if (wal_file_->TryFlushing() && config_.durability.wal_group_commit) {
+      wal_written_ticket_.store(wal_appended_ticket_, std::memory_order_release);
+    }
+  }
+}
+
+void InMemoryStorage::ResetWalFile(bool finalize) {
+  {
+    // The file can't be closed while a group commit is syncing it.
+    std::unique_lock sync_guard{wal_sync_lock_};
+    wal_sync_cv_.wait(sync_guard, [this] { return !wal_sync_in_progress_; });
+    if (wal_file_ && finalize) {
+      // Finalizing syncs the file, so everything written so far is durable.
+      wal_file_->FinalizeWal();
+    }
+    wal_file_.reset();
+    wal_sync_file_ = nullptr;
+    wal_written_ticket_.store(wal_appended_ticket_, std::memory_order_release);
+    wal_synced_ticket_ = wal_appended_ticket_;
+  }
+  wal_sync_cv_.notify_all();
+}
+
+void InMemoryStorage::WaitForWalSync(uint64_t ticket) {
+  std::unique_lock sync_guard{wal_sync_lock_};
+  while (wal_synced_ticket_ < ticket) {
+    if (wal_sync_in_progress_) {
+      wal_sync_cv_.wait(sync_guard);
+      continue;
+    }
+    // No sync is running, so this committer syncs the file on behalf of every
+    // transaction written so far.
+    wal_sync_in_progress_ = true;
+    auto *file = wal_sync_file_;
+    const auto target_ticket = wal_written_ticket_.load(std::memory_order_acquire);
+    sync_guard.unlock();
+    if (target_ticket < ticket) {
+      // A replica was reading the internal buffer when the transaction was
+      // written, so it is still in the buffer. Wait until the replica is done
+      // without holding the engine lock, then write the buffer under it.
+      if (file) file->WaitForFlushing();
+      sync_guard.lock();
+      wal_sync_in_progress_ = false;
+      wal_sync_cv_.notify_all();
+      sync_guard.unlock();
+      {
+        auto engine_guard = std::unique_lock{engine_lock_};
+        if (wal_file_ && wal_file_->TryFlushing()) {
+          wal_written_ticket_.store(wal_appended_ticket_, std::memory_order_release);
+        }
+      }
+      sync_guard.lock();
+      continue;
+    }
+    if (file) file->SyncWritten();
+    sync_guard.lock();
+    wal_sync_in_progress_ = false;
+    wal_synced_ticket_ = std::max(wal_synced_ticket_, target_ticket);
+    wal_sync_cv_.notify_all();
   }
 }
 
@@ -2444,6 +2884,14 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
         });
         break;
       }
+      case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        apply_encode(op, [&](durability::BaseEncoder &encoder) {
+          EncodeLabelPropertyList(encoder, *name_id_mapper_, md_delta.label_property_composite.label,
+                                  md_delta.label_property_composite.properties);
+        });
+        break;
+      }
       case MetadataDelta::Action::LABEL_INDEX_STATS_SET: {
         apply_encode(op, [&](durability::BaseEncoder &encoder) {
           EncodeLabelStats(encoder, *name_id_mapper_, md_delta.label_stats.label, md_delta.label_stats.stats);
@@ -2661,7 +3109,7 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
 }
 
 utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::CreateSnapshot(
-    memgraph::replication_coordination_glue::ReplicationRole replication_role) {
+    memgraph::replication_coordination_glue::ReplicationRole replication_role, bool periodic) {
   using memgraph::replication_coordination_glue::ReplicationRole;
   if (replication_role == ReplicationRole::REPLICA) {
     return InMemoryStorage::CreateSnapshotError::DisabledForReplica;
@@ -2669,6 +3117,30 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::Create
 
   std::lock_guard snapshot_guard(snapshot_lock_);
 
+  // Read before the snapshot transaction starts, so changes committed in the
+  // meantime are counted against the next snapshot.
+  const auto data_resets = data_resets_.load(std::memory_order_acquire);
+  const auto committed_deltas = committed_deltas_.load(std::memory_order_acquire);
+  if (periodic && last_snapshot_ && last_snapshot_->data_resets == data_resets &&
+      storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    const auto threshold = config_.durability.snapshot_skip_threshold_percent;
+    if (threshold != 0) {
+      // Every commit with a timestamp older than the last snapshot's start timestamp is contained in it.
+      if (last_data_commit_timestamp_.load(std::memory_order_acquire) < last_snapshot_->start_timestamp) {
+        spdlog::info("Skipping snapshot creation, nothing changed since the last snapshot.");
+        return {};
+      }
+      // The changes since the last snapshot are durable in the WAL files, recovery replays them on top of it.
+      const auto changes = committed_deltas - last_snapshot_->committed_deltas;
+      if (config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL &&
+          changes * 100 < threshold * std::max(last_snapshot_->object_count, uint64_t{1})) {
+        spdlog::info("Skipping snapshot creation, {} changes since the last snapshot are kept in the WAL files.",
+                     changes);
+        return {};
+      }
+    }
+  }
+
   auto accessor = std::invoke([&]() {
     if (storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL) {
       // For analytical no other txn can be in play
@@ -2682,6 +3154,10 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::Create
   auto const &epoch = repl_storage_state_.epoch_;
   durability::CreateSnapshot(this, transaction, recovery_.snapshot_directory_, recovery_.wal_directory_, &vertices_,
                              &edges_, uuid(), epoch, repl_storage_state_.history, &file_retainer_);
+  last_snapshot_ = LastSnapshot{.start_timestamp = transaction->start_timestamp,
+                                .committed_deltas = committed_deltas,
+                                .object_count = vertices_.size() + edges_.size(),
+                                .data_resets = data_resets};
 
   memgraph::metrics::Measure(memgraph::metrics::SnapshotCreationLatency_us,
                              std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count());
@@ -2697,10 +3173,10 @@ uint64_t InMemoryStorage::GetCommitTimestamp() { return timestamp_++; }
 void InMemoryStorage::PrepareForNewEpoch() {
   std::unique_lock engine_guard{engine_lock_};
   if (wal_file_) {
-    wal_file_->FinalizeWal();
-    wal_file_.reset();
+    ResetWalFile(true);
   }
   repl_storage_state_.TrackLatestHistory();
+  data_resets_.fetch_add(1, std::memory_order_acq_rel);
 }
 
 utils::FileRetainer::FileLockerAccessor::ret_type InMemoryStorage::IsPathLocked() {
@@ -2809,6 +3285,18 @@ std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>> InMemoryStora
   return maybe_edge_info;
 }
 
+void InMemoryStorage::SetupStringDictionary() {
+  string_dictionary_.reset();
+  for (const auto &name : config_.salient.items.dictionary_encoded_properties) {
+    auto property = utils::Trim(name);
+    if (property.empty()) continue;
+    if (!string_dictionary_) {
+      string_dictionary_ = std::make_unique<StringDictionary>(config_.salient.items.dictionary_max_strings);
+    }
+    string_dictionary_->EnableEncoding(NameToProperty(property));
+  }
+}
+
 void InMemoryStorage::Clear() {
   // NOTE: Make sure this function is called while exclusively holding on to the main lock
   // When creating a snapshot, we first lock the snapshot, then create and accessor
@@ -2829,10 +3317,12 @@ void InMemoryStorage::Clear() {
 
   timestamp_ = kTimestampInitialId;
   transaction_id_ = kTransactionInitialId;
+  last_data_commit_timestamp_ = 0;
+  data_resets_.fetch_add(1, std::memory_order_acq_rel);
 
   // Reset WALs
   wal_seq_num_ = 0;
-  wal_file_.reset();
+  ResetWalFile(false);
   wal_unsynced_transactions_ = 0;
 
   // Reset the commit log
@@ -2859,6 +3349,9 @@ void InMemoryStorage::Clear() {
   name_id_mapper_ = std::make_unique<NameIdMapper>();
   enum_store_.clear();
   schema_info_.clear();
+  // No vertex or edge references the interned strings anymore and the
+  // property ids changed with the new name id mapper
+  SetupStringDictionary();
 
   // Replication epoch and timestamp reset
   repl_storage_state_.epoch_.SetEpoch(std::string(utils::UUID{}));
@@ -2879,7 +3372,8 @@ IndicesInfo InMemoryStorage::InMemoryAccessor::ListAllIndices() const {
 
   return {mem_label_index->ListIndices(),     mem_label_property_index->ListIndices(),
           mem_edge_type_index->ListIndices(), mem_edge_type_property_index->ListIndices(),
-          text_index.ListIndices(),           point_index.ListIndices()};
+          text_index.ListIndices(),           point_index.ListIndices(),
+          mem_label_property_index->ListCompositeIndices()};
 }
 ConstraintsInfo InMemoryStorage::InMemoryAccessor::ListAllConstraints() const {
   const auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
@@ -11,9 +11,12 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
@@ -36,6 +39,7 @@
 #include "utils/memory.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::dbms {
 class InMemoryReplicationHandlers;
@@ -74,6 +78,11 @@ struct IndexPerformanceTracker {
     }
   }
 
+  void merge(const IndexPerformanceTracker &other) {
+    impacts_vertex_indexes_ = impacts_vertex_indexes_ || other.impacts_vertex_indexes_;
+    impacts_edge_indexes_ = impacts_edge_indexes_ || other.impacts_edge_indexes_;
+  }
+
   bool impacts_vertex_indexes() { return impacts_vertex_indexes_; }
   bool impacts_edge_indexes() { return impacts_edge_indexes_; }
 
@@ -150,6 +159,15 @@ class InMemoryStorage final : public Storage {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              const std::vector<PropertyValue> &prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
+    std::vector<VerticesIterable> ChunkedVertices(View view, size_t num_chunks) override;
+
+    std::vector<VerticesIterable> ChunkedVertices(LabelId label, View view, size_t num_chunks) override;
+
     std::optional<EdgeAccessor> FindEdge(Gid gid, View view) override;
 
     EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
@@ -200,6 +218,21 @@ class InMemoryStorage final : public Storage {
           label, property, lower, upper);
     }
 
+    /// Return approximate number of vertices in the composite index over the
+    /// given label and properties.
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const override {
+      return static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get())
+          ->ApproximateVertexCount(label, properties);
+    }
+
+    /// Return approximate number of vertices with the given label and the given
+    /// values of all the properties of the composite index.
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                    const std::vector<PropertyValue> &values) const override {
+      return static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get())
+          ->ApproximateVertexCount(label, properties, values);
+    }
+
     uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const override {
       return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_index_->ApproximateEdgeCount(edge_type);
     }
@@ -285,6 +318,16 @@ class InMemoryStorage final : public Storage {
       return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyIndexExists(LabelId label, const std::vector<PropertyId> &properties) const override {
+      return static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get())
+          ->IndexExists(label, properties);
+    }
+
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListCompositeIndices() const override {
+      return static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get())
+          ->ListCompositeIndices();
+    }
+
     bool EdgeTypeIndexExists(EdgeTypeId edge_type) const override {
       return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_index_->IndexExists(edge_type);
     }
@@ -333,6 +376,15 @@ class InMemoryStorage final : public Storage {
     /// @throw std::bad_alloc
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label, PropertyId property) override;
 
+    /// Create a composite index over the ordered list of properties.
+    /// Returns void if the index has been created.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+    /// * `IndexDefinitionError`: the index already exists.
+    /// @throw std::bad_alloc
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+        LabelId label, const std::vector<PropertyId> &properties) override;
+
     /// Create an index.
     /// Returns void if the index has been created.
     /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
@@ -365,6 +417,14 @@ class InMemoryStorage final : public Storage {
     /// * `IndexDefinitionError`: the index does not exist.
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label, PropertyId property) override;
 
+    /// Drop an existing composite index.
+    /// Returns void if the index has been dropped.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+    /// * `IndexDefinitionError`: the index does not exist.
+    utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+        LabelId label, const std::vector<PropertyId> &properties) override;
+
     /// Drop an existing index.
     /// Returns void if the index has been dropped.
     /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
@@ -449,6 +509,12 @@ class InMemoryStorage final : public Storage {
     /// Duiring commit, in some cases you do not need to hand over deltas to GC
     /// in those cases this method is a light weight way to unlink and discard our deltas
     void FastDiscardOfDeltas(std::unique_lock<std::mutex> gc_guard);
+    /// During commit, while holding the engine lock and before the transaction
+    /// is marked as finished, unlinks the property deltas of this transaction
+    /// which are followed by an older delta on the same property that every
+    /// reader applies as well, so reads of objects updated over and over don't
+    /// walk long delta chains. The deltas stay in the transaction for the GC.
+    void MergePropertyDeltas();
     void GCRapidDeltaCleanup(std::list<Gid> &current_deleted_edges, std::list<Gid> &current_deleted_vertices,
                              IndexPerformanceTracker &impact_tracker);
     SalientConfig::Items config_;
@@ -482,8 +548,10 @@ class InMemoryStorage final : public Storage {
   utils::FileRetainer::FileLockerAccessor::ret_type LockPath();
   utils::FileRetainer::FileLockerAccessor::ret_type UnlockPath();
 
+  /// Periodic snapshots are skipped while the changes committed since the
+  /// last snapshot stay below `snapshot_skip_threshold_percent`.
   utils::BasicResult<InMemoryStorage::CreateSnapshotError> CreateSnapshot(
-      memgraph::replication_coordination_glue::ReplicationRole replication_role);
+      memgraph::replication_coordination_glue::ReplicationRole replication_role, bool periodic = false);
 
   void CreateSnapshotHandler(std::function<utils::BasicResult<InMemoryStorage::CreateSnapshotError>()> cb);
 
@@ -491,9 +559,18 @@ class InMemoryStorage final : public Storage {
 
   void SetStorageMode(StorageMode storage_mode);
 
+  /// Rewrites the edge lists of every vertex into the frozen adjacency order,
+  /// so expansions filtered by edge type can binary search them. Blocks all
+  /// transactions while running.
+  void FreezeAdjacency();
+
   const durability::Recovery &GetRecovery() const noexcept { return recovery_; }
 
  private:
+  /// Same as `FreezeAdjacency`, but the caller must already have exclusive
+  /// access to the storage.
+  void FreezeAdjacencyExclusive();
+
   /// The force parameter determines the behaviour of the garbage collector.
   /// If it's set to true, it will behave as a global operation, i.e. it can't
   /// be part of a transaction, and no other transaction can be active at the same time.
@@ -508,8 +585,18 @@ class InMemoryStorage final : public Storage {
   template <bool force>
   void CollectGarbage(std::unique_lock<utils::ResourceLock> main_guard, bool periodic);
 
+  /// Runs `task` for every index in [0, num_tasks) on the calling thread and
+  /// the GC workers, and returns once all of them are done.
+  void RunOnGcWorkers(size_t num_tasks, const std::function<void(size_t)> &task);
+
   bool InitializeWalFile(memgraph::replication::ReplicationEpoch &epoch);
   void FinalizeWalFile();
+  /// Finalizes (if `finalize` is set) and closes the current WAL file. Must be
+  /// called while holding the engine lock.
+  void ResetWalFile(bool finalize);
+  /// Blocks until the WAL is synced up to the given group commit ticket. Must
+  /// be called without holding the engine lock.
+  void WaitForWalSync(uint64_t ticket);
 
   StorageInfo GetBaseInfo() override;
   StorageInfo GetInfo() override;
@@ -563,12 +650,46 @@ class InMemoryStorage final : public Storage {
   utils::Scheduler snapshot_runner_;
   utils::SpinLock snapshot_lock_;
 
+  // State of the data when the last snapshot was taken, guarded by
+  // `snapshot_lock_`. Used to skip periodic snapshots which would rewrite
+  // (almost) the same data.
+  struct LastSnapshot {
+    uint64_t start_timestamp;
+    uint64_t committed_deltas;
+    uint64_t object_count;
+    uint64_t data_resets;
+  };
+  std::optional<LastSnapshot> last_snapshot_;
+  // Updated by every commit that changed the data.
+  std::atomic<uint64_t> last_data_commit_timestamp_{0};
+  std::atomic<uint64_t> committed_deltas_{0};
+  // Incremented whenever the data changes without going through `Commit`
+  // (analytical mode, clearing the storage, a new epoch). The next periodic
+  // snapshot is then always created.
+  std::atomic<uint64_t> data_resets_{0};
+
   // Sequence number used to keep track of the chain of WALs.
   uint64_t wal_seq_num_{0};
 
   std::optional<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
 
+  // Group commit. Transactions are appended to the WAL file under the engine
+  // lock, each one taking the next ticket. A ticket is written once the
+  // internal buffer of the file is flushed, which doesn't happen while a
+  // replica reads the buffer. The `fsync` is issued after the engine lock is
+  // released by one of the waiting committers and covers all tickets written
+  // up to that point.
+  std::mutex wal_sync_lock_;
+  std::condition_variable wal_sync_cv_;
+  // File the group commit syncs, guarded by `wal_sync_lock_`.
+  durability::WalFile *wal_sync_file_{nullptr};
+  bool wal_sync_in_progress_{false};
+  uint64_t wal_synced_ticket_{0};
+  std::atomic<uint64_t> wal_written_ticket_{0};
+  // Guarded by the engine lock.
+  uint64_t wal_appended_ticket_{0};
+
   utils::FileRetainer file_retainer_;
 
   // Global locker that is used for clients file locking
@@ -582,6 +703,12 @@ class InMemoryStorage final : public Storage {
 
   utils::Scheduler gc_runner_;
   std::mutex gc_lock_;
+  // Helps the GC thread unlink deltas and clean up the indices, null unless
+  // more than one GC worker is configured.
+  std::unique_ptr<utils::ThreadPool> gc_workers_;
+  // Set when a periodic GC run left transactions for the next run because of
+  // `Config::Gc::max_transactions_per_run`.
+  std::atomic<bool> gc_run_limited_{false};
 
   struct GCDeltas {
     GCDeltas(uint64_t mark_timestamp, delta_container deltas, std::unique_ptr<std::atomic<uint64_t>> commit_timestamp)
@@ -593,6 +720,7 @@ class InMemoryStorage final : public Storage {
     uint64_t mark_timestamp_{};                                  //!< a timestamp no active transaction currently has
     delta_container deltas_;                                     //!< the deltas that need cleaning
     std::unique_ptr<std::atomic<uint64_t>> commit_timestamp_{};  //!< the timestamp the deltas are pointing at
+    std::chrono::steady_clock::time_point handed_over_{std::chrono::steady_clock::now()};  //!< when GC got the deltas
   };
 
   // Ownership of linked deltas is transferred to committed_transactions_ once transaction is commited
@@ -624,6 +752,10 @@ class InMemoryStorage final : public Storage {
   // A way to tell async operation to stop
   std::stop_source stop_source;
 
+  /// (Re)creates the string dictionary of the configured dictionary encoded
+  /// properties. Must only be called while no property store references it.
+  void SetupStringDictionary();
+
   void Clear();
 };
 
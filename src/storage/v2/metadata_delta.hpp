@@ -12,6 +12,7 @@
 #pragma once
 
 #include <set>
+#include <vector>
 
 #include "storage/v2/constraints/type_constraints.hpp"
 #include "storage/v2/id_types.hpp"
@@ -48,6 +49,8 @@ struct MetadataDelta {
     ENUM_ALTER_UPDATE,
     POINT_INDEX_CREATE,
     POINT_INDEX_DROP,
+    LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
   };
 
   static constexpr struct LabelIndexCreate {
@@ -66,6 +69,10 @@ struct MetadataDelta {
   } point_index_drop;
   static constexpr struct LabelPropertyIndexDrop {
   } label_property_index_drop;
+  static constexpr struct LabelPropertyCompositeIndexCreate {
+  } label_property_composite_index_create;
+  static constexpr struct LabelPropertyCompositeIndexDrop {
+  } label_property_composite_index_drop;
   static constexpr struct LabelPropertyIndexStatsSet {
   } label_property_index_stats_set;
   static constexpr struct LabelPropertyIndexStatsClear {
@@ -116,6 +123,12 @@ struct MetadataDelta {
   MetadataDelta(LabelPropertyIndexDrop /*tag*/, LabelId label, PropertyId property)
       : action(Action::LABEL_PROPERTY_INDEX_DROP), label_property{label, property} {}
 
+  MetadataDelta(LabelPropertyCompositeIndexCreate /*tag*/, LabelId label, std::vector<PropertyId> properties)
+      : action(Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE), label_property_composite{label, std::move(properties)} {}
+
+  MetadataDelta(LabelPropertyCompositeIndexDrop /*tag*/, LabelId label, std::vector<PropertyId> properties)
+      : action(Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP), label_property_composite{label, std::move(properties)} {}
+
   MetadataDelta(LabelPropertyIndexStatsSet /*tag*/, LabelId label, PropertyId property,
                 LabelPropertyIndexStats const &stats)
       : action(Action::LABEL_PROPERTY_INDEX_STATS_SET), label_property_stats{label, property, stats} {}
@@ -207,6 +220,11 @@ struct MetadataDelta {
         std::destroy_at(&label_properties);
         break;
       }
+      case LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      case LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        std::destroy_at(&label_property_composite);
+        break;
+      }
       case TEXT_INDEX_CREATE:
       case TEXT_INDEX_DROP: {
         std::destroy_at(&text_index);
@@ -232,6 +250,11 @@ struct MetadataDelta {
       std::set<PropertyId> properties;
     } label_properties;
 
+    struct {
+      LabelId label;
+      std::vector<PropertyId> properties;
+    } label_property_composite;
+
     struct {
       LabelId label;
       LabelIndexStats stats;
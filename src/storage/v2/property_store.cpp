@@ -27,6 +27,7 @@
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
 #include "utils/compressor.hpp"
@@ -37,6 +38,11 @@
 DEFINE_bool(storage_property_store_compression_enabled, false,
             "Controls whether the properties should be compressed in the storage.");
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_property_store_directory_threshold, 16,
+              "Number of properties from which a property store keeps a directory of property offsets, so that a "
+              "single property can be found without decoding the ones before it. 0 disables the directory.");
+
 namespace memgraph::storage {
 
 namespace {
@@ -146,6 +152,10 @@ const uint8_t kShiftIdSize = 2;
 //     - encoded property ID
 //     - encoded string size
 //     - string data
+//     - top level values of properties with dictionary encoding enabled use
+//       INT64 as the payload size, which is never needed for a string size
+//       because buffers are limited to 4GB; their payload is the address of
+//       the string interned in the `StringDictionary` of the storage
 //   * LIST
 //     - type; payload size is used to indicate whether the list size is encoded
 //       as `uint8_t`, `uint16_t`, `uint32_t` or `uint32_t`
@@ -202,6 +212,8 @@ const uint8_t kShiftIdSize = 2;
 //     - encoded property ID
 //     - encoded value as 2 (for 2D) or 3 (for 3D) doubles forced to be encoded as int64
 
+const auto kDictionaryStringSize = Size::INT64;
+
 const auto TZ_NAME_LENGTH_SIZE = Size::INT8;
 // As the underlying type for zoned temporal data is std::chrono::zoned_time, valid timezone names are limited
 // to those in the IANA time zone database.
@@ -800,6 +812,12 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
       return true;
     }
     case Type::STRING: {
+      if (payload_size == kDictionaryStringSize) {
+        auto address = reader->ReadUint(kDictionaryStringSize);
+        if (!address) return false;
+        value = PropertyValue(*reinterpret_cast<const std::string *>(*address));
+        return true;
+      }
       auto size = reader->ReadUint(payload_size);
       if (!size) return false;
       std::string str_v(*size, '\0');
@@ -897,6 +915,10 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
       return true;
     }
     case Type::STRING: {
+      if (payload_size == kDictionaryStringSize) {
+        property_size += SizeToByteSize(kDictionaryStringSize);
+        return reader->SkipBytes(SizeToByteSize(kDictionaryStringSize));
+      }
       auto size = reader->ReadUint(payload_size);
       if (!size) return false;
       property_size += SizeToByteSize(payload_size);
@@ -1003,6 +1025,7 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
       return reader->ReadDouble(payload_size).has_value();
     }
     case Type::STRING: {
+      if (payload_size == kDictionaryStringSize) return reader->SkipBytes(SizeToByteSize(kDictionaryStringSize));
       auto size = reader->ReadUint(payload_size);
       if (!size) return false;
       if (!reader->SkipBytes(*size)) return false;
@@ -1104,6 +1127,11 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
     case Type::STRING: {
       if (!value.IsString()) return false;
       const auto &str = value.ValueString();
+      if (payload_size == kDictionaryStringSize) {
+        auto address = reader->ReadUint(kDictionaryStringSize);
+        if (!address) return false;
+        return *reinterpret_cast<const std::string *>(*address) == str;
+      }
       auto size = reader->ReadUint(payload_size);
       if (!size) return false;
       if (*size != str.size()) return false;
@@ -1188,14 +1216,26 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
 }
 
 // Function used to encode a property (PropertyId, PropertyValue) into a byte
-// stream.
-bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value) {
+// stream. String values of properties encoded by `dictionary` are interned in
+// it, unless they are short enough to be stored inline in the same space or
+// the dictionary is full.
+bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value,
+                    StringDictionary *dictionary = nullptr) {
   auto metadata = writer->WriteMetadata();
   if (!metadata) return false;
 
   auto id_size = writer->WriteUint(property.AsUint());
   if (!id_size) return false;
 
+  if (dictionary && value.IsString() && value.ValueString().size() > sizeof(uint64_t) &&
+      dictionary->IsEncoded(property)) {
+    if (const auto *interned = dictionary->Intern(value.ValueString()); interned != nullptr) {
+      if (!writer->InternalWriteInt<uint64_t>(reinterpret_cast<uintptr_t>(interned))) return false;
+      metadata->Set({Type::STRING, *id_size, kDictionaryStringSize});
+      return true;
+    }
+  }
+
   auto type_property_size = EncodePropertyValue(writer, value);
   if (!type_property_size) return false;
 
@@ -1860,6 +1900,122 @@ auto GetDecodedBuffer(uint8_t const (&buffer)[12]) -> DecodedBufferConst {
   }
 }
 
+// Stores holding many properties are prefixed with a directory of property
+// offsets so that a single property can be found with a binary search instead
+// of decoding all of the properties in front of it. The directory is encoded
+// as follows:
+//   * directory marker (metadata byte with a type that isn't used otherwise)
+//   * number of properties as `uint32_t`
+//   * for each property its ID and its offset from the first property, both
+//     as `uint32_t`
+//
+// The properties following the directory are encoded exactly as in a store
+// without a directory, so sequential readers only need to skip it. The
+// directory is removed before the store is modified and rebuilt afterwards.
+const uint8_t kDirectoryMarker = 0xf0;
+const uint32_t kDirectoryHeaderSize = sizeof(uint8_t) + sizeof(uint32_t);
+const uint32_t kDirectoryEntrySize = 2 * sizeof(uint32_t);
+
+uint32_t ReadDirectoryUint(std::span<uint8_t const> view, uint32_t offset) {
+  uint32_t value = 0;
+  memcpy(&value, view.data() + offset, sizeof(value));
+  return value;
+}
+
+uint32_t DirectorySize(std::span<uint8_t const> view) {
+  if (view.empty() || view[0] != kDirectoryMarker) return 0;
+  return kDirectoryHeaderSize + (ReadDirectoryUint(view, sizeof(uint8_t)) * kDirectoryEntrySize);
+}
+
+// Returns a reader of the encoded properties. If `property` is given and the
+// store has a directory, the reader starts at that property or is empty if
+// the store doesn't contain it.
+Reader MakeReader(std::span<uint8_t const> view, std::optional<PropertyId> property) {
+  const auto directory_size = DirectorySize(view);
+  if (directory_size == 0) return {view.data(), static_cast<uint32_t>(view.size_bytes())};
+
+  auto properties = view.subspan(directory_size);
+  const auto properties_size = static_cast<uint32_t>(properties.size_bytes());
+  if (!property) return {properties.data(), properties_size};
+
+  auto entry_offset = [](uint32_t index) { return kDirectoryHeaderSize + (index * kDirectoryEntrySize); };
+  const auto count = ReadDirectoryUint(view, sizeof(uint8_t));
+  uint32_t low = 0;
+  uint32_t high = count;
+  while (low < high) {
+    const uint32_t middle = low + ((high - low) / 2);
+    if (ReadDirectoryUint(view, entry_offset(middle)) < property->AsUint()) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  if (low == count || ReadDirectoryUint(view, entry_offset(low)) != property->AsUint()) {
+    return {properties.data(), 0};
+  }
+  const auto offset = ReadDirectoryUint(view, entry_offset(low) + sizeof(uint32_t));
+  return {properties.data() + offset, properties_size - offset};
+}
+
+// Removes the directory in place. The freed space at the end of the buffer is
+// filled with tombstones.
+void RemoveDirectory(std::span<uint8_t> view) {
+  const auto directory_size = DirectorySize(view);
+  if (directory_size == 0) return;
+  memmove(view.data(), view.data() + directory_size, view.size_bytes() - directory_size);
+  memset(view.data() + view.size_bytes() - directory_size, 0, directory_size);
+}
+
+// Prefixes the encoded properties with a directory if there are at least
+// `FLAGS_storage_property_store_directory_threshold` of them. The buffer is
+// enlarged if the directory doesn't fit into it.
+DecodedBuffer AddDirectory(uint8_t (&buffer)[12], DecodedBuffer buffer_info) {
+  const auto threshold = FLAGS_storage_property_store_directory_threshold;
+  if (threshold == 0 || buffer_info.storage_mode != StorageMode::BUFFER) return buffer_info;
+
+  auto view = buffer_info.view;
+  std::vector<std::pair<uint32_t, uint32_t>> entries;
+  Reader reader(view.data(), view.size_bytes());
+  uint32_t properties_size = 0;
+  while (true) {
+    const auto offset = reader.GetPosition();
+    auto metadata = reader.ReadMetadata();
+    if (!metadata || metadata->type == Type::EMPTY) break;
+    auto property_id = reader.ReadUint(metadata->id_size);
+    if (!property_id) break;
+    if (!SkipPropertyValue(&reader, metadata->type, metadata->payload_size)) break;
+    entries.emplace_back(static_cast<uint32_t>(*property_id), offset);
+    properties_size = reader.GetPosition();
+  }
+  if (entries.size() < threshold) return buffer_info;
+
+  const auto count = static_cast<uint32_t>(entries.size());
+  const auto directory_size = kDirectoryHeaderSize + (count * kDirectoryEntrySize);
+  const auto new_size = directory_size + properties_size;
+  if (new_size > view.size_bytes()) {
+    auto new_buffer_info = SetupExternalBuffer(new_size);
+    memcpy(new_buffer_info.view.data() + directory_size, view.data(), properties_size);
+    FreeMemory(buffer_info);
+    SetSizeData(buffer, new_buffer_info.view.size_bytes(), new_buffer_info.view.data());
+    buffer_info = new_buffer_info;
+    view = buffer_info.view;
+  } else {
+    memmove(view.data() + directory_size, view.data(), properties_size);
+  }
+  // Tombstones after the last property
+  memset(view.data() + new_size, 0, view.size_bytes() - new_size);
+
+  view[0] = kDirectoryMarker;
+  memcpy(view.data() + sizeof(uint8_t), &count, sizeof(count));
+  auto *entry = view.data() + kDirectoryHeaderSize;
+  for (const auto &[property_id, offset] : entries) {
+    memcpy(entry, &property_id, sizeof(uint32_t));
+    memcpy(entry + sizeof(uint32_t), &offset, sizeof(uint32_t));
+    entry += kDirectoryEntrySize;
+  }
+  return buffer_info;
+}
+
 }  // namespace
 
 PropertyStore::PropertyStore() { memset(buffer_, 0, sizeof(buffer_)); }
@@ -1889,15 +2045,14 @@ PropertyStore::~PropertyStore() {
 }
 
 template <typename Func>
-auto PropertyStore::WithReader(Func &&func) const {
+auto PropertyStore::WithReader(Func &&func, std::optional<PropertyId> property) const {
   auto buffer_info = GetDecodedBuffer(buffer_);
   if (buffer_info.storage_mode == StorageMode::COMPRESSED) {
     auto decompressed_buffer = DecompressBuffer(buffer_info);
-    auto view = decompressed_buffer->view();
-    Reader reader(view.data(), view.size_bytes());
+    auto reader = MakeReader(decompressed_buffer->view(), property);
     return std::forward<Func>(func)(reader);
   }
-  Reader reader(buffer_info.view.data(), buffer_info.view.size_bytes());
+  auto reader = MakeReader(buffer_info.view, property);
   return std::forward<Func>(func)(reader);
 }
 
@@ -1907,7 +2062,7 @@ PropertyValue PropertyStore::GetProperty(PropertyId property) const {
     if (FindSpecificProperty(&reader, property, value) != ExpectedPropertyStatus::EQUAL) return {};
     return value;
   };
-  return WithReader(get_property);
+  return WithReader(get_property, property);
 }
 
 ExtendedPropertyType PropertyStore::GetExtendedPropertyType(PropertyId property) const {
@@ -1916,7 +2071,7 @@ ExtendedPropertyType PropertyStore::GetExtendedPropertyType(PropertyId property)
     if (FindSpecificExtendedPropertyType(&reader, property, type) != ExpectedPropertyStatus::EQUAL) return {};
     return type;
   };
-  return WithReader(get_property_type);
+  return WithReader(get_property_type, property);
 }
 
 uint32_t PropertyStore::PropertySize(PropertyId property) const {
@@ -1925,14 +2080,14 @@ uint32_t PropertyStore::PropertySize(PropertyId property) const {
     if (FindSpecificPropertySize(&reader, property, property_size) != ExpectedPropertyStatus::EQUAL) return 0;
     return property_size;
   };
-  return WithReader(get_property_size);
+  return WithReader(get_property_size, property);
 }
 
 bool PropertyStore::HasProperty(PropertyId property) const {
   auto property_exists = [&](Reader &reader) -> uint32_t {
     return ExistsSpecificProperty(&reader, property) == ExpectedPropertyStatus::EQUAL;
   };
-  return WithReader(property_exists);
+  return WithReader(property_exists, property);
 }
 
 bool PropertyStore::HasAllProperties(const std::set<PropertyId> &properties) const {
@@ -1975,7 +2130,7 @@ bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &va
     if (!CompareExpectedProperty(&prop_reader, property, value)) return false;
     return prop_reader.GetPosition() == property_size;
   };
-  return WithReader(property_equal);
+  return WithReader(property_equal, property);
 }
 
 std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
@@ -2006,11 +2161,11 @@ std::map<PropertyId, ExtendedPropertyType> PropertyStore::ExtendedPropertyTypes(
   return WithReader(get_properties);
 }
 
-bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value) {
+bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value, StringDictionary *dictionary) {
   uint32_t property_size = 0;
   if (!value.IsNull()) {
     Writer writer;
-    EncodeProperty(&writer, property, value);
+    EncodeProperty(&writer, property, value, dictionary);
     property_size = writer.Written();
   }
 
@@ -2025,7 +2180,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
 
       // Encode the property into the data buffer.
       Writer writer(new_view.data(), new_view.size());
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(EncodeProperty(&writer, property, value, dictionary), "Invalid database state!");
       auto metadata = writer.WriteMetadata();
       if (metadata) {
         // If there is any space left in the buffer we add a tombstone to
@@ -2055,6 +2210,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
       return buffer_info.view;
     });
 
+    RemoveDirectory(current_view);
     auto reader = Reader(current_view.data(), current_view.size_bytes());
     auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
     existed = info.property_size != 0;
@@ -2117,7 +2273,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     if (!value.IsNull()) {
       // We need to encode the new value.
       Writer writer(current_view.data() + info.property_begin, property_size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(EncodeProperty(&writer, property, value, dictionary), "Invalid database state!");
     }
 
     // We need to recreate the tombstone (if possible).
@@ -2128,6 +2284,8 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     }
   }
 
+  buffer_info = AddDirectory(buffer_, buffer_info);
+
   if (FLAGS_storage_property_store_compression_enabled) {
     CompressBuffer(buffer_, buffer_info);
   }
@@ -2136,7 +2294,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
 }
 
 template <typename TContainer>
-bool PropertyStore::DoInitProperties(const TContainer &properties) {
+bool PropertyStore::DoInitProperties(const TContainer &properties, StringDictionary *dictionary) {
   auto orig_buffer_info = GetDecodedBuffer(buffer_);
   if (orig_buffer_info.storage_mode != StorageMode::EMPTY) {
     return false;
@@ -2149,7 +2307,7 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
       if (value.IsNull()) {
         continue;
       }
-      EncodeProperty(&writer, property, value);
+      EncodeProperty(&writer, property, value, dictionary);
       property_size = writer.Written();
     }
   }
@@ -2164,7 +2322,7 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
     if (value.IsNull()) {
       continue;
     }
-    MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+    MG_ASSERT(EncodeProperty(&writer, property, value, dictionary), "Invalid database state!");
     writer.Written();
   }
 
@@ -2180,6 +2338,8 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
     SetSizeData(buffer_, view.size_bytes(), view.data());
   }
 
+  buffer_info = AddDirectory(buffer_, buffer_info);
+
   if (FLAGS_storage_property_store_compression_enabled) {
     CompressBuffer(buffer_, buffer_info);
   }
@@ -2188,7 +2348,7 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
 }
 
 std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>> PropertyStore::UpdateProperties(
-    std::map<PropertyId, PropertyValue> &properties) {
+    std::map<PropertyId, PropertyValue> &properties, StringDictionary *dictionary) {
   auto old_properties = Properties();
   ClearProperties();
 
@@ -2208,23 +2368,25 @@ std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>> PropertyStore:
     }
   }
 
-  MG_ASSERT(InitProperties(properties));
+  MG_ASSERT(InitProperties(properties, dictionary));
   return id_old_new_change;
 }
 
 template bool PropertyStore::DoInitProperties<std::map<PropertyId, PropertyValue>>(
-    const std::map<PropertyId, PropertyValue> &);
+    const std::map<PropertyId, PropertyValue> &, StringDictionary *);
 template bool PropertyStore::DoInitProperties<std::vector<std::pair<PropertyId, PropertyValue>>>(
-    const std::vector<std::pair<PropertyId, PropertyValue>> &);
+    const std::vector<std::pair<PropertyId, PropertyValue>> &, StringDictionary *);
 
-bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
-  return DoInitProperties(properties);
+bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties,
+                                   StringDictionary *dictionary) {
+  return DoInitProperties(properties, dictionary);
 }
 
-bool PropertyStore::InitProperties(std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties) {
+bool PropertyStore::InitProperties(std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties,
+                                   StringDictionary *dictionary) {
   std::sort(properties.begin(), properties.end());
 
-  return DoInitProperties(properties);
+  return DoInitProperties(properties, dictionary);
 }
 
 bool PropertyStore::ClearProperties() {
@@ -2317,7 +2479,7 @@ std::optional<PropertyValue> PropertyStore::GetPropertyOfTypes(PropertyId proper
     return std::nullopt;
   };
 
-  return WithReader(get_properties);
+  return WithReader(get_properties, property);
 }
 
 auto PropertyStore::PropertiesMatchTypes(TypeConstraintsValidator const &constraint) const
@@ -26,9 +26,13 @@
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_bool(storage_property_store_compression_enabled);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(storage_property_store_directory_threshold);
 
 namespace memgraph::storage {
 
+class StringDictionary;
+
 class PropertyStore {
   static_assert(std::endian::native == std::endian::little,
                 "PropertyStore supports only architectures using little-endian.");
@@ -51,7 +55,8 @@ class PropertyStore {
 
   /// Returns the currently stored value for property `property`. If the
   /// property doesn't exist a Null value is returned. The time complexity of
-  /// this function is O(n).
+  /// this function is O(n), or O(log(n)) for stores holding at least
+  /// `storage_property_store_directory_threshold` properties.
   /// @throw std::bad_alloc
   PropertyValue GetProperty(PropertyId property) const;
 
@@ -63,7 +68,8 @@ class PropertyStore {
   uint32_t PropertySize(PropertyId property) const;
 
   /// Checks whether the property `property` exists in the store. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(n), or O(log(n)) for stores holding at
+  /// least `storage_property_store_directory_threshold` properties.
   bool HasProperty(PropertyId property) const;
 
   /// Checks whether all properties in the set `properties` exist in the store. The time
@@ -81,7 +87,8 @@ class PropertyStore {
   /// Checks whether the property `property` is equal to the specified value
   /// `value`. This function doesn't perform any memory allocations while
   /// performing the equality check. The time complexity of this function is
-  /// O(n).
+  /// O(n), or O(log(n)) for stores holding at least
+  /// `storage_property_store_directory_threshold` properties.
   bool IsPropertyEqual(PropertyId property, const PropertyValue &value) const;
 
   /// Returns all properties currently stored in the store. The time complexity
@@ -99,21 +106,24 @@ class PropertyStore {
 
   /// Set a property value and return `true` if insertion took place. `false` is
   /// returned if assignment took place. The time complexity of this function is
-  /// O(n).
+  /// O(n). String values of properties encoded by `dictionary` are interned in
+  /// it; the dictionary must outlive the stored value.
   /// @throw std::bad_alloc
-  bool SetProperty(PropertyId property, const PropertyValue &value);
+  bool SetProperty(PropertyId property, const PropertyValue &value, StringDictionary *dictionary = nullptr);
 
   /// Init property values and return `true` if insertion took place. `false` is
   /// returned if there is any existing property in property store and insertion couldn't take place. The time
   /// complexity of this function is O(n).
   /// @throw std::bad_alloc
-  bool InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties);
+  bool InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties,
+                      StringDictionary *dictionary = nullptr);
 
   /// Init property values and return `true` if insertion took place. `false` is
   /// returned if there is any existing property in property store and insertion couldn't take place. The time
   /// complexity of this function is O(n*log(n)):
   /// @throw std::bad_alloc
-  bool InitProperties(std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties);
+  bool InitProperties(std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties,
+                      StringDictionary *dictionary = nullptr);
 
   /// Update property values in property store with sent properties. Returns vector of changed
   /// properties. Each tuple inside vector consists of PropertyId of inserted property, together with old
@@ -121,7 +131,7 @@ class PropertyStore {
   /// The time complexity of this function is O(n*log(n)):
   /// @throw std::bad_alloc
   std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>> UpdateProperties(
-      std::map<storage::PropertyId, storage::PropertyValue> &properties);
+      std::map<storage::PropertyId, storage::PropertyValue> &properties, StringDictionary *dictionary = nullptr);
 
   /// Remove all properties and return `true` if any removal took place.
   /// `false` is returned if there were no properties to remove. The time
@@ -140,10 +150,12 @@ class PropertyStore {
 
  private:
   template <typename TContainer>
-  bool DoInitProperties(const TContainer &properties);
+  bool DoInitProperties(const TContainer &properties, StringDictionary *dictionary);
 
+  /// Calls `func` with a reader of the stored properties. If `property` is
+  /// given, the reader may start directly at that property.
   template <typename Func>
-  auto WithReader(Func &&func) const;
+  auto WithReader(Func &&func, std::optional<PropertyId> property = std::nullopt) const;
 
   uint8_t buffer_[sizeof(uint32_t) + sizeof(uint8_t *)];
 };
@@ -16,6 +16,7 @@
 #include "spdlog/spdlog.h"
 
 #include "flags/experimental.hpp"
+#include "storage/v2/adjacency.hpp"
 #include "storage/v2/disk/name_id_mapper.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
@@ -411,7 +412,7 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
   std::vector<EdgeAccessor> deleted_edges{};
 
   auto clear_edges = [this, &deleted_edges, &deleted_edge_ids](
-                         auto *vertex_ptr, auto *attached_edges_to_vertex, auto deletion_delta,
+                         auto *vertex_ptr, auto *attached_edges_to_vertex, uint8_t *unmerged, auto deletion_delta,
                          auto reverse_vertex_order) -> Result<std::optional<ReturnType>> {
     // This has to be called before any object gets locked
     // TODO Double check that the shared access is enough
@@ -435,10 +436,10 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
 
       // MarkEdgeAsDeleted allocates additional memory
       // and CreateAndLinkDelta needs memory
-      utils::AtomicMemoryBlock([&attached_edges_to_vertex, &deleted_edge_ids, &reverse_vertex_order, &vertex_ptr,
-                                &deleted_edges, deletion_delta = deletion_delta, edge_type = edge_type,
+      utils::AtomicMemoryBlock([&attached_edges_to_vertex, &unmerged, &deleted_edge_ids, &reverse_vertex_order,
+                                &vertex_ptr, &deleted_edges, deletion_delta = deletion_delta, edge_type = edge_type,
                                 opposing_vertex = opposing_vertex, edge_ref = edge_ref, &schema_acc, this]() {
-        attached_edges_to_vertex->pop_back();
+        PopBackEdge(*attached_edges_to_vertex, *unmerged);
         if (this->storage_->config_.salient.items.properties_on_edges) {
           auto *edge_ptr = edge_ref.ptr;
           MarkEdgeAsDeleted(edge_ptr);
@@ -475,12 +476,14 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
   // delete the in and out edges from the nodes we want to delete
   // no need to lock here, we are just passing the pointer of the in and out edges collections
   for (auto *vertex_ptr : vertices) {
-    auto maybe_error = clear_edges(vertex_ptr, &vertex_ptr->in_edges, Delta::AddInEdgeTag(), false);
+    auto maybe_error =
+        clear_edges(vertex_ptr, &vertex_ptr->in_edges, &vertex_ptr->in_edges_unmerged, Delta::AddInEdgeTag(), false);
     if (maybe_error.HasError()) {
       return maybe_error;
     }
 
-    maybe_error = clear_edges(vertex_ptr, &vertex_ptr->out_edges, Delta::AddOutEdgeTag(), true);
+    maybe_error =
+        clear_edges(vertex_ptr, &vertex_ptr->out_edges, &vertex_ptr->out_edges_unmerged, Delta::AddOutEdgeTag(), true);
     if (maybe_error.HasError()) {
       return maybe_error;
     }
@@ -495,8 +498,8 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
   std::vector<EdgeAccessor> deleted_edges{};
 
   auto clear_edges_on_other_direction = [this, &deleted_edges, &partially_detached_edge_ids](
-                                            auto *vertex_ptr, auto *edges_attached_to_vertex, auto &set_for_erasure,
-                                            auto deletion_delta,
+                                            auto *vertex_ptr, auto *edges_attached_to_vertex, uint8_t *unmerged,
+                                            auto &set_for_erasure, auto deletion_delta,
                                             auto reverse_vertex_order) -> Result<std::optional<ReturnType>> {
     // This has to be called before any object gets locked
     // TODO Double check that the shared access is enough
@@ -506,12 +509,11 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
     if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
     MG_ASSERT(!vertex_ptr->deleted, "Invalid database state!");
 
-    auto mid = std::partition(
-        edges_attached_to_vertex->begin(), edges_attached_to_vertex->end(), [this, &set_for_erasure](auto &edge) {
-          auto const &[edge_type, opposing_vertex, edge_ref] = edge;
-          auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
-          return !set_for_erasure.contains(edge_gid);
-        });
+    auto mid = PartitionEdges(*edges_attached_to_vertex, *unmerged, [this, &set_for_erasure](auto &edge) {
+      auto const &[edge_type, opposing_vertex, edge_ref] = edge;
+      auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
+      return !set_for_erasure.contains(edge_gid);
+    });
 
     // Creating deltas and erasing edge only at the end -> we might have incomplete state as
     // delta might cause OOM, so we don't remove edges from edges_attached_to_vertex
@@ -561,15 +563,17 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
 
   // remove edges from vertex collections which we aggregated for just detaching
   for (auto *vertex_ptr : info.partial_src_vertices) {
-    auto maybe_error = clear_edges_on_other_direction(vertex_ptr, &vertex_ptr->out_edges, info.partial_src_edge_ids,
-                                                      Delta::AddOutEdgeTag(), false);
+    auto maybe_error =
+        clear_edges_on_other_direction(vertex_ptr, &vertex_ptr->out_edges, &vertex_ptr->out_edges_unmerged,
+                                       info.partial_src_edge_ids, Delta::AddOutEdgeTag(), false);
     if (maybe_error.HasError()) {
       return maybe_error;
     }
   }
   for (auto *vertex_ptr : info.partial_dest_vertices) {
-    auto maybe_error = clear_edges_on_other_direction(vertex_ptr, &vertex_ptr->in_edges, info.partial_dest_edge_ids,
-                                                      Delta::AddInEdgeTag(), true);
+    auto maybe_error =
+        clear_edges_on_other_direction(vertex_ptr, &vertex_ptr->in_edges, &vertex_ptr->in_edges_unmerged,
+                                       info.partial_dest_edge_ids, Delta::AddInEdgeTag(), true);
     if (maybe_error.HasError()) {
       return maybe_error;
     }
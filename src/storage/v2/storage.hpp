@@ -42,6 +42,7 @@
 #include "storage/v2/schema_info.hpp"
 #include "storage/v2/storage_error.hpp"
 #include "storage/v2/storage_mode.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertices_iterable.hpp"
 #include "utils/compressor.hpp"
@@ -74,6 +75,7 @@ struct IndicesInfo {
   std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
   std::vector<std::pair<std::string, LabelId>> text_indices;
   std::vector<std::pair<LabelId, PropertyId>> point_label_property;
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
 };
 
 struct ConstraintsInfo {
@@ -204,6 +206,31 @@ class Storage {
                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
 
+    /// Looks up the composite index over `properties`. The vertices must have
+    /// the values in `prefix` for the first properties of the index, and the
+    /// bounds apply to the property following the prefix.
+    virtual VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                                      const std::vector<PropertyValue> &prefix,
+                                      const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                      const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
+
+    /// Returns at most `num_chunks` disjoint iterables which together cover
+    /// the same vertices as `Vertices(view)`. The chunks can be consumed from
+    /// different threads, see `SetConcurrentReaders`. Storages that don't
+    /// support partitioning return a single chunk.
+    virtual std::vector<VerticesIterable> ChunkedVertices(View view, size_t /*num_chunks*/) {
+      std::vector<VerticesIterable> chunks;
+      chunks.emplace_back(Vertices(view));
+      return chunks;
+    }
+
+    /// Same as `ChunkedVertices(View, size_t)`, but for `Vertices(label, view)`.
+    virtual std::vector<VerticesIterable> ChunkedVertices(LabelId label, View view, size_t /*num_chunks*/) {
+      std::vector<VerticesIterable> chunks;
+      chunks.emplace_back(Vertices(label, view));
+      return chunks;
+    }
+
     virtual std::optional<EdgeAccessor> FindEdge(Gid gid, View view) = 0;
 
     virtual EdgesIterable Edges(EdgeTypeId edge_type, View view) = 0;
@@ -236,6 +263,11 @@ class Storage {
                                             const std::optional<utils::Bound<PropertyValue>> &lower,
                                             const std::optional<utils::Bound<PropertyValue>> &upper) const = 0;
 
+    virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+    virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                            const std::vector<PropertyValue> &values) const = 0;
+
     virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const = 0;
 
     virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const = 0;
@@ -281,6 +313,10 @@ class Storage {
 
     virtual bool LabelPropertyIndexExists(LabelId label, PropertyId property) const = 0;
 
+    virtual bool LabelPropertyIndexExists(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+    virtual std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListCompositeIndices() const = 0;
+
     virtual bool EdgeTypeIndexExists(EdgeTypeId edge_type) const = 0;
 
     virtual bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const = 0;
@@ -325,6 +361,11 @@ class Storage {
 
     std::optional<uint64_t> GetTransactionId() const;
 
+    /// Must be set while multiple threads read through this accessor at the
+    /// same time. Transaction state which isn't synchronized (e.g. the delta
+    /// chain cache) is bypassed while set.
+    void SetConcurrentReaders(bool concurrent_readers) { transaction_.concurrent_readers = concurrent_readers; }
+
     void AdvanceCommand();
 
     const std::string &LabelToName(LabelId label) const { return storage_->LabelToName(label); }
@@ -356,6 +397,9 @@ class Storage {
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label, PropertyId property) = 0;
 
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+        LabelId label, const std::vector<PropertyId> &properties) = 0;
+
     virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type,
                                                                               bool unique_access_needed = true) = 0;
 
@@ -366,6 +410,9 @@ class Storage {
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label, PropertyId property) = 0;
 
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+        LabelId label, const std::vector<PropertyId> &properties) = 0;
+
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type) = 0;
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type,
@@ -555,6 +602,11 @@ class Storage {
   std::unique_ptr<NameIdMapper> name_id_mapper_;
   Config config_;
 
+  // Interned string values of dictionary encoded properties. Only set by the
+  // in-memory storage when such properties are configured; property stores
+  // point into it, so it has to outlive all vertices and edges.
+  std::unique_ptr<StringDictionary> string_dictionary_;
+
   // Transaction engine
   mutable utils::SpinLock engine_lock_;
   uint64_t timestamp_{kTimestampInitialId};
@@ -0,0 +1,34 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/string_dictionary.hpp"
+
+namespace memgraph::storage {
+
+void StringDictionary::EnableEncoding(PropertyId property) {
+  encoded_properties_->insert(property);
+  has_encoded_properties_.store(true, std::memory_order_release);
+}
+
+const std::string *StringDictionary::Intern(std::string_view value) {
+  {
+    auto strings = strings_.ReadLock();
+    if (auto it = strings->find(value); it != strings->end()) return &*it;
+  }
+
+  auto strings = strings_.Lock();
+  if (auto it = strings->find(value); it != strings->end()) return &*it;
+  if (strings->size() >= max_size_) return nullptr;
+  auto [it, _] = strings->emplace(value);
+  return &*it;
+}
+
+}  // namespace memgraph::storage
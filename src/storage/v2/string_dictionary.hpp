@@ -0,0 +1,91 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include "storage/v2/id_types.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage {
+
+/// Dictionary of interned strings owned by a storage. String values of
+/// properties with dictionary encoding enabled are stored in the
+/// `PropertyStore` as the address of the interned string instead of the string
+/// itself, so repeated values (countries, statuses, currencies...) are kept in
+/// memory only once per storage.
+///
+/// Interned strings stay valid until the dictionary is cleared or destroyed,
+/// even once no property references them anymore. The dictionary therefore
+/// holds at most `max_size` strings; once it is full, new values are stored
+/// inline. Equality checks compare the contents of the interned string, not
+/// its address, so inline and interned copies of a value compare equal.
+///
+/// Addresses are never persisted: snapshots, WAL files, replication and the
+/// on-disk storage carry the strings themselves.
+class StringDictionary {
+ public:
+  static constexpr uint64_t kDefaultMaxSize = 100000;
+
+  explicit StringDictionary(uint64_t max_size = kDefaultMaxSize) : max_size_{max_size} {}
+  StringDictionary(const StringDictionary &) = delete;
+  StringDictionary(StringDictionary &&) = delete;
+  StringDictionary &operator=(const StringDictionary &) = delete;
+  StringDictionary &operator=(StringDictionary &&) = delete;
+  ~StringDictionary() = default;
+
+  /// Enables dictionary encoding for string values of `property`. Values
+  /// which are already stored are encoded once they are written again.
+  void EnableEncoding(PropertyId property);
+
+  bool IsEncoded(PropertyId property) const {
+    if (!has_encoded_properties_.load(std::memory_order_acquire)) return false;
+    return encoded_properties_->contains(property);
+  }
+
+  /// Returns true if dictionary encoding is enabled for any property.
+  bool HasEncodedProperties() const { return has_encoded_properties_.load(std::memory_order_acquire); }
+
+  /// Returns the interned copy of `value`, adding it to the dictionary if
+  /// needed. Returns nullptr if `value` isn't interned yet and the dictionary
+  /// is full.
+  /// @throw std::bad_alloc
+  const std::string *Intern(std::string_view value);
+
+  /// Returns the number of interned strings.
+  uint64_t Size() const { return strings_->size(); }
+
+  /// Removes all interned strings. Must only be called once no property store
+  /// references them anymore.
+  void Clear() { strings_->clear(); }
+
+ private:
+  struct StringHash {
+    using is_transparent = void;
+    [[nodiscard]] size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+    [[nodiscard]] size_t operator()(const std::string &s) const { return std::hash<std::string>{}(s); }
+  };
+
+  uint64_t max_size_;
+  std::atomic<bool> has_encoded_properties_{false};
+  utils::Synchronized<std::unordered_set<PropertyId>, utils::RWSpinLock> encoded_properties_;
+
+  // Nodes of the set are stable, so property stores can point to the strings.
+  utils::Synchronized<std::unordered_set<std::string, StringHash, std::equal_to<>>, utils::RWSpinLock> strings_;
+};
+
+}  // namespace memgraph::storage
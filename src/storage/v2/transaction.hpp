@@ -75,6 +75,10 @@ struct Transaction {
 
   bool IsDiskStorage() const { return storage_mode == StorageMode::ON_DISK_TRANSACTIONAL; }
 
+  /// The delta chain cache is only consistent under snapshot isolation and it
+  /// isn't synchronized, so it's bypassed while multiple threads read.
+  bool UseDeltaCache() const { return isolation_level == IsolationLevel::SNAPSHOT_ISOLATION && !concurrent_readers; }
+
   /// @throw std::bad_alloc if failed to create the `commit_timestamp`
   void EnsureCommitTimestampExists() {
     if (commit_timestamp != nullptr) return;
@@ -119,6 +123,9 @@ struct Transaction {
   // Used to speedup getting info about a vertex when there is a long delta
   // chain involved in rebuilding that info.
   mutable VertexInfoCache manyDeltasCache{};
+  // Set while the transaction is read from multiple threads (parallel query
+  // execution).
+  bool concurrent_readers{false};
   mutable std::optional<ConstraintVerificationInfo> constraint_verification_info{};
 
   // Store modified edges GID mapped to changed Delta and serialized edge key
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <alloca.h>
+#include <cstdint>
 #include <iterator>
 #include <limits>
 #include <tuple>
@@ -26,6 +27,8 @@
 
 namespace memgraph::storage {
 
+inline constexpr uint8_t kAdjacencyNotFrozen = std::numeric_limits<uint8_t>::max();
+
 struct Vertex {
   Vertex(Gid gid, Delta *delta) : gid(gid), deleted(false), delta(delta) {
     MG_ASSERT(delta == nullptr || delta->action == Delta::Action::DELETE_OBJECT ||
@@ -43,8 +46,12 @@ struct Vertex {
   PropertyStore properties;
   mutable utils::RWSpinLock lock;
   bool deleted;
+  // Number of entries at the end of the corresponding edge list which aren't
+  // merged into the frozen adjacency order yet, or `kAdjacencyNotFrozen` if
+  // the list isn't frozen at all (see storage/v2/adjacency.hpp).
+  uint8_t in_edges_unmerged{kAdjacencyNotFrozen};
+  uint8_t out_edges_unmerged{kAdjacencyNotFrozen};
   // uint8_t PAD;
-  // uint16_t PAD;
 
   Delta *delta;
 };
@@ -21,6 +21,7 @@
 
 #include "query/exceptions.hpp"
 #include "query/hops_limit.hpp"
+#include "storage/v2/adjacency.hpp"
 #include "storage/v2/constraints/constraint_violation.hpp"
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/disk/storage.hpp"
@@ -69,7 +70,7 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
   if (delta && transaction->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction->UseDeltaCache();
 
     if (useCache) {
       auto const &cache = transaction->manyDeltasCache;
@@ -273,7 +274,7 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -320,7 +321,7 @@ Result<utils::small_vector<LabelId>> VertexAccessor::Labels(View view) const {
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -380,7 +381,7 @@ Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const Pro
     }
 
     CreateAndLinkDelta(transaction, vertex, Delta::SetPropertyTag(), property, old_value);
-    vertex->properties.SetProperty(property, new_value);
+    vertex->properties.SetProperty(property, new_value, storage_->string_dictionary_.get());
     if (schema_acc)
       schema_acc->SetProperty(vertex, property, ExtendedPropertyType{new_value}, ExtendedPropertyType{old_value});
 
@@ -427,7 +428,7 @@ Result<bool> VertexAccessor::InitProperties(const std::map<storage::PropertyId,
   bool result{false};
   utils::AtomicMemoryBlock(
       [&result, &properties, storage = storage_, transaction = transaction_, vertex = vertex_, &schema_acc]() {
-        if (!vertex->properties.InitProperties(properties)) {
+        if (!vertex->properties.InitProperties(properties, storage->string_dictionary_.get())) {
           result = false;
           return;
         }
@@ -480,7 +481,7 @@ Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> Vertex
   std::optional<ReturnType> id_old_new_change;
   utils::AtomicMemoryBlock([storage = storage_, transaction = transaction_, vertex = vertex_, &properties,
                             &id_old_new_change, skip_duplicate_update, &schema_acc]() {
-    id_old_new_change.emplace(vertex->properties.UpdateProperties(properties));
+    id_old_new_change.emplace(vertex->properties.UpdateProperties(properties, storage->string_dictionary_.get()));
     if (!id_old_new_change.has_value()) {
       return;
     }
@@ -564,7 +565,7 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -632,7 +633,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -757,7 +758,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -842,7 +843,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -906,7 +907,7 @@ Result<size_t> VertexAccessor::InDegree(View view) const {
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -962,7 +963,7 @@ Result<size_t> VertexAccessor::OutDegree(View view) const {
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseDeltaCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -1018,6 +1019,19 @@ int64_t VertexAccessor::HandleExpansionsWithEdgeTypes(edge_store &result_edges,
                                                       EdgeDirection direction) const {
   int64_t expanded_count = 0;
   const auto &edges = direction == EdgeDirection::IN ? vertex_->in_edges : vertex_->out_edges;
+  const auto unmerged = direction == EdgeDirection::IN ? vertex_->in_edges_unmerged : vertex_->out_edges_unmerged;
+  // Hops limit counts every scanned edge, so it keeps using the full scan.
+  if (IsFrozen(unmerged) && !edge_types.empty() && !(hops_limit && hops_limit->IsUsed())) {
+    const auto *destination_vertex = destination ? destination->vertex_ : nullptr;
+    for (auto it = edge_types.begin(); it != edge_types.end(); ++it) {
+      if (std::find(edge_types.begin(), it, *it) != it) continue;
+      ForEachFrozenEdge(edges, unmerged, *it, destination_vertex, [&](const auto &entry) {
+        ++expanded_count;
+        result_edges.push_back(entry);
+      });
+    }
+    return expanded_count;
+  }
   for (const auto &[edge_type, vertex, edge] : edges) {
     if (hops_limit && hops_limit->IsUsed()) {
       hops_limit->IncrementHopsCount(1);
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <algorithm>
+#include <span>
 #include <tuple>
 #include <vector>
 
@@ -128,6 +129,16 @@ inline auto PropertyValueMatch_ActionMethod(bool &match, PropertyId property, Pr
   });
 }
 
+inline auto PropertyValuesMatch_ActionMethod(std::vector<bool> &matches, std::span<PropertyId const> properties,
+                                             std::span<PropertyValue const> values) {
+  using enum Delta::Action;
+  return ActionMethod<SET_PROPERTY>([&matches, properties, values](Delta const &delta) {
+    for (size_t i = 0; i < properties.size(); ++i) {
+      if (delta.property.key == properties[i]) matches[i] = (values[i] == *delta.property.value);
+    }
+  });
+}
+
 inline auto Properties_ActionMethod(std::map<PropertyId, PropertyValue> &properties) {
   using enum Delta::Action;
   return ActionMethod<SET_PROPERTY>([&](Delta const &delta) {
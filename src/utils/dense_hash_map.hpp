@@ -0,0 +1,180 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include "utils/memory.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::utils {
+
+/// Hash map for building join and group-by tables, which only grow until they
+/// are cleared.
+///
+/// Entries are stored by value in a vector in insertion order and located
+/// through an open addressing (linear probing) table of slots. Each slot keeps
+/// the hash of its key next to the index of the entry, so a probe compares
+/// keys only when their hashes match and growing the table doesn't hash the
+/// keys again. Unlike `std::unordered_map` there is no allocation per entry
+/// and iteration walks contiguous memory.
+///
+/// Entries can't be erased. Inserting may move the entries, so it invalidates
+/// the iterators and references to them.
+template <class TKey, class TValue, class THash = std::hash<TKey>, class TEqual = std::equal_to<>>
+class DenseHashMap {
+ public:
+  using value_type = std::pair<TKey, TValue>;
+  using allocator_type = Allocator<value_type>;
+  using iterator = typename pmr::vector<value_type>::iterator;
+  using const_iterator = typename pmr::vector<value_type>::const_iterator;
+
+  explicit DenseHashMap(MemoryResource *memory) : entries_(memory), slots_(memory) {}
+
+  allocator_type get_allocator() const { return entries_.get_allocator(); }
+
+  iterator begin() { return entries_.begin(); }
+  iterator end() { return entries_.end(); }
+  const_iterator begin() const { return entries_.begin(); }
+  const_iterator end() const { return entries_.end(); }
+
+  size_t size() const { return entries_.size(); }
+  bool empty() const { return entries_.empty(); }
+
+  void clear() {
+    entries_.clear();
+    slots_.clear();
+  }
+
+  void reserve(size_t size) {
+    entries_.reserve(size);
+    if (size > slots_.size() / kMaxLoadFactor) Rehash(std::bit_ceil(size * kMaxLoadFactor));
+  }
+
+  template <class TLookup>
+  size_t Hash(const TLookup &key) const {
+    return hash_(key);
+  }
+
+  /// Brings the first slot probed for the given hash into the cache. Probing
+  /// a batch of keys is faster if all of their slots are prefetched first.
+  void Prefetch(size_t hash) const {
+    if (!slots_.empty()) __builtin_prefetch(&slots_[SlotIndex(hash)]);
+  }
+
+  template <class TLookup>
+  iterator find(const TLookup &key) {
+    return find(key, Hash(key));
+  }
+
+  template <class TLookup>
+  iterator find(const TLookup &key, size_t hash) {
+    const auto entry = FindEntry(key, hash);
+    return entry == kEmpty ? end() : begin() + entry;
+  }
+
+  template <class TLookup>
+  const_iterator find(const TLookup &key) const {
+    const auto entry = FindEntry(key, Hash(key));
+    return entry == kEmpty ? end() : begin() + entry;
+  }
+
+  template <class TLookup>
+  bool contains(const TLookup &key) const {
+    return find(key) != end();
+  }
+
+  /// Inserts the entry constructed from `key` and `args` unless an entry with
+  /// an equal key already exists. Returns the entry and whether it was
+  /// inserted.
+  template <class TLookup, class... TArgs>
+  std::pair<iterator, bool> try_emplace(TLookup &&key, TArgs &&...args) {
+    const auto hash = Hash(key);
+    return try_emplace_hashed(hash, std::forward<TLookup>(key), std::forward<TArgs>(args)...);
+  }
+
+  /// Same as `try_emplace`, but with the hash of the key already computed.
+  template <class TLookup, class... TArgs>
+  std::pair<iterator, bool> try_emplace_hashed(size_t hash, TLookup &&key, TArgs &&...args) {
+    if ((entries_.size() + 1) * kMaxLoadFactor > slots_.size()) {
+      Rehash(slots_.empty() ? kInitialSlots : slots_.size() * 2);
+    }
+    auto index = SlotIndex(hash);
+    for (;; index = (index + 1) & (slots_.size() - 1)) {
+      const auto &slot = slots_[index];
+      if (slot.entry == kEmpty) break;
+      if (slot.hash == hash && equal_(entries_[slot.entry].first, key)) return {begin() + slot.entry, false};
+    }
+    entries_.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<TLookup>(key)),
+                          std::forward_as_tuple(std::forward<TArgs>(args)...));
+    slots_[index] = {hash, entries_.size() - 1};
+    return {end() - 1, true};
+  }
+
+  template <class TLookup>
+  TValue &operator[](TLookup &&key) {
+    return try_emplace(std::forward<TLookup>(key)).first->second;
+  }
+
+ private:
+  struct Slot {
+    size_t hash{0};
+    size_t entry{kEmpty};
+  };
+
+  static constexpr size_t kEmpty = std::numeric_limits<size_t>::max();
+  static constexpr size_t kInitialSlots = 16;
+  // The table is kept at most half full, so probe sequences stay short.
+  static constexpr size_t kMaxLoadFactor = 2;
+
+  template <class TLookup>
+  size_t FindEntry(const TLookup &key, size_t hash) const {
+    if (slots_.empty()) return kEmpty;
+    for (auto index = SlotIndex(hash);; index = (index + 1) & (slots_.size() - 1)) {
+      const auto &slot = slots_[index];
+      if (slot.entry == kEmpty || (slot.hash == hash && equal_(entries_[slot.entry].first, key))) return slot.entry;
+    }
+  }
+
+  /// Maps the hash to a slot with Fibonacci hashing, so hashes which share
+  /// their low bits (like the identity hash of multiples of a power of two)
+  /// still spread over the whole table.
+  size_t SlotIndex(size_t hash) const {
+    return static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> shift_);
+  }
+
+  void Rehash(size_t num_slots) {
+    pmr::vector<Slot> old_slots(num_slots, Slot{}, slots_.get_allocator());
+    slots_.swap(old_slots);
+    shift_ = 64 - std::countr_zero(num_slots);
+    for (const auto &slot : old_slots) {
+      if (slot.entry == kEmpty) continue;
+      auto index = SlotIndex(slot.hash);
+      while (slots_[index].entry != kEmpty) index = (index + 1) & (num_slots - 1);
+      slots_[index] = slot;
+    }
+  }
+
+  pmr::vector<value_type> entries_;
+  pmr::vector<Slot> slots_;
+  int shift_{64};
+  [[no_unique_address]] THash hash_;
+  [[no_unique_address]] TEqual equal_;
+};
+
+}  // namespace memgraph::utils
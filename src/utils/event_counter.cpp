@@ -69,6 +69,15 @@
   M(PeriodicCommitOperator, Operator, "Number of times PeriodicCommit operator was used.")                           \
   M(PeriodicSubqueryOperator, Operator, "Number of times PeriodicSubquery operator was used.")                       \
                                                                                                                      \
+  M(PlanCacheHit, PlanCache, "Number of queries whose plan was found in the plan cache.")                            \
+  M(PlanCacheMiss, PlanCache, "Number of queries which had to be planned because of a plan cache miss.")             \
+  M(PlanCacheEviction, PlanCache, "Number of plans evicted from the plan cache because it was full.")                \
+  M(PlanCacheInvalidation, PlanCache, "Number of cached plans invalidated by index and statistics changes.")         \
+                                                                                                                     \
+  M(DiskCacheHit, DiskCache, "Number of vertices and edges found in the on-disk storage object cache.")              \
+  M(DiskCacheMiss, DiskCache, "Number of vertices and edges which had to be read from RocksDB.")                     \
+  M(DiskCacheEviction, DiskCache, "Number of objects evicted from the on-disk storage object cache.")                \
+                                                                                                                     \
   M(ActiveLabelIndices, Index, "Number of active label indices in the system.")                                      \
   M(ActiveLabelPropertyIndices, Index, "Number of active label property indices in the system.")                     \
   M(ActivePointIndices, Index, "Number of active point indices in the system.")                                      \
@@ -76,6 +85,7 @@
                                                                                                                      \
   M(StreamsCreated, Stream, "Number of Streams created.")                                                            \
   M(MessagesConsumed, Stream, "Number of consumed streamed messages.")                                               \
+  M(StreamQueriesExecuted, Stream, "Number of queries executed from stream transformation results.")                 \
                                                                                                                      \
   M(TriggersCreated, Trigger, "Number of Triggers created.")                                                         \
   M(TriggersExecuted, Trigger, "Number of Triggers executed.")                                                       \
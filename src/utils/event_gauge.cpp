@@ -12,7 +12,10 @@
 #include "utils/event_gauge.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define APPLY_FOR_GAUGES(M) M(PeakMemoryRes, MAX, Memory, "Peak res memory in the system.")
+#define APPLY_FOR_GAUGES(M)                                                                                    \
+  M(PeakMemoryRes, MAX, Memory, "Peak res memory in the system.")                                              \
+  M(GCBacklogTransactions, CURRENT_VALUE, GC, "Number of committed transactions left for the next GC run.")    \
+  M(GCLag_ms, CURRENT_VALUE, GC, "How long the oldest transaction left for the next GC run has waited in ms.")
 
 namespace memgraph::metrics {
 
@@ -13,9 +13,12 @@
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define APPLY_FOR_HISTOGRAMS(M)                                                                    \
+  M(GCLatency_us, GC, "Storage garbage collection latency in microseconds", 50, 90, 99)            \
   M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)        \
+  M(QueryPlanningLatency_us, Query, "Query planning latency in microseconds", 50, 90, 99)          \
   M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99) \
-  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)
+  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99) \
+  M(StreamBatchLatency_us, Stream, "Stream batch processing latency in microseconds", 50, 90, 99)
 
 namespace memgraph::metrics {
 
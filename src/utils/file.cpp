@@ -429,7 +429,13 @@ bool OutputFile::AcquireLock() {
 
 void OutputFile::Sync() {
   FlushBuffer(true);
+  SyncWritten();
 
+  // Reset the counter.
+  written_since_last_sync_ = 0;
+}
+
+void OutputFile::SyncWritten() {
   int ret = 0;
   while (true) {
     ret = fsync(fd_);
@@ -467,12 +473,9 @@ void OutputFile::Sync() {
   // error occurs:
   // https://www.postgresql.org/message-id/20180427222842.in2e4mibx45zdth5@alap3.anarazel.de
   MG_ASSERT(ret == 0,
-            "While trying to sync {}, an error occurred: {} ({}). Possibly {} "
+            "While trying to sync {}, an error occurred: {} ({}). Possibly some "
             "bytes from previous write calls were lost.",
-            path_, strerror(errno), errno, written_since_last_sync_);
-
-  // Reset the counter.
-  written_since_last_sync_ = 0;
+            path_, strerror(errno), errno);
 }
 
 void OutputFile::Close() noexcept {
@@ -557,10 +560,14 @@ size_t OutputFile::GetSize() {
   return SeekFile(Position::RELATIVE_TO_END, 0) + buffer_position_.load();
 }
 
-void OutputFile::TryFlushing() {
+bool OutputFile::TryFlushing() {
   if (std::unique_lock guard(flush_lock_, std::try_to_lock); guard.owns_lock()) {
     FlushBufferInternal();
+    return true;
   }
+  return false;
 }
 
+void OutputFile::WaitForFlushing() { std::unique_lock guard(flush_lock_); }
+
 }  // namespace memgraph::utils
@@ -235,6 +235,11 @@ class OutputFile {
   /// and misuse it crashes the program.
   void Sync();
 
+  /// Syncs the data that was already written to the currently opened file
+  /// without flushing the internal buffer, so it can be called while another
+  /// thread writes to the file. On failure and misuse it crashes the program.
+  void SyncWritten();
+
   /// Closes the currently opened file. It doesn't perform a `Sync` on the
   /// file. On failure and misuse it crashes the program.
   void Close() noexcept;
@@ -247,8 +252,12 @@ class OutputFile {
   /// is flushed.
   void EnableFlushing();
 
-  /// Try flushing the internal buffer.
-  void TryFlushing();
+  /// Try flushing the internal buffer. Returns whether the buffer was
+  /// flushed.
+  bool TryFlushing();
+
+  /// Blocks until flushing of the internal buffer isn't disabled by a reader.
+  void WaitForFlushing();
 
   /// Get the internal buffer with its current size.
   std::pair<const uint8_t *, size_t> CurrentBuffer() const;
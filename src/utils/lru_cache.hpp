@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -26,7 +26,9 @@ class LRUCache {
  public:
   explicit LRUCache(int cache_size_) : cache_size(cache_size_){};
 
-  void put(const TKey &key, const TVal &val) {
+  /// Inserts the entry and returns the number of least recently used entries
+  /// evicted to make room for it.
+  std::size_t put(const TKey &key, const TVal &val) {
     auto it = item_map.find(key);
     if (it != item_map.end()) {
       item_list.erase(it->second);
@@ -34,7 +36,7 @@ class LRUCache {
     }
     item_list.push_front(std::make_pair(key, val));
     item_map.insert(std::make_pair(key, item_list.begin()));
-    try_clean();
+    return try_clean();
   };
   std::optional<TVal> get(const TKey &key) {
     if (!exists(key)) {
@@ -44,6 +46,22 @@ class LRUCache {
     item_list.splice(item_list.begin(), item_list, it->second);
     return it->second->second;
   }
+  /// Removes the entries for which `pred(key, value)` returns true and returns
+  /// how many were removed.
+  template <class TPred>
+  std::size_t erase_if(TPred &&pred) {
+    std::size_t removed = 0;
+    for (auto it = item_list.begin(); it != item_list.end();) {
+      if (pred(it->first, it->second)) {
+        item_map.erase(it->first);
+        it = item_list.erase(it);
+        ++removed;
+      } else {
+        ++it;
+      }
+    }
+    return removed;
+  }
   void reset() {
     item_list.clear();
     item_map.clear();
@@ -51,13 +69,16 @@ class LRUCache {
   std::size_t size() { return item_map.size(); };
 
  private:
-  void try_clean() {
+  std::size_t try_clean() {
+    std::size_t evicted = 0;
     while (item_map.size() > cache_size) {
       auto last_it_elem_it = item_list.end();
       last_it_elem_it--;
       item_map.erase(last_it_elem_it->first);
       item_list.pop_back();
+      ++evicted;
     }
+    return evicted;
   };
   bool exists(const TKey &key) { return (item_map.count(key) > 0); };
 
@@ -20,6 +20,7 @@
 #include <optional>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "spdlog/spdlog.h"
 #include "utils/bound.hpp"
@@ -825,6 +826,18 @@ class SkipList final : detail::SkipListNode_base {
       return skiplist_->remove(key);
     }
 
+    /// Samples up to `num_chunks - 1` items that split the list into
+    /// `num_chunks` ranges of approximately equal size. The items are sampled
+    /// from the highest layer that has enough nodes, so the operation doesn't
+    /// traverse the whole list. The returned iterators are ordered and point to
+    /// distinct items. Because items can be removed concurrently, the sampled
+    /// items should only be used as range keys (e.g. with
+    /// `find_equal_or_greater`) and not as iteration end markers.
+    ///
+    /// @return vector of iterators to the boundary items, may be shorter than
+    ///         `num_chunks - 1` (or empty) for small lists
+    std::vector<Iterator> split_points(uint64_t num_chunks) { return skiplist_->split_points(num_chunks); }
+
     /// Returns the number of items contained in the list.
     ///
     /// @return size of the list
@@ -1301,6 +1314,35 @@ class SkipList final : detail::SkipListNode_base {
     return nodes_traversed / unique_count;
   }
 
+  std::vector<Iterator> split_points(uint64_t num_chunks) {
+    std::vector<Iterator> points;
+    if (num_chunks < 2) return points;
+
+    // Find the highest layer that has at least `num_chunks` nodes. Each layer
+    // has roughly half of the nodes of the layer below it, so only a small
+    // multiple of `num_chunks` nodes is visited in total.
+    std::vector<TNode *> nodes;
+    for (int layer = kSkipListMaxHeight - 1; layer >= 0; --layer) {
+      nodes.clear();
+      TNode *curr = head_->nexts[layer].load(std::memory_order_acquire);
+      while (curr != nullptr) {
+        if (!curr->marked.load(std::memory_order_acquire)) nodes.push_back(curr);
+        curr = curr->nexts[layer].load(std::memory_order_acquire);
+      }
+      if (nodes.size() >= num_chunks) break;
+    }
+    if (nodes.size() < 2) return points;
+
+    // The first node is always the beginning of the first chunk, so only the
+    // remaining boundaries are returned.
+    const uint64_t chunks = std::min<uint64_t>(num_chunks, nodes.size());
+    points.reserve(chunks - 1);
+    for (uint64_t i = 1; i < chunks; ++i) {
+      points.push_back(Iterator{nodes[i * nodes.size() / chunks]});
+    }
+    return points;
+  }
+
   bool ok_to_delete(TNode *candidate, int layer_found) {
     // The paper has an incorrect check here. It expects the `layer_found`
     // variable to be 1-indexed, but in fact it is 0-indexed.
@@ -159,6 +159,21 @@ startup_config_dict = {
         "mid",
         "Compression level for storing properties. Allowed values: low, mid, high.",
     ),
+    "storage_dictionary_encoded_properties": (
+        "",
+        "",
+        "Comma-separated list of properties whose string values are interned in a dictionary shared by all vertices and edges of a database, so each distinct value is kept in memory only once per database. Meant for properties with few distinct values.",
+    ),
+    "storage_dictionary_max_strings": (
+        "100000",
+        "100000",
+        "Maximum number of distinct strings in the dictionary of a database. Interned strings are kept until the database is cleared, so once the dictionary is full new values are stored inline.",
+    ),
+    "storage_property_store_directory_threshold": (
+        "16",
+        "16",
+        "Number of properties from which a property store keeps a directory of property offsets, so that a single property can be found without decoding the ones before it. 0 disables the directory.",
+    ),
     "password_encryption_algorithm": ("bcrypt", "bcrypt", "The password encryption algorithm used for authentication."),
     "pulsar_service_url": ("", "", "Default URL used while connecting to Pulsar brokers."),
     "query_execution_timeout_sec": (
@@ -181,7 +196,42 @@ startup_config_dict = {
         "true",
         "Controls whether updating a property with the same value should create a delta object.",
     ),
+    "storage_merge_property_deltas": (
+        "false",
+        "false",
+        "Controls whether committing transactions merge their property deltas with older deltas on the same property which no running transaction can tell apart, so objects updated often keep short delta chains.",
+    ),
+    "storage_disk_object_cache_size": (
+        "100000",
+        "100000",
+        "Number of vertices and edges read by transactions in the on-disk storage mode which are kept in a cache shared by all transactions, so reading them again skips RocksDB. 0 disables the cache.",
+    ),
+    "storage_freeze_adjacency": (
+        "false",
+        "false",
+        "Controls whether edges of each vertex should be sorted by edge type and neighbour after recovery and after switching from the analytical storage mode, so expansions by edge type don't scan all edges.",
+    ),
+    "storage_freeze_adjacency_degree": (
+        "10000",
+        "10000",
+        "Edges of a vertex get sorted by edge type and neighbour once the vertex has this many edges in one direction, so expansions by edge type don't scan all edges of a supernode. 0 disables it.",
+    ),
+    "storage_label_property_index_hash_lookups": (
+        "false",
+        "false",
+        "Controls whether label+property indices keep a hash table of their entries, so lookups of a single value don't search the index. Uses additional memory for every index entry.",
+    ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
+    "storage_gc_workers": (
+        "1",
+        "1",
+        "Number of threads the storage garbage collector uses to unlink deltas and clean up indices. Each database starts its own helper threads.",
+    ),
+    "storage_gc_max_transactions_per_run": (
+        "0",
+        "0",
+        "Maximum number of transactions unlinked by one periodic garbage collector run. Runs are repeated until the backlog is worked off, releasing the storage locks in between. 0 means no limit.",
+    ),
     "storage_python_gc_cycle_sec": ("180", "180", "Storage python full garbage collection interval (in seconds)."),
     "storage_items_per_batch": (
         "1000000",
@@ -190,6 +240,7 @@ startup_config_dict = {
     ),
     "storage_properties_on_edges": ("false", "true", "Controls whether edges have properties."),
     "storage_recovery_thread_count": ("12", "12", "The number of threads used to recover persisted data from disk."),
+    "storage_snapshot_thread_count": ("12", "12", "The number of threads used to create snapshots."),
     "storage_snapshot_interval_sec": (
         "0",
         "300",
@@ -197,6 +248,13 @@ startup_config_dict = {
     ),
     "storage_snapshot_on_exit": ("false", "false", "Controls whether the storage creates another snapshot on exit."),
     "storage_snapshot_retention_count": ("3", "3", "The number of snapshots that should always be kept."),
+    "storage_snapshot_skip_threshold_percent": (
+        "0",
+        "0",
+        "Skip a periodic snapshot while the changes committed since the last snapshot stay below this "
+        "percentage of the graph; the WAL files keep those changes durable. Without WAL only "
+        "snapshots with no change since the last one are skipped. Set to 0 to always create snapshots.",
+    ),
     "storage_wal_enabled": (
         "false",
         "true",
@@ -207,6 +265,13 @@ startup_config_dict = {
         "100000",
         "Issue a 'fsync' call after this amount of transactions are written to the WAL file. Set to 1 for fully synchronous operation.",
     ),
+    "storage_wal_group_commit": (
+        "false",
+        "false",
+        "Make every transaction durable before its commit returns. The 'fsync' calls are issued after the "
+        "transactions are committed and are shared by all transactions committed in the meantime. Overrides "
+        "storage_wal_file_flush_every_n_tx.",
+    ),
     "storage_mode": (
         "IN_MEMORY_TRANSACTIONAL",
         "IN_MEMORY_TRANSACTIONAL",
@@ -241,6 +306,30 @@ startup_config_dict = {
         "Maximum count of indexed vertices which provoke indexed lookup and then expand to existing, instead of a regular expand. Default is 10, to turn off use -1.",
     ),
     "query_max_plans": ("1000", "1000", "Maximum number of generated plans for a query."),
+    "query_pull_batch_size": (
+        "0",
+        "0",
+        "Number of results read-only queries pull through the operators at once. Batched execution amortizes the "
+        "per-row overhead of the operators. 0 executes queries row by row.",
+    ),
+    "query_parallel_workers": (
+        "0",
+        "0",
+        "Number of threads a single query can use to scan and aggregate vertices in parallel. Values of 0 and 1 "
+        "disable parallel execution.",
+    ),
+    "query_parallel_scan_threshold": (
+        "100000",
+        "100000",
+        "Minimum estimated number of scanned vertices for which an aggregation is executed in parallel. Only used "
+        "when query_parallel_workers is larger than 1.",
+    ),
+    "query_parallel_expand_threshold": (
+        "1024",
+        "1024",
+        "Minimum number of vertices in a level of a breadth-first shortest path expansion for which the edges of the "
+        "level are read in parallel. Only used when query_parallel_workers is larger than 1.",
+    ),
     "flag_file": ("", "", "load flags from file"),
     "hops_limit_partial_results": (
         "true",
@@ -17,6 +17,14 @@ from common import memgraph
 
 def test_all_show_metrics_info_values_are_present(memgraph):
     expected_metrics = [
+        {"name": "DiskCacheEviction", "type": "DiskCache", "metric type": "Counter"},
+        {"name": "DiskCacheHit", "type": "DiskCache", "metric type": "Counter"},
+        {"name": "DiskCacheMiss", "type": "DiskCache", "metric type": "Counter"},
+        {"name": "GCBacklogTransactions", "type": "GC", "metric type": "Gauge"},
+        {"name": "GCLag_ms", "type": "GC", "metric type": "Gauge"},
+        {"name": "GCLatency_us_50p", "type": "GC", "metric type": "Histogram"},
+        {"name": "GCLatency_us_90p", "type": "GC", "metric type": "Histogram"},
+        {"name": "GCLatency_us_99p", "type": "GC", "metric type": "Histogram"},
         {"name": "AverageDegree", "type": "General", "metric type": "Gauge"},
         {"name": "EdgeCount", "type": "General", "metric type": "Gauge"},
         {"name": "VertexCount", "type": "General", "metric type": "Gauge"},
@@ -76,9 +84,16 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "SkipOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "UnionOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "UnwindOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "PlanCacheEviction", "type": "PlanCache", "metric type": "Counter"},
+        {"name": "PlanCacheHit", "type": "PlanCache", "metric type": "Counter"},
+        {"name": "PlanCacheInvalidation", "type": "PlanCache", "metric type": "Counter"},
+        {"name": "PlanCacheMiss", "type": "PlanCache", "metric type": "Counter"},
         {"name": "QueryExecutionLatency_us_50p", "type": "Query", "metric type": "Histogram"},
         {"name": "QueryExecutionLatency_us_90p", "type": "Query", "metric type": "Histogram"},
         {"name": "QueryExecutionLatency_us_99p", "type": "Query", "metric type": "Histogram"},
+        {"name": "QueryPlanningLatency_us_50p", "type": "Query", "metric type": "Histogram"},
+        {"name": "QueryPlanningLatency_us_90p", "type": "Query", "metric type": "Histogram"},
+        {"name": "QueryPlanningLatency_us_99p", "type": "Query", "metric type": "Histogram"},
         {"name": "ReadQuery", "type": "QueryType", "metric type": "Counter"},
         {"name": "ReadWriteQuery", "type": "QueryType", "metric type": "Counter"},
         {"name": "WriteQuery", "type": "QueryType", "metric type": "Counter"},
@@ -96,7 +111,11 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "SnapshotRecoveryLatency_us_90p", "type": "Snapshot", "metric type": "Histogram"},
         {"name": "SnapshotRecoveryLatency_us_99p", "type": "Snapshot", "metric type": "Histogram"},
         {"name": "MessagesConsumed", "type": "Stream", "metric type": "Counter"},
+        {"name": "StreamQueriesExecuted", "type": "Stream", "metric type": "Counter"},
         {"name": "StreamsCreated", "type": "Stream", "metric type": "Counter"},
+        {"name": "StreamBatchLatency_us_50p", "type": "Stream", "metric type": "Histogram"},
+        {"name": "StreamBatchLatency_us_90p", "type": "Stream", "metric type": "Histogram"},
+        {"name": "StreamBatchLatency_us_99p", "type": "Stream", "metric type": "Histogram"},
         {"name": "DeletedEdges", "type": "TTL", "metric type": "Counter"},
         {"name": "DeletedNodes", "type": "TTL", "metric type": "Counter"},
         {"name": "ActiveTransactions", "type": "Transaction", "metric type": "Counter"},
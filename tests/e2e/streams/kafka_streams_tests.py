@@ -252,6 +252,66 @@ def test_restart_after_error(kafka_producer, kafka_topics, connection):
     assert common.check_one_result_row(cursor, "MATCH (n:VERTEX { id : 42 }) RETURN n")
 
 
+def get_metric_value(cursor, metric_name):
+    for name, _, _, value in common.execute_and_fetch_all(cursor, "SHOW METRICS INFO"):
+        if name == metric_name:
+            return value
+    assert False, f"Metric {metric_name} doesn't exist"
+
+
+def test_batch_of_messages_is_committed_together(kafka_producer, kafka_topics, connection):
+    BATCH_SIZE = 5
+    cursor = connection.cursor()
+    stream_name = "test_batch_of_messages_is_committed_together"
+    # Every message is transformed into the same query, so all of them are
+    # executed as one batch of queries.
+    common.create_stream(
+        cursor,
+        stream_name,
+        kafka_topics[0],
+        "kafka_transform.with_parameters",
+        batch_interval=10000,
+        batch_size=BATCH_SIZE,
+    )
+    queries_executed = get_metric_value(cursor, "StreamQueriesExecuted")
+    common.start_stream(cursor, stream_name)
+
+    for i in range(BATCH_SIZE):
+        kafka_producer.send(kafka_topics[0], f"message_{i}".encode()).get(
+            timeout=KAFKA_PRODUCER_SENDING_MSG_DEFAULT_TIMEOUT
+        )
+
+    def vertex_count():
+        count = common.execute_and_fetch_all(cursor, "MATCH (n:MESSAGE) RETURN count(n)")[0][0]
+        # The batch is committed in a single transaction, so its vertices
+        # appear all at once.
+        assert count in (0, BATCH_SIZE)
+        return count
+
+    assert mg_sleep_and_assert(BATCH_SIZE, vertex_count)
+    assert get_metric_value(cursor, "StreamQueriesExecuted") == queries_executed + BATCH_SIZE
+    for i in range(BATCH_SIZE):
+        common.kafka_check_vertex_exists_with_topic_and_payload(cursor, kafka_topics[0], f"message_{i}".encode())
+
+
+def test_failed_batch_is_rolled_back(kafka_producer, kafka_topics, connection):
+    cursor = connection.cursor()
+    stream_name = "test_failed_batch_is_rolled_back"
+    common.create_stream(
+        cursor, stream_name, kafka_topics[0], "kafka_transform.query", batch_interval=10000, batch_size=3
+    )
+    queries_executed = get_metric_value(cursor, "StreamQueriesExecuted")
+    common.start_stream(cursor, stream_name)
+
+    # The last message isn't a valid query, so the whole batch fails.
+    for message in [b"CREATE (n:VERTEX { id : 1 })", b"CREATE (n:VERTEX { id : 2 })", common.SIMPLE_MSG]:
+        kafka_producer.send(kafka_topics[0], message).get(timeout=KAFKA_PRODUCER_SENDING_MSG_DEFAULT_TIMEOUT)
+    assert common.timed_wait(lambda: not common.get_is_running(cursor, stream_name))
+
+    assert common.execute_and_fetch_all(cursor, "MATCH (n:VERTEX) RETURN count(n)")[0][0] == 0
+    assert get_metric_value(cursor, "StreamQueriesExecuted") == queries_executed
+
+
 @pytest.mark.parametrize("transformation", TRANSFORMATIONS_TO_CHECK_PY)
 def test_bootstrap_server(kafka_producer, kafka_topics, connection, transformation):
     assert len(kafka_topics) > 0
@@ -273,6 +273,23 @@ class InteractiveDbAccessor {
     return label_property_index_.at(key);
   }
 
+  // Composite indices aren't offered interactively, so plans never scan them
+  std::vector<std::pair<memgraph::storage::LabelId, std::vector<memgraph::storage::PropertyId>>>
+  ListCompositeIndices() {
+    return {};
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId label_id,
+                        const std::vector<memgraph::storage::PropertyId> & /*properties*/) {
+    return VerticesCount(label_id);
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId label_id,
+                        const std::vector<memgraph::storage::PropertyId> & /*properties*/,
+                        const std::vector<memgraph::storage::PropertyValue> & /*values*/) {
+    return VerticesCount(label_id);
+  }
+
   bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type_id) { return true; }
 
   bool EdgeTypePropertyIndexExists(memgraph::storage::EdgeTypeId edge_type_id,
@@ -12,6 +12,7 @@
 #include "bfs_common.hpp"
 
 #include "disk_test_utils.hpp"
+#include "flags/query.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 
@@ -127,6 +128,63 @@ INSTANTIATE_TEST_SUITE_P(FilterLambda, SingleNodeBfsTestInMemory,
                                                           FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
                                                           FilterLambdaType::ERROR)));
 
+// Reads the edges of every expansion level on multiple threads.
+class SingleNodeBfsTestInMemoryParallel
+    : public ::testing::TestWithParam<
+          std::tuple<int, int, EdgeAtom::Direction, std::vector<std::string>, bool, FilterLambdaType>> {
+ public:
+  using StorageType = memgraph::storage::InMemoryStorage;
+  static void SetUpTestCase() {
+    workers_ = FLAGS_query_parallel_workers;
+    threshold_ = FLAGS_query_parallel_expand_threshold;
+    FLAGS_query_parallel_workers = 4;
+    FLAGS_query_parallel_expand_threshold = 1;
+    db_ = std::make_unique<SingleNodeDb<StorageType>>();
+  }
+  static void TearDownTestCase() {
+    db_ = nullptr;
+    FLAGS_query_parallel_workers = workers_;
+    FLAGS_query_parallel_expand_threshold = threshold_;
+  }
+
+ protected:
+  static std::unique_ptr<SingleNodeDb<StorageType>> db_;
+  static uint64_t workers_;
+  static uint64_t threshold_;
+};
+
+TEST_P(SingleNodeBfsTestInMemoryParallel, All) {
+  int lower_bound;
+  int upper_bound;
+  EdgeAtom::Direction direction;
+  std::vector<std::string> edge_types;
+  bool known_sink;
+  FilterLambdaType filter_lambda_type;
+  std::tie(lower_bound, upper_bound, direction, edge_types, known_sink, filter_lambda_type) = GetParam();
+  this->db_->BfsTest(db_.get(), lower_bound, upper_bound, direction, edge_types, known_sink, filter_lambda_type);
+}
+
+std::unique_ptr<SingleNodeDb<SingleNodeBfsTestInMemoryParallel::StorageType>> SingleNodeBfsTestInMemoryParallel::db_{
+    nullptr};
+uint64_t SingleNodeBfsTestInMemoryParallel::workers_{0};
+uint64_t SingleNodeBfsTestInMemoryParallel::threshold_{0};
+
+INSTANTIATE_TEST_SUITE_P(DirectionAndExpansionDepth, SingleNodeBfsTestInMemoryParallel,
+                         testing::Combine(testing::Range(-1, kVertexCount), testing::Range(-1, kVertexCount),
+                                          testing::Values(EdgeAtom::Direction::OUT, EdgeAtom::Direction::IN,
+                                                          EdgeAtom::Direction::BOTH),
+                                          testing::Values(std::vector<std::string>{}), testing::Values(true),
+                                          testing::Values(FilterLambdaType::NONE)));
+
+INSTANTIATE_TEST_SUITE_P(FilterLambda, SingleNodeBfsTestInMemoryParallel,
+                         testing::Combine(testing::Values(-1), testing::Values(-1),
+                                          testing::Values(EdgeAtom::Direction::OUT, EdgeAtom::Direction::IN,
+                                                          EdgeAtom::Direction::BOTH),
+                                          testing::Values(std::vector<std::string>{}), testing::Values(true),
+                                          testing::Values(FilterLambdaType::NONE, FilterLambdaType::USE_FRAME,
+                                                          FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
+                                                          FilterLambdaType::ERROR)));
+
 class SingleNodeBfsTestOnDisk
     : public ::testing::TestWithParam<
           std::tuple<int, int, EdgeAtom::Direction, std::vector<std::string>, bool, FilterLambdaType>> {
@@ -19,6 +19,7 @@
 #include "communication/bolt/v1/encoder/encoder.hpp"
 #include "disk_test_utils.hpp"
 #include "glue/communication.hpp"
+#include "glue/result_encoder.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/storage.hpp"
@@ -242,6 +243,48 @@ TEST_F(BoltEncoder, VertexAndEdgeOnDiskStorage) {
   disk_test_utils::RemoveRocksDbDirs(testSuite);
 }
 
+TEST_F(BoltEncoder, ResultEncoderMatchesValueEncoding) {
+  std::unique_ptr<memgraph::storage::Storage> db{new memgraph::storage::InMemoryStorage()};
+  auto dba = db->Access();
+  auto va1 = dba->CreateVertex();
+  auto va2 = dba->CreateVertex();
+  ASSERT_TRUE(va1.AddLabel(dba->NameToLabel("label1")).HasValue());
+  ASSERT_TRUE(va1.AddLabel(dba->NameToLabel("label2")).HasValue());
+  ASSERT_TRUE(va1.SetProperty(dba->NameToProperty("prop1"), memgraph::storage::PropertyValue(12)).HasValue());
+  ASSERT_TRUE(
+      va1.SetProperty(dba->NameToProperty("prop2"), memgraph::storage::PropertyValue(std::vector{
+                                                        memgraph::storage::PropertyValue(std::string("string")),
+                                                        memgraph::storage::PropertyValue(3.14)}))
+          .HasValue());
+  auto ea = dba->CreateEdge(&va1, &va2, dba->NameToEdgeType("edgetype")).GetValue();
+  ASSERT_TRUE(ea.SetProperty(dba->NameToProperty("prop3"), memgraph::storage::PropertyValue(42)).HasValue());
+
+  // The property ids are created in the order of the names, so the properties
+  // are written in the same order by both encodings.
+  std::vector<memgraph::query::TypedValue> values{
+      memgraph::query::TypedValue(memgraph::query::VertexAccessor(va1)),
+      memgraph::query::TypedValue(std::vector<memgraph::query::TypedValue>{
+          memgraph::query::TypedValue(memgraph::query::VertexAccessor(va2)), memgraph::query::TypedValue()}),
+      memgraph::query::TypedValue(memgraph::query::EdgeAccessor(ea)),
+      memgraph::query::TypedValue(std::map<std::string, memgraph::query::TypedValue>{
+          {"key", memgraph::query::TypedValue("value")}}),
+      memgraph::query::TypedValue(memgraph::utils::Date(1234)),
+  };
+
+  std::vector<Value> vals;
+  for (const auto &value : values) {
+    vals.push_back(*memgraph::glue::ToBoltValue(value, db.get(), memgraph::storage::View::NEW));
+  }
+  bolt_encoder.MessageRecord(vals);
+  const auto expected = output;
+  output.clear();
+
+  memgraph::glue::ResultEncoder result_encoder(db.get(), memgraph::storage::View::NEW);
+  ASSERT_FALSE(result_encoder.Prepare(values).HasError());
+  bolt_encoder.MessageRecord(values.size(), [&](auto &encoder) { result_encoder.Write(encoder, values); });
+  EXPECT_EQ(output, expected);
+}
+
 TEST_F(BoltEncoder, BoltV1ExampleMessages) {
   // this test checks example messages from: http://boltprotocol.org/v1/
 
@@ -79,3 +79,27 @@ TEST(CommitLog, TrackAfterInitialId) {
     check_marking_ids(&log, i);
   }
 }
+
+TEST(CommitLog, AllFinished) {
+  memgraph::storage::CommitLog log;
+  EXPECT_TRUE(log.AllFinished(5, 5));
+  EXPECT_FALSE(log.AllFinished(0, 1));
+
+  for (uint64_t i = 0; i < 200; ++i) {
+    if (i != 70) log.MarkFinished(i);
+  }
+  EXPECT_TRUE(log.AllFinished(0, 70));
+  EXPECT_TRUE(log.AllFinished(71, 200));
+  EXPECT_FALSE(log.AllFinished(60, 80));
+  EXPECT_FALSE(log.AllFinished(150, 250));
+
+  log.MarkFinished(70);
+  EXPECT_TRUE(log.AllFinished(0, 200));
+
+  for (uint64_t i = ids_per_block - 10; i < ids_per_block + 10; ++i) {
+    log.MarkFinished(i);
+  }
+  EXPECT_TRUE(log.AllFinished(ids_per_block - 10, ids_per_block + 10));
+  EXPECT_FALSE(log.AllFinished(ids_per_block - 11, ids_per_block + 10));
+  EXPECT_FALSE(log.AllFinished(ids_per_block - 10, ids_per_block + 11));
+}
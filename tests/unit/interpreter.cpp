@@ -36,10 +36,16 @@
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/storage_mode.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/logging.hpp"
 #include "utils/lru_cache.hpp"
 #include "utils/synchronized.hpp"
 
+namespace memgraph::metrics {
+extern const Event PlanCacheMiss;
+extern const Event PlanCacheInvalidation;
+}  // namespace memgraph::metrics
+
 namespace {
 
 auto ToEdgeList(const memgraph::communication::bolt::Value &v) {
@@ -1129,6 +1135,27 @@ TYPED_TEST(InterpreterTest, CacheableQueries) {
   }
 }
 
+TYPED_TEST(InterpreterTest, IndexInvalidatesOnlyDependentPlans) {
+  auto plan_cache_size = [&] { return this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }); };
+  this->Interpret("MATCH (n:A) RETURN n");
+  this->Interpret("MATCH (n:B) RETURN n");
+  EXPECT_EQ(plan_cache_size(), 2U);
+
+  const auto misses = memgraph::metrics::GetCounterValue(memgraph::metrics::PlanCacheMiss);
+  const auto invalidations = memgraph::metrics::GetCounterValue(memgraph::metrics::PlanCacheInvalidation);
+
+  // Only the plan using :A can change because of the new index.
+  this->Interpret("CREATE INDEX ON :A");
+  EXPECT_EQ(plan_cache_size(), 1U);
+  EXPECT_EQ(memgraph::metrics::GetCounterValue(memgraph::metrics::PlanCacheInvalidation), invalidations + 1);
+
+  this->Interpret("MATCH (n:A) RETURN n");
+  this->Interpret("MATCH (n:B) RETURN n");
+  EXPECT_EQ(plan_cache_size(), 2U);
+  EXPECT_EQ(memgraph::metrics::GetCounterValue(memgraph::metrics::PlanCacheMiss), misses + 1);
+  EXPECT_EQ(memgraph::metrics::GetCounterValue(memgraph::metrics::PlanCacheInvalidation), invalidations + 1);
+}
+
 TYPED_TEST(InterpreterTest, AllowLoadCsvConfig) {
   const auto check_load_csv_queries = [&](const bool allow_load_csv) {
     TmpDirManager directory_manager{"allow_load_csv"};
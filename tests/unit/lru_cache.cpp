@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -109,3 +109,32 @@ TEST(LRUCacheTest, LargeCacheTest) {
     EXPECT_EQ(value.value(), i);
   }
 }
+
+TEST(LRUCacheTest, EvictionCountTest) {
+  memgraph::utils::LRUCache<int, int> cache(2);
+  EXPECT_EQ(cache.put(1, 1), 0);
+  EXPECT_EQ(cache.put(2, 2), 0);
+  EXPECT_EQ(cache.put(2, 20), 0);
+  EXPECT_EQ(cache.put(3, 3), 1);
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(LRUCacheTest, EraseIfTest) {
+  memgraph::utils::LRUCache<int, int> cache(10);
+  for (int i = 0; i < 10; i++) {
+    cache.put(i, i * 10);
+  }
+
+  EXPECT_EQ(cache.erase_if([](int key, int value) { return key % 2 == 0 || value == 30; }), 6);
+  EXPECT_EQ(cache.size(), 4);
+
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(cache.get(i).has_value(), i % 2 == 1 && i != 3);
+  }
+
+  // Removed entries don't count towards the size of the cache anymore.
+  for (int i = 10; i < 16; i++) {
+    EXPECT_EQ(cache.put(i, i), 0);
+  }
+  EXPECT_EQ(cache.put(16, 16), 1);
+}
@@ -248,6 +248,21 @@ TEST_F(QueryCostEstimator, Filter) {
           CardParam::kFilter);
 }
 
+TEST_F(QueryCostEstimator, FilterLabelSelectivity) {
+  AddVertices(100, 30, 20);
+  auto scan_symbol = NextSymbol();
+  MakeOp<ScanAll>(last_op_, scan_symbol);
+  FilterInfo label_filter(FilterInfo::Type::Label, Literal(true), {scan_symbol});
+  label_filter.labels.push_back(storage_.GetLabelIx("label"));
+  Filters filters;
+  filters.SetFilters({label_filter});
+  MakeOp<Filter>(last_op_, std::vector<std::shared_ptr<LogicalOperator>>{}, Literal(true), filters);
+  MakeOp<Expand>(last_op_, scan_symbol, NextSymbol(), NextSymbol(), EdgeAtom::Direction::IN,
+                 std::vector<memgraph::storage::EdgeTypeId>{}, false, memgraph::storage::View::OLD);
+  // the label index tells that 30% of the scanned vertices pass the filter
+  EXPECT_COST(100 * CostParam::kScanAll + 100 * CostParam::kFilter + 30 * CostParam::kExpand);
+}
+
 TEST_F(QueryCostEstimator, EdgeUniquenessFilter) {
   TEST_OP(MakeOp<EdgeUniquenessFilter>(last_op_, NextSymbol(), std::vector<Symbol>()), CostParam::kEdgeUniquenessFilter,
           CardParam::kEdgeUniquenessFilter);
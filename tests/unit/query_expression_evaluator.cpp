@@ -13,6 +13,7 @@
 #include <cmath>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -26,6 +27,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/opencypher/parser.hpp"
 #include "query/interpret/awesome_memgraph_functions.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/interpret/frame.hpp"
 #include "query/path.hpp"
@@ -1471,6 +1473,88 @@ TYPED_TEST(ExpressionEvaluatorPropertyLookup, Map) {
   EXPECT_TRUE(this->Value(this->prop_height).IsNull());
 }
 
+TYPED_TEST(ExpressionEvaluatorPropertyLookup, CompiledComparison) {
+  const std::vector<memgraph::storage::PropertyValue> stored_values{
+      memgraph::storage::PropertyValue(10), memgraph::storage::PropertyValue(10.5),
+      memgraph::storage::PropertyValue(NAN), memgraph::storage::PropertyValue("abc"),
+      memgraph::storage::PropertyValue(true), memgraph::storage::PropertyValue()};
+  const std::vector<memgraph::storage::PropertyValue> constants{memgraph::storage::PropertyValue(10),
+                                                                memgraph::storage::PropertyValue(2.5),
+                                                                memgraph::storage::PropertyValue("abd")};
+
+  // Evaluates the expression both ways and expects the same result or an
+  // exception from both.
+  auto check = [this](Expression *expression) {
+    this->ctx.properties = NamesToProperties(this->storage.properties_, &this->dba);
+    std::optional<TypedValue> expected;
+    try {
+      expected = expression->Accept(this->eval);
+    } catch (const QueryRuntimeException &) {
+    }
+    CompiledExpression compiled(expression, this->eval);
+    if (!expected) {
+      EXPECT_THROW(compiled.Evaluate(this->eval), QueryRuntimeException);
+      return;
+    }
+    auto value = compiled.Evaluate(this->eval);
+    ASSERT_EQ(value.type(), expected->type());
+    if (value.IsBool()) EXPECT_EQ(value.ValueBool(), expected->ValueBool());
+  };
+
+  auto make_comparisons = [this](Expression *lhs, Expression *rhs) -> std::vector<Expression *> {
+    return {this->storage.template Create<EqualOperator>(lhs, rhs),
+            this->storage.template Create<NotEqualOperator>(lhs, rhs),
+            this->storage.template Create<LessOperator>(lhs, rhs),
+            this->storage.template Create<GreaterOperator>(lhs, rhs),
+            this->storage.template Create<LessEqualOperator>(lhs, rhs),
+            this->storage.template Create<GreaterEqualOperator>(lhs, rhs)};
+  };
+
+  for (const auto &stored : stored_values) {
+    auto vertex = this->dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(this->prop_age.second, stored).HasValue());
+    this->dba.AdvanceCommand();
+    this->frame[this->symbol] = TypedValue(vertex);
+    for (const auto &constant : constants) {
+      auto *lookup = this->storage.template Create<PropertyLookup>(this->identifier,
+                                                                  this->storage.GetPropertyIx(this->prop_age.first));
+      auto *literal = this->storage.template Create<PrimitiveLiteral>(constant);
+      for (auto *expression : make_comparisons(lookup, literal)) {
+        SCOPED_TRACE(::testing::Message() << stored << " " << expression->GetTypeInfo().name << " " << constant);
+        check(expression);
+      }
+      for (auto *expression : make_comparisons(literal, lookup)) {
+        SCOPED_TRACE(::testing::Message() << constant << " " << expression->GetTypeInfo().name << " " << stored);
+        check(expression);
+      }
+    }
+  }
+}
+
+TYPED_TEST(ExpressionEvaluatorPropertyLookup, CompiledConstantFolding) {
+  this->ctx.properties = NamesToProperties(this->storage.properties_, &this->dba);
+  {
+    auto *expression = this->storage.template Create<AdditionOperator>(
+        this->storage.template Create<PrimitiveLiteral>(1), this->storage.template Create<PrimitiveLiteral>(2));
+    CompiledExpression compiled(expression, this->eval);
+    EXPECT_EQ(compiled.Evaluate(this->eval).ValueInt(), 3);
+  }
+  {
+    // Errors of constant subexpressions are raised only when evaluating.
+    auto *expression = this->storage.template Create<DivisionOperator>(
+        this->storage.template Create<PrimitiveLiteral>(1), this->storage.template Create<PrimitiveLiteral>(0));
+    std::optional<CompiledExpression> compiled;
+    ASSERT_NO_THROW(compiled.emplace(expression, this->eval));
+    EXPECT_THROW(compiled->Evaluate(this->eval), QueryRuntimeException);
+  }
+  {
+    auto *expression = this->storage.template Create<AndOperator>(
+        this->storage.template Create<PrimitiveLiteral>(false), this->storage.template Create<PrimitiveLiteral>(5));
+    CompiledExpression compiled(expression, this->eval);
+    EXPECT_FALSE(compiled.EvaluateFilter(this->eval));
+  }
+}
+
 template <typename StorageType>
 class ExpressionEvaluatorAllPropertiesLookup : public ExpressionEvaluatorTest<StorageType> {
  protected:
@@ -1717,6 +1717,51 @@ TYPED_TEST(TestPlanner, WherePreferEqualityIndexOverRange) {
             ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, WhereCompositeIndexPrefixAndRange) {
+  // Test MATCH (n :label) WHERE n.tenant = 1 AND n.created > 42 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto tenant = PROPERTY_PAIR(dba, "tenant");
+  auto created = PROPERTY_PAIR(dba, "created");
+  // The single property index covers fewer vertices, but the composite index
+  // matches both filters.
+  dba.SetIndexCount(label, tenant.second, 1);
+  dba.SetIndexCount(label, std::vector{tenant.second, created.second}, 10);
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(AND(EQ(PROPERTY_LOOKUP(dba, "n", tenant), LITERAL(1)),
+                                             GREATER(PROPERTY_LOOKUP(dba, "n", created), lit_42))),
+                                   RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByLabelPropertyRange(label, created.second, Bound(lit_42, Bound::Type::EXCLUSIVE),
+                                              std::nullopt),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, WhereCompositeIndexEquality) {
+  // Test MATCH (n :label) WHERE n.a = 1 AND n.b = 42 AND n.c = 2 RETURN n
+  // with a composite index on :label(a, b, d), so only a and b are matched.
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR(dba, "a");
+  auto b = PROPERTY_PAIR(dba, "b");
+  auto c = PROPERTY_PAIR(dba, "c");
+  auto d = PROPERTY_PAIR(dba, "d");
+  dba.SetIndexCount(label, std::vector{a.second, b.second, d.second}, 10);
+  auto lit_42 = LITERAL(42);
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))),
+      WHERE(AND(AND(EQ(PROPERTY_LOOKUP(dba, "n", a), LITERAL(1)), EQ(PROPERTY_LOOKUP(dba, "n", b), lit_42)),
+                EQ(PROPERTY_LOOKUP(dba, "n", c), LITERAL(2)))),
+      RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelPropertyValue(label, b, lit_42), ExpectFilter(),
+            ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, UnableToUsePropertyIndex) {
   // Test MATCH (n: label) WHERE n.property = n.property RETURN n
   FakeDbAccessor dba;
@@ -18,12 +18,14 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "flags/query.hpp"
 #include "query/context.hpp"
 #include "query/exceptions.hpp"
 #include "query/plan/operator.hpp"
 #include "query_plan_common.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using memgraph::replication_coordination_glue::ReplicationRole;
 
@@ -400,6 +402,9 @@ TYPED_TEST(QueryPlanTest, AggregateMultipleGroupBy) {
   auto context = MakeContext(this->storage, symbol_table, &dba);
   auto results = CollectProduce(*produce, &context);
   EXPECT_EQ(results.size(), 2 * 3 * 5);
+  for (size_t batch_size : {1, 7, 30, 100}) {
+    EXPECT_EQ(CollectProduceMultiple(*produce, &context, batch_size).size(), 2 * 3 * 5);
+  }
 }
 
 TYPED_TEST(QueryPlanTest, AggregateNoInput) {
@@ -415,6 +420,77 @@ TYPED_TEST(QueryPlanTest, AggregateNoInput) {
   EXPECT_EQ(1, results[0].size());
   EXPECT_EQ(TypedValue::Type::Int, results[0][0].type());
   EXPECT_EQ(1, results[0][0].ValueInt());
+
+  auto batched_results = CollectProduceMultiple(*produce, &context, 4);
+  ASSERT_EQ(1, batched_results.size());
+  EXPECT_EQ(1, batched_results[0][0].ValueInt());
+}
+
+TYPED_TEST(QueryPlanTest, AggregateParallel) {
+  // MATCH (n:l) WHERE n.x > 100 RETURN n.group, count(n.x), sum(n.x), min(n.x), max(n.x), avg(n.x), collect(n.x)
+  // executed on a single thread and on multiple threads must return the same
+  // results
+  auto label = this->db->NameToLabel("l");
+  {
+    auto unique_acc = this->db->UniqueAccess();
+    [[maybe_unused]] auto _ = unique_acc->CreateIndex(label);
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto prop_x = dba.NameToProperty("x");
+  auto prop_group = dba.NameToProperty("group");
+  for (int i = 0; i < 5000; ++i) {
+    auto v = dba.InsertVertex();
+    if (i % 4 != 0) ASSERT_TRUE(v.AddLabel(label).HasValue());
+    ASSERT_TRUE(v.SetProperty(prop_x, memgraph::storage::PropertyValue(i)).HasValue());
+    ASSERT_TRUE(v.SetProperty(prop_group, memgraph::storage::PropertyValue(i % 3)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  const auto aggregation_ops = std::vector<Aggregation::Op>{Aggregation::Op::COUNT, Aggregation::Op::SUM,
+                                                            Aggregation::Op::MIN,   Aggregation::Op::MAX,
+                                                            Aggregation::Op::AVG,   Aggregation::Op::COLLECT_LIST};
+  auto collect = [&](bool by_label) {
+    SymbolTable symbol_table;
+    auto n = by_label ? MakeScanAllByLabel(this->storage, symbol_table, "n", label)
+                      : MakeScanAll(this->storage, symbol_table, "n");
+    auto n_x = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop_x);
+    auto n_group = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop_group);
+    auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                           GREATER(n_x, LITERAL(100)));
+    auto produce = this->MakeAggregationProduce(filter, symbol_table, std::vector<Expression *>(6, n_x),
+                                                aggregation_ops, {n_group}, {}, false);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*produce, &context);
+    std::sort(results.begin(), results.end(),
+              [](const auto &a, const auto &b) { return a.back().ValueInt() < b.back().ValueInt(); });
+    return results;
+  };
+
+  const auto workers = FLAGS_query_parallel_workers;
+  const auto threshold = FLAGS_query_parallel_scan_threshold;
+  memgraph::utils::OnScopeExit restore_flags{[&] {
+    FLAGS_query_parallel_workers = workers;
+    FLAGS_query_parallel_scan_threshold = threshold;
+  }};
+
+  for (bool by_label : {false, true}) {
+    FLAGS_query_parallel_workers = 0;
+    auto serial_results = collect(by_label);
+    ASSERT_EQ(serial_results.size(), 3);
+
+    FLAGS_query_parallel_workers = 4;
+    FLAGS_query_parallel_scan_threshold = 1;
+    auto parallel_results = collect(by_label);
+    ASSERT_EQ(parallel_results.size(), serial_results.size());
+    for (size_t row = 0; row < serial_results.size(); ++row) {
+      ASSERT_EQ(parallel_results[row].size(), serial_results[row].size());
+      for (size_t col = 0; col < serial_results[row].size(); ++col) {
+        EXPECT_TRUE(TypedValue::BoolEqual{}(parallel_results[row][col], serial_results[row][col]));
+      }
+    }
+  }
 }
 
 TYPED_TEST(QueryPlanTest, AggregateCountEdgeCases) {
@@ -693,6 +693,21 @@ class FakeDbAccessor {
     return 0;
   }
 
+  int64_t VerticesCount(memgraph::storage::LabelId label,
+                        const std::vector<memgraph::storage::PropertyId> &properties) const {
+    for (const auto &index : composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        return std::get<2>(index);
+      }
+    }
+    return 0;
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties,
+                        const std::vector<memgraph::storage::PropertyValue> & /*values*/) const {
+    return VerticesCount(label, properties);
+  }
+
   int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type) const {
     auto found = edge_type_index_.find(edge_type);
     if (found != edge_type_index_.end()) return found->second;
@@ -721,6 +736,15 @@ class FakeDbAccessor {
     return false;
   }
 
+  std::vector<std::pair<memgraph::storage::LabelId, std::vector<memgraph::storage::PropertyId>>> ListCompositeIndices()
+      const {
+    std::vector<std::pair<memgraph::storage::LabelId, std::vector<memgraph::storage::PropertyId>>> indices;
+    for (const auto &index : composite_index_) {
+      indices.emplace_back(std::get<0>(index), std::get<1>(index));
+    }
+    return indices;
+  }
+
   bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type) const {
     return edge_type_index_.find(edge_type) != edge_type_index_.end();
   }
@@ -756,6 +780,17 @@ class FakeDbAccessor {
     label_property_index_.emplace_back(label, property, count);
   }
 
+  void SetIndexCount(memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties,
+                     int64_t count) {
+    for (auto &index : composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        std::get<2>(index) = count;
+        return;
+      }
+    }
+    composite_index_.emplace_back(label, properties, count);
+  }
+
   void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, int64_t count) { edge_type_index_[edge_type] = count; }
 
   void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property, int64_t count) {
@@ -814,6 +849,8 @@ class FakeDbAccessor {
 
   std::unordered_map<memgraph::storage::LabelId, int64_t> label_index_;
   std::vector<std::tuple<memgraph::storage::LabelId, memgraph::storage::PropertyId, int64_t>> label_property_index_;
+  std::vector<std::tuple<memgraph::storage::LabelId, std::vector<memgraph::storage::PropertyId>, int64_t>>
+      composite_index_;
   std::unordered_map<memgraph::storage::EdgeTypeId, int64_t> edge_type_index_;
   std::vector<std::tuple<memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId, int64_t>>
       edge_type_property_index_;
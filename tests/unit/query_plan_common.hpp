@@ -22,6 +22,7 @@
 #include "query/db_accessor.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/interpret/frame.hpp"
+#include "query/interpret/multi_frame.hpp"
 #include "query/plan/operator.hpp"
 #include "storage/v2/storage.hpp"
 #include "utils/logging.hpp"
@@ -89,6 +90,43 @@ int PullAll(const LogicalOperator &logical_op, ExecutionContext *context) {
   return count;
 }
 
+/** Helper function that collects all the results from the given Produce using
+ * batched pulls of the given size. */
+std::vector<std::vector<TypedValue>> CollectProduceMultiple(const Produce &produce, ExecutionContext *context,
+                                                            size_t batch_size) {
+  Frame frame(context->symbol_table.max_position());
+  MultiFrame multi_frame(context->symbol_table.max_position(), batch_size, memgraph::utils::NewDeleteResource());
+
+  std::vector<Symbol> symbols;
+  for (auto *named_expression : produce.named_expressions_)
+    symbols.emplace_back(context->symbol_table.at(*named_expression));
+
+  auto cursor = produce.MakeCursor(memgraph::utils::NewDeleteResource());
+  std::vector<std::vector<TypedValue>> results;
+  while (cursor->PullMultiple(frame, multi_frame, *context)) {
+    for (size_t i = 0; i < multi_frame.size(); ++i) {
+      std::vector<TypedValue> values;
+      for (auto &symbol : symbols) values.emplace_back(multi_frame[i][symbol]);
+      results.emplace_back(values);
+    }
+    if (!multi_frame.full()) break;
+  }
+
+  return results;
+}
+
+int PullAllMultiple(const LogicalOperator &logical_op, ExecutionContext *context, size_t batch_size) {
+  Frame frame(context->symbol_table.max_position());
+  MultiFrame multi_frame(context->symbol_table.max_position(), batch_size, memgraph::utils::NewDeleteResource());
+  auto cursor = logical_op.MakeCursor(memgraph::utils::NewDeleteResource());
+  int count = 0;
+  while (cursor->PullMultiple(frame, multi_frame, *context)) {
+    count += static_cast<int>(multi_frame.size());
+    if (!multi_frame.full()) break;
+  }
+  return count;
+}
+
 template <typename... TNamedExpressions>
 auto MakeProduce(std::shared_ptr<LogicalOperator> input, TNamedExpressions... named_expressions) {
   return std::make_shared<Produce>(input, std::vector<NamedExpression *>{named_expressions...});
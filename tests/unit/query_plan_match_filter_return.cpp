@@ -13,6 +13,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query_plan_common.hpp"
 
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -338,6 +339,63 @@ TYPED_TEST(QueryPlan, NodeFilterLabelsAndProperties) {
   EXPECT_EQ(2, PullAll(*produce, &context));
 }
 
+TYPED_TEST(QueryPlan, NodeFilterPullMultiple) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto property = PROPERTY_PAIR(dba, "Property");
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(property.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto *filter_expr = LESS(LITERAL(3), PROPERTY_LOOKUP(dba, n.node_->identifier_, property));
+  auto node_filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{}, filter_expr);
+  auto output = NEXPR("x", PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property))
+                    ->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto produce = MakeProduce(node_filter, output);
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  // Batches smaller than, equal to and larger than the result set.
+  for (size_t batch_size : {1, 4, 6, 100}) {
+    auto results = CollectProduceMultiple(*produce, &context, batch_size);
+    ASSERT_EQ(results.size(), 6);
+    std::vector<int64_t> values;
+    for (const auto &row : results) values.push_back(row[0].ValueInt());
+    EXPECT_THAT(values, testing::UnorderedElementsAre(4, 5, 6, 7, 8, 9));
+  }
+}
+
+TYPED_TEST(QueryPlan, NodeFilterPullMultipleAbort) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto property = PROPERTY_PAIR(dba, "Property");
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(property.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  // The filter drops every row, so a batch is never filled.
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto *filter_expr = LESS(PROPERTY_LOOKUP(dba, n.node_->identifier_, property), LITERAL(0));
+  auto node_filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{}, filter_expr);
+  auto output = NEXPR("x", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto produce = MakeProduce(node_filter, output);
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  EXPECT_EQ(PullAllMultiple(*produce, &context, 10), 0);
+
+  std::atomic<memgraph::query::TransactionStatus> transaction_status{memgraph::query::TransactionStatus::TERMINATED};
+  context.transaction_status = &transaction_status;
+  EXPECT_THROW(PullAllMultiple(*produce, &context, 10), memgraph::query::HintedAbortError);
+}
+
 TYPED_TEST(QueryPlan, NodeFilterMultipleLabels) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -552,6 +610,26 @@ TYPED_TEST(ExpandFixture, Expand) {
   EXPECT_EQ(8, test_expand(EdgeAtom::Direction::BOTH, memgraph::storage::View::OLD));
 }
 
+TYPED_TEST(ExpandFixture, ExpandPullMultiple) {
+  auto test_expand = [&](EdgeAtom::Direction direction, size_t batch_size) {
+    auto n = MakeScanAll(this->storage, this->symbol_table, "n");
+    auto r_m = MakeExpand(this->storage, this->symbol_table, n.op_, n.sym_, "r", direction, {}, "m", false,
+                          memgraph::storage::View::OLD);
+
+    auto output = NEXPR("m", IDENT("m")->MapTo(r_m.node_sym_))
+                      ->MapTo(this->symbol_table.CreateSymbol("named_expression_1", true));
+    auto produce = MakeProduce(r_m.op_, output);
+    auto context = MakeContext(this->storage, this->symbol_table, &this->dba);
+    return PullAllMultiple(*produce, &context, batch_size);
+  };
+
+  for (size_t batch_size : {1, 2, 3, 100}) {
+    EXPECT_EQ(2, test_expand(EdgeAtom::Direction::OUT, batch_size));
+    EXPECT_EQ(2, test_expand(EdgeAtom::Direction::IN, batch_size));
+    EXPECT_EQ(4, test_expand(EdgeAtom::Direction::BOTH, batch_size));
+  }
+}
+
 #ifdef MG_ENTERPRISE
 TYPED_TEST(ExpandFixture, ExpandWithEdgeFiltering) {
   auto test_expand = [&](memgraph::auth::User user, EdgeAtom::Direction direction, memgraph::storage::View view) {
@@ -690,3 +690,53 @@ TYPED_TEST(MgpGraphTest, EdgeSetPropertyWithImmutableGraph) {
   EXPECT_EQ(EXPECT_MGP_NO_ERROR(int, mgp_edge_underlying_graph_is_mutable, edge.get()), 0);
   EXPECT_EQ(mgp_edge_set_property(edge.get(), "property", value.get()), mgp_error::MGP_ERROR_IMMUTABLE_OBJECT);
 }
+
+TYPED_TEST(MgpGraphTest, GraphProjection) {
+  if (std::is_same<TypeParam, memgraph::storage::DiskStorage>::value) {
+    // DiskStorage doesn't support chunked vertex scans
+    return;
+  }
+  std::array<memgraph::storage::Gid, 3> vertex_ids{};
+  {
+    auto accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    std::vector<memgraph::query::VertexAccessor> vertices;
+    for (auto &vertex_id : vertex_ids) {
+      vertices.push_back(accessor.InsertVertex());
+      vertex_id = vertices.back().Gid();
+    }
+    const auto edge_type = accessor.NameToEdgeType("EDGE");
+    const auto weight = accessor.NameToProperty("weight");
+    auto edge = accessor.InsertEdge(&vertices[0], &vertices[1], edge_type);
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_TRUE(edge->SetProperty(weight, memgraph::storage::PropertyValue{2.5}).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[0], &vertices[2], edge_type).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[1], &vertices[2], accessor.NameToEdgeType("OTHER")).HasValue());
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+
+  auto graph = this->CreateGraph(memgraph::storage::View::OLD);
+  auto *projection = EXPECT_MGP_NO_ERROR(mgp_graph_projection *, mgp_graph_projection_create, &graph, nullptr, "EDGE",
+                                         "weight", &this->memory);
+  ASSERT_NE(projection, nullptr);
+  ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_projection_vertices_count, projection), 3);
+  ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_projection_edges_count, projection), 2);
+  const auto *offsets = EXPECT_MGP_NO_ERROR(const uint64_t *, mgp_graph_projection_offsets, projection);
+  EXPECT_THAT(std::vector<uint64_t>(offsets, offsets + 4), ::testing::ElementsAre(0, 2, 2, 2));
+  const auto *targets = EXPECT_MGP_NO_ERROR(const uint64_t *, mgp_graph_projection_targets, projection);
+  EXPECT_THAT(std::vector<uint64_t>(targets, targets + 2), ::testing::UnorderedElementsAre(1, 2));
+  const auto *weights = EXPECT_MGP_NO_ERROR(const double *, mgp_graph_projection_weights, projection);
+  ASSERT_NE(weights, nullptr);
+  EXPECT_EQ(weights[targets[0] == 1 ? 0 : 1], 2.5);
+  EXPECT_EQ(weights[targets[0] == 1 ? 1 : 0], 1.0);
+  for (size_t i = 0; i < vertex_ids.size(); ++i) {
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(mgp_vertex_id, mgp_graph_projection_vertex_id, projection, i).as_int,
+              vertex_ids[i].AsInt());
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_graph_projection_vertex_index, projection,
+                                  mgp_vertex_id{vertex_ids[i].AsInt()}),
+              i);
+  }
+  size_t index{0};
+  EXPECT_EQ(mgp_graph_projection_vertex_index(projection, mgp_vertex_id{vertex_ids[2].AsInt() + 1}, &index),
+            mgp_error::MGP_ERROR_OUT_OF_RANGE);
+  mgp_graph_projection_destroy(projection);
+}
@@ -167,6 +167,45 @@ TEST(Rpc, ClientPool) {
   server.AwaitShutdown();
 }
 
+TEST(Rpc, DedicatedWorkers) {
+  memgraph::communication::ServerContext server_context;
+  Server server({"127.0.0.1", 0}, &server_context, 1, 1);
+  auto const on_exit = memgraph::utils::OnScopeExit{[&] {
+    server.Shutdown();
+    server.AwaitShutdown();
+  }};
+  server.Register<Sum>([](auto *req_reader, auto *res_builder) {
+    SumReq req;
+    memgraph::slk::Load(&req, req_reader);
+    std::this_thread::sleep_for(500ms);
+    SumRes res(req.x + req.y);
+    memgraph::slk::Save(res, res_builder);
+  });
+  server.RegisterDedicated<Echo>([](auto *req_reader, auto *res_builder) {
+    EchoMessage res;
+    memgraph::slk::Load(&res, req_reader);
+    memgraph::slk::Save(res, res_builder);
+  });
+  ASSERT_TRUE(server.Start());
+  std::this_thread::sleep_for(100ms);
+
+  memgraph::communication::ClientContext client_context;
+  Client client(server.endpoint(), &client_context);
+  Client dedicated_client(server.endpoint(), &client_context);
+  // Move the connection to the dedicated worker
+  EXPECT_EQ(dedicated_client.Call<Echo>("first").data, "first");
+
+  std::thread thread([&client]() { EXPECT_EQ(client.Call<Sum>(10, 20).sum, 30); });
+  std::this_thread::sleep_for(100ms);
+
+  // The only regular worker is busy, but the dedicated one answers
+  memgraph::utils::Timer timer;
+  EXPECT_EQ(dedicated_client.Call<Echo>("second").data, "second");
+  EXPECT_LT(timer.Elapsed(), 200ms);
+
+  thread.join();
+}
+
 TEST(Rpc, LargeMessage) {
   memgraph::communication::ServerContext server_context;
   Server server({"127.0.0.1", 0}, &server_context);
@@ -492,6 +492,48 @@ TEST(SkipList, FindEqualOrGreater) {
   }
 }
 
+TEST(SkipList, SplitPoints) {
+  memgraph::utils::SkipList<uint64_t> list;
+
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.split_points(4).empty());
+    for (uint64_t i = 0; i < 10000; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+  }
+
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.split_points(0).empty());
+    ASSERT_TRUE(acc.split_points(1).empty());
+    for (uint64_t num_chunks : {2, 4, 16, 64}) {
+      auto points = acc.split_points(num_chunks);
+      ASSERT_EQ(points.size(), num_chunks - 1);
+      // The boundaries are strictly increasing, so the chunks are disjoint and
+      // none of them is empty.
+      uint64_t previous = 0;
+      for (const auto &point : points) {
+        ASSERT_GT(*point, previous);
+        previous = *point;
+      }
+    }
+  }
+
+  {
+    // A list with fewer items than chunks is split into single items.
+    memgraph::utils::SkipList<uint64_t> small;
+    auto acc = small.access();
+    for (uint64_t i = 0; i < 3; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+    auto points = acc.split_points(8);
+    ASSERT_EQ(points.size(), 2);
+    ASSERT_EQ(*points[0], 1);
+    ASSERT_EQ(*points[1], 2);
+  }
+}
+
 struct Counter {
   int64_t key;
   int64_t value;
@@ -415,6 +415,8 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case memgraph::storage::durability::Marker::DELTA_LABEL_INDEX_DROP:
         case memgraph::storage::durability::Marker::DELTA_POINT_INDEX_CREATE:
         case memgraph::storage::durability::Marker::DELTA_POINT_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
         case memgraph::storage::durability::Marker::DELTA_LABEL_INDEX_STATS_SET:
         case memgraph::storage::durability::Marker::DELTA_LABEL_INDEX_STATS_CLEAR:
         case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_INDEX_CREATE:
@@ -0,0 +1,92 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "storage/v2/disk/object_cache.hpp"
+
+using memgraph::storage::DiskObjectCache;
+using memgraph::storage::Gid;
+
+TEST(DiskObjectCache, Disabled) {
+  DiskObjectCache<std::string> cache(0);
+  cache.Insert(Gid::FromUint(1), "value", 10, cache.Epoch());
+  EXPECT_EQ(cache.Find(Gid::FromUint(1), 10), nullptr);
+}
+
+TEST(DiskObjectCache, VisibleFromReadUntilWrite) {
+  DiskObjectCache<std::string> cache(16);
+  const auto gid = Gid::FromUint(1);
+  cache.Insert(gid, "old", 10, cache.Epoch());
+
+  // Older transactions might have seen an older version.
+  EXPECT_EQ(cache.Find(gid, 9), nullptr);
+  ASSERT_NE(cache.Find(gid, 10), nullptr);
+  EXPECT_EQ(*cache.Find(gid, 20), "old");
+
+  cache.Invalidate(gid, 15);
+  EXPECT_EQ(*cache.Find(gid, 14), "old");
+  EXPECT_EQ(cache.Find(gid, 16), nullptr);
+
+  // Readers of snapshots before the write don't know when their version ends.
+  cache.Insert(gid, "old", 12, cache.Epoch());
+  EXPECT_EQ(cache.Find(gid, 16), nullptr);
+
+  cache.Insert(gid, "new", 16, cache.Epoch());
+  EXPECT_EQ(*cache.Find(gid, 16), "new");
+  EXPECT_EQ(cache.Find(gid, 14), nullptr);
+}
+
+TEST(DiskObjectCache, WriteDuringReadIsNotCached) {
+  DiskObjectCache<std::string> cache(16);
+  const auto gid = Gid::FromUint(1);
+
+  // The reader started after the commit, but read the object before the writes
+  // were committed.
+  const auto epoch = cache.Epoch();
+  cache.Invalidate(gid, 5);
+  cache.Insert(gid, "stale", 10, epoch);
+  EXPECT_EQ(cache.Find(gid, 10), nullptr);
+
+  // Same, but the invalidation comes after the object is cached.
+  cache.Insert(Gid::FromUint(2), "stale", 10, cache.Epoch());
+  cache.Invalidate(Gid::FromUint(2), 5);
+  EXPECT_EQ(cache.Find(Gid::FromUint(2), 10), nullptr);
+}
+
+TEST(DiskObjectCache, ClockEviction) {
+  DiskObjectCache<std::string> cache(2);
+  cache.Insert(Gid::FromUint(1), "1", 10, cache.Epoch());
+  cache.Insert(Gid::FromUint(2), "2", 10, cache.Epoch());
+  // Referenced objects get a second chance.
+  ASSERT_NE(cache.Find(Gid::FromUint(1), 10), nullptr);
+
+  cache.Insert(Gid::FromUint(3), "3", 10, cache.Epoch());
+  EXPECT_EQ(cache.Size(), 2U);
+  EXPECT_NE(cache.Find(Gid::FromUint(1), 10), nullptr);
+  EXPECT_EQ(cache.Find(Gid::FromUint(2), 10), nullptr);
+  EXPECT_NE(cache.Find(Gid::FromUint(3), 10), nullptr);
+}
+
+TEST(DiskObjectCache, EvictedInvalidationsAreRemembered) {
+  DiskObjectCache<std::string> cache(1);
+  const auto epoch = cache.Epoch();
+  cache.Invalidate(Gid::FromUint(1), 15);
+  // Evicts the invalidation of the first object.
+  cache.Insert(Gid::FromUint(2), "2", 20, cache.Epoch());
+
+  cache.Insert(Gid::FromUint(1), "1", 10, epoch);
+  EXPECT_EQ(cache.Find(Gid::FromUint(1), 10), nullptr);
+  cache.Insert(Gid::FromUint(1), "1", 20, cache.Epoch());
+  EXPECT_NE(cache.Find(Gid::FromUint(1), 20), nullptr);
+}
@@ -21,6 +21,7 @@
 #include <csignal>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <thread>
 #include <type_traits>
@@ -1692,6 +1693,60 @@ TEST_P(DurabilityTest, WalBackup) {
   ASSERT_EQ(GetBackupWalsList().size(), num_wals);
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommit) {
+  constexpr uint64_t kNumThreads = 8;
+  constexpr uint64_t kNumTransactions = 200;
+  // Create WALs from concurrent committers.
+  {
+    memgraph::storage::Config config{
+
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_file_size_kibibytes = 1,
+                       .wal_group_commit = true},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    std::vector<std::thread> threads;
+    threads.reserve(kNumThreads);
+    for (uint64_t i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back([&db] {
+        for (uint64_t j = 0; j < kNumTransactions; ++j) {
+          auto acc = db.Access();
+          acc->CreateVertex();
+          ASSERT_FALSE(acc->Commit().HasError());
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 2);
+
+  // Recover WALs.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  {
+    auto acc = db.Access();
+    uint64_t count = 0;
+    for ([[maybe_unused]] auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      ++count;
+    }
+    ASSERT_EQ(count, kNumThreads * kNumTransactions);
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalAppendToExisting) {
   // Create WALs.
@@ -3110,6 +3165,102 @@ TEST_P(DurabilityTest, ParallelConstraintsRecovery) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, ParallelSnapshotCreation) {
+  // Create snapshot from multiple segments.
+  {
+    memgraph::storage::Config config{
+
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_on_exit = true,
+                       .items_per_batch = 13,
+                       .snapshot_thread_count = 4},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+    CreateExtendedDataset(db.storage());
+    VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  // Segment files are removed once they are copied into the snapshot.
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+  ASSERT_EQ(GetWalsList().size(), 0);
+
+  // Leftover segments of a snapshot which wasn't finished get deleted on startup.
+  const auto segment_directory = storage_directory / memgraph::storage::durability::kSnapshotDirectory /
+                                 memgraph::storage::durability::kSnapshotSegmentsDirectory;
+  memgraph::utils::EnsureDirOrDie(segment_directory);
+  std::ofstream(segment_directory / "unfinished_snapshot_0") << "segment";
+  ASSERT_EQ(GetSnapshotsList().size(), 2);
+
+  // Recover snapshot on a single thread.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .recover_on_startup = true,
+                     .snapshot_on_exit = false,
+                     .items_per_batch = 13,
+                     .recovery_thread_count = 1},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotSkipThreshold) {
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .snapshot_skip_threshold_percent = 50},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    auto *mem_storage = static_cast<memgraph::storage::InMemoryStorage *>(db.storage());
+    CreateBaseDataset(db.storage(), GetParam());
+
+    // The first periodic snapshot is always created.
+    ASSERT_FALSE(mem_storage->CreateSnapshot(ReplicationRole::MAIN, true).HasError());
+    ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+    // Nothing changed since the last snapshot.
+    ASSERT_FALSE(mem_storage->CreateSnapshot(ReplicationRole::MAIN, true).HasError());
+    ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+    // Explicit snapshots are always created.
+    ASSERT_FALSE(mem_storage->CreateSnapshot(ReplicationRole::MAIN).HasError());
+    ASSERT_EQ(GetSnapshotsList().size(), 2);
+
+    // The extended dataset is small compared to the base dataset and is kept
+    // in the WAL files only.
+    CreateExtendedDataset(db.storage());
+    ASSERT_FALSE(mem_storage->CreateSnapshot(ReplicationRole::MAIN, true).HasError());
+    ASSERT_EQ(GetSnapshotsList().size(), 2);
+    VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 2);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover the last snapshot followed by the WAL files.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  ASSERT_FALSE(std::filesystem::exists(segment_directory));
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, ConstraintsRecoveryFunctionSetting) {
   memgraph::storage::Config config{
@@ -13,6 +13,7 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <vector>
 
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/storage.hpp"
@@ -5414,3 +5415,154 @@ TEST(StorageWithProperties, EdgeNonexistentPropertyAPI) {
 
   ASSERT_FALSE(acc->Commit().HasError());
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, FrozenAdjacency) {
+  auto *mem_store = new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}});
+  std::unique_ptr<memgraph::storage::Storage> store(mem_store);
+  auto et1 = store->NameToEdgeType("et1");
+  auto et2 = store->NameToEdgeType("et2");
+  auto et3 = store->NameToEdgeType("et3");
+
+  constexpr int kNumNeighbours = 10;
+  memgraph::storage::Gid gid_hub = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  std::vector<memgraph::storage::Gid> gid_neighbours;
+  {
+    auto acc = store->Access();
+    auto hub = acc->CreateVertex();
+    gid_hub = hub.Gid();
+    // Interleave the edge types so the edge list starts out unsorted.
+    for (int i = 0; i < kNumNeighbours; ++i) {
+      auto neighbour = acc->CreateVertex();
+      gid_neighbours.push_back(neighbour.Gid());
+      ASSERT_TRUE(acc->CreateEdge(&hub, &neighbour, i % 2 == 0 ? et1 : et2).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&neighbour, &hub, et2).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  mem_store->FreezeAdjacency();
+
+  auto count_out = [](auto &vertex, std::vector<memgraph::storage::EdgeTypeId> const &edge_types,
+                      const memgraph::storage::VertexAccessor *destination = nullptr) {
+    return vertex.OutEdges(memgraph::storage::View::NEW, edge_types, destination)->edges.size();
+  };
+
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    ASSERT_EQ(count_out(*hub, {et1}), kNumNeighbours / 2);
+    ASSERT_EQ(count_out(*hub, {et2}), kNumNeighbours / 2);
+    ASSERT_EQ(count_out(*hub, {et3}), 0);
+    ASSERT_EQ(count_out(*hub, {et1, et2, et1}), kNumNeighbours);
+    ASSERT_EQ(hub->InEdges(memgraph::storage::View::NEW, {et2})->edges.size(), kNumNeighbours);
+    for (auto const &edge : hub->OutEdges(memgraph::storage::View::NEW, {et1})->edges) {
+      ASSERT_EQ(edge.EdgeType(), et1);
+    }
+
+    auto first = acc->FindVertex(gid_neighbours[0], memgraph::storage::View::OLD);
+    auto second = acc->FindVertex(gid_neighbours[1], memgraph::storage::View::OLD);
+    ASSERT_EQ(count_out(*hub, {et1}, &*first), 1);
+    ASSERT_EQ(count_out(*hub, {et2}, &*first), 0);
+    ASSERT_EQ(count_out(*hub, {et2}, &*second), 1);
+
+    // Modifications made after freezing are still visible.
+    ASSERT_TRUE(acc->CreateEdge(&*hub, &*first, et3).HasValue());
+    ASSERT_EQ(count_out(*hub, {et3}), 1);
+    ASSERT_EQ(count_out(*hub, {et3}, &*first), 1);
+    auto edges = hub->OutEdges(memgraph::storage::View::NEW, {et2}, &*second)->edges;
+    ASSERT_EQ(edges.size(), 1);
+    ASSERT_TRUE(acc->DeleteEdge(&edges[0]).HasValue());
+    ASSERT_EQ(count_out(*hub, {et2}), kNumNeighbours / 2 - 1);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  mem_store->FreezeAdjacency();
+
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    ASSERT_EQ(count_out(*hub, {et1}), kNumNeighbours / 2);
+    ASSERT_EQ(count_out(*hub, {et2}), kNumNeighbours / 2 - 1);
+    ASSERT_EQ(count_out(*hub, {et3}), 1);
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::NEW)->edges.size(), kNumNeighbours);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, SupernodeAdjacency) {
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.salient = {.items = {.properties_on_edges = GetParam(), .freeze_adjacency_degree = 8}}}));
+  std::vector<memgraph::storage::EdgeTypeId> edge_types{store->NameToEdgeType("et1"), store->NameToEdgeType("et2"),
+                                                        store->NameToEdgeType("et3")};
+
+  // Enough edges to freeze the hub and merge its unmerged tail a few times.
+  constexpr int kNumEdges = 1000;
+  memgraph::storage::Gid gid_hub = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  memgraph::storage::Gid gid_neighbour = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  {
+    auto acc = store->Access();
+    auto hub = acc->CreateVertex();
+    auto neighbour = acc->CreateVertex();
+    gid_hub = hub.Gid();
+    gid_neighbour = neighbour.Gid();
+    for (int i = 0; i < kNumEdges; ++i) {
+      auto other = acc->CreateVertex();
+      ASSERT_TRUE(acc->CreateEdge(&hub, &other, edge_types[i % 3]).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&other, &hub, edge_types[i % 3]).HasValue());
+    }
+    ASSERT_TRUE(acc->CreateEdge(&hub, &neighbour, edge_types[2]).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto count_edges = [&](memgraph::storage::View view, std::vector<memgraph::storage::EdgeTypeId> const &types,
+                         bool out = true) {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    MG_ASSERT(hub);
+    return out ? hub->OutEdges(view, types)->edges.size() : hub->InEdges(view, types)->edges.size();
+  };
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[0]}), 334);
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[1]}), 333);
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[2]}), 334);
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[1]}, false), 333);
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {}), kNumEdges + 1);
+
+  // Aborted modifications are undone on the frozen edge lists.
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    auto neighbour = acc->FindVertex(gid_neighbour, memgraph::storage::View::OLD);
+    auto edges = hub->OutEdges(memgraph::storage::View::OLD, {edge_types[0]})->edges;
+    for (auto &edge : edges) {
+      ASSERT_TRUE(acc->DeleteEdge(&edge).HasValue());
+    }
+    ASSERT_TRUE(acc->CreateEdge(&*hub, &*neighbour, edge_types[0]).HasValue());
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::NEW, {edge_types[0]})->edges.size(), 1);
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::NEW, {edge_types[0]}, &*neighbour)->edges.size(), 1);
+    acc->Abort();
+  }
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[0]}), 334);
+
+  // Committed modifications keep the edge lists consistent.
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    auto neighbour = acc->FindVertex(gid_neighbour, memgraph::storage::View::OLD);
+    auto edges = hub->OutEdges(memgraph::storage::View::OLD, {edge_types[1]})->edges;
+    for (size_t i = 0; i < edges.size(); i += 2) {
+      ASSERT_TRUE(acc->DeleteEdge(&edges[i]).HasValue());
+    }
+    auto to_neighbour = hub->OutEdges(memgraph::storage::View::OLD, {edge_types[2]}, &*neighbour)->edges;
+    ASSERT_EQ(to_neighbour.size(), 1);
+    ASSERT_TRUE(acc->EdgeChangeType(&to_neighbour[0], edge_types[0]).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[0]}), 335);
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[1]}), 166);
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[2]}), 333);
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {edge_types[1]}, false), 333);
+  ASSERT_EQ(count_edges(memgraph::storage::View::OLD, {}), kNumEdges + 1 - 167);
+}
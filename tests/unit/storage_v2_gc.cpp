@@ -13,6 +13,11 @@
 #include <gtest/gtest.h>
 
 #include "storage/v2/inmemory/storage.hpp"
+#include "utils/event_gauge.hpp"
+
+namespace memgraph::metrics {
+extern const Event GCBacklogTransactions;
+}  // namespace memgraph::metrics
 
 using memgraph::replication_coordination_glue::ReplicationRole;
 using testing::UnorderedElementsAre;
@@ -204,3 +209,152 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// Periodic runs limited by `max_transactions_per_run` unlink only part of the
+// committed transactions and leave the rest for the following runs, forced runs
+// unlink all of them. The transactions are unlinked on multiple GC workers.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, LimitedParallelRuns) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE, .workers = 4, .max_transactions_per_run = 10}}));
+
+  std::vector<memgraph::storage::Gid> vertices;
+  {
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < 100; ++i) {
+      vertices.push_back(acc->CreateVertex().Gid());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  for (auto gid : vertices) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(acc->DeleteVertex(&vertex.value()).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  // 101 committed transactions, 10 of them get unlinked.
+  storage->FreeMemory({}, true);
+  EXPECT_EQ(memgraph::metrics::GetGaugeValue(memgraph::metrics::GCBacklogTransactions), 91U);
+  EXPECT_GT(storage->Access()->ApproximateVertexCount(), 0U);
+
+  storage->FreeMemory({}, false);
+  EXPECT_EQ(memgraph::metrics::GetGaugeValue(memgraph::metrics::GCBacklogTransactions), 0U);
+  EXPECT_EQ(storage->Access()->ApproximateVertexCount(), 0U);
+}
+
+// Committing transactions merge their property deltas with older deltas on the
+// same property as long as no running transaction can see the versions in
+// between.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, MergedPropertyDeltas) {
+  std::unique_ptr<memgraph::storage::Storage> storage(std::make_unique<memgraph::storage::InMemoryStorage>(
+      memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE},
+                                .salient = {.items = {.merge_property_deltas = true}}}));
+
+  memgraph::storage::Gid gid;
+  memgraph::storage::PropertyId property;
+  {
+    auto acc = storage->Access();
+    gid = acc->CreateVertex().Gid();
+    property = acc->NameToProperty("count");
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  const auto set_property = [&](std::initializer_list<int64_t> values) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    for (auto value : values) {
+      ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(value)).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  };
+  const auto chain_length = [&] {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    uint64_t length = 0;
+    for (auto *delta = vertex->vertex_->delta; delta != nullptr; delta = delta->next.load()) ++length;
+    return length;
+  };
+  const auto get_property = [&](auto &acc) {
+    return *acc->FindVertex(gid, memgraph::storage::View::OLD)->GetProperty(property, memgraph::storage::View::OLD);
+  };
+
+  // Keeps the deltas from being discarded at commit.
+  auto reader = storage->Access();
+
+  set_property({1, 2, 3});
+  EXPECT_EQ(chain_length(), 1U);
+  set_property({4});
+  EXPECT_EQ(chain_length(), 1U);
+
+  auto other_reader = storage->Access();
+  set_property({5});
+  EXPECT_EQ(chain_length(), 2U);
+
+  EXPECT_TRUE(get_property(reader).IsNull());
+  EXPECT_EQ(get_property(other_reader), memgraph::storage::PropertyValue(4));
+  {
+    auto acc = storage->Access();
+    EXPECT_EQ(get_property(acc), memgraph::storage::PropertyValue(5));
+  }
+
+  reader.reset();
+  other_reader.reset();
+  storage->FreeMemory({}, false);
+  EXPECT_EQ(chain_length(), 0U);
+}
+
+// A reader whose snapshot is older than all merged deltas still sees the value
+// from before them, and a reader which started between two commits keeps its
+// version.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, MergedPropertyDeltasOlderSnapshot) {
+  std::unique_ptr<memgraph::storage::Storage> storage(std::make_unique<memgraph::storage::InMemoryStorage>(
+      memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE},
+                                .salient = {.items = {.merge_property_deltas = true}}}));
+
+  memgraph::storage::Gid gid;
+  memgraph::storage::PropertyId property;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    property = acc->NameToProperty("count");
+    ASSERT_FALSE(vertex.SetProperty(property, memgraph::storage::PropertyValue(0)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  const auto set_property = [&](int64_t value) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(value)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  };
+  const auto get_property = [&](auto &acc) {
+    return *acc->FindVertex(gid, memgraph::storage::View::OLD)->GetProperty(property, memgraph::storage::View::OLD);
+  };
+
+  auto reader = storage->Access();
+  EXPECT_EQ(get_property(reader), memgraph::storage::PropertyValue(0));
+
+  // Every commit merges its delta into the previous one, so the chain ends up
+  // with a single delta restoring the value the reader saw.
+  for (int64_t value = 1; value <= 10; ++value) {
+    set_property(value);
+    EXPECT_EQ(get_property(reader), memgraph::storage::PropertyValue(0));
+  }
+
+  auto middle_reader = storage->Access();
+  for (int64_t value = 11; value <= 20; ++value) {
+    set_property(value);
+    EXPECT_EQ(get_property(reader), memgraph::storage::PropertyValue(0));
+    EXPECT_EQ(get_property(middle_reader), memgraph::storage::PropertyValue(10));
+  }
+  {
+    auto acc = storage->Access();
+    EXPECT_EQ(get_property(acc), memgraph::storage::PropertyValue(20));
+  }
+}
@@ -2156,3 +2156,179 @@ TYPED_TEST(IndexTest, EdgeTypePropertyIndexRepeatingEdgeTypesBetweenSameVertices
   EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, this->edge_prop_id1, View::NEW), View::NEW),
               UnorderedElementsAre(1, 2, 3, 4, 5));
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(IndexHashLookupTest, LabelPropertyIndexEqualityLookup) {
+  memgraph::storage::Config config{.salient = {.items = {.label_property_index_hash_lookups = true}}};
+  std::unique_ptr<Storage> storage = std::make_unique<InMemoryStorage>(config);
+  PropertyId prop_id;
+  PropertyId prop_val;
+  LabelId label;
+  {
+    auto acc = storage->Access();
+    prop_id = acc->NameToProperty("id");
+    prop_val = acc->NameToProperty("val");
+    label = acc->NameToLabel("label");
+  }
+  auto get_ids = [&](Storage::Accessor *acc, const PropertyValue &value, View view) {
+    std::vector<int64_t> ret;
+    for (auto vertex : acc->Vertices(label, prop_val, value, view)) {
+      ret.push_back(vertex.GetProperty(prop_id, view)->ValueInt());
+    }
+    return ret;
+  };
+
+  {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < 10; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_id, PropertyValue(i)));
+      ASSERT_NO_ERROR(vertex.AddLabel(label));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(i % 3)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // Entries of existing vertices are added when the index is created.
+  {
+    auto unique_acc = storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(label, prop_val).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  {
+    auto acc = storage->Access();
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue(0), View::OLD), UnorderedElementsAre(0, 3, 6, 9));
+    // Integers and doubles that compare equal are found by the same lookup.
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue(1.0), View::OLD), UnorderedElementsAre(1, 4, 7));
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue(3), View::OLD), IsEmpty());
+
+    for (auto vertex : acc->Vertices(label, prop_val, PropertyValue(2), View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue("two")));
+    }
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue(2), View::OLD), UnorderedElementsAre(2, 5, 8));
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue(2), View::NEW), IsEmpty());
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue("two"), View::NEW), UnorderedElementsAre(2, 5, 8));
+    acc->Abort();
+  }
+
+  storage->FreeMemory({}, false);
+
+  {
+    auto acc = storage->Access();
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue(2), View::OLD), UnorderedElementsAre(2, 5, 8));
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue("two"), View::OLD), IsEmpty());
+
+    for (auto vertex : acc->Vertices(label, prop_val, PropertyValue(0), View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_val, PropertyValue(1)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  storage->FreeMemory({}, false);
+
+  {
+    auto acc = storage->Access();
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue(0), View::OLD), IsEmpty());
+    EXPECT_THAT(get_ids(acc.get(), PropertyValue(1), View::OLD), UnorderedElementsAre(0, 1, 3, 4, 6, 7, 9));
+    // Range lookups still use the skip list.
+    std::vector<int64_t> range_ids;
+    for (auto vertex : acc->Vertices(label, prop_val, memgraph::utils::MakeBoundInclusive(PropertyValue(1)),
+                                     memgraph::utils::MakeBoundInclusive(PropertyValue(2)), View::OLD)) {
+      range_ids.push_back(vertex.GetProperty(prop_id, View::OLD)->ValueInt());
+    }
+    EXPECT_THAT(range_ids, UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(CompositeIndexTest, PrefixAndRangeLookup) {
+  std::unique_ptr<Storage> storage = std::make_unique<InMemoryStorage>();
+  PropertyId prop_id;
+  PropertyId prop_tenant;
+  PropertyId prop_created;
+  LabelId label;
+  {
+    auto acc = storage->Access();
+    prop_id = acc->NameToProperty("id");
+    prop_tenant = acc->NameToProperty("tenant");
+    prop_created = acc->NameToProperty("created");
+    label = acc->NameToLabel("label");
+  }
+  const std::vector<PropertyId> properties{prop_tenant, prop_created};
+  auto get_ids = [&](Storage::Accessor *acc, const std::vector<PropertyValue> &prefix,
+                     const std::optional<memgraph::utils::Bound<PropertyValue>> &lower,
+                     const std::optional<memgraph::utils::Bound<PropertyValue>> &upper, View view) {
+    std::vector<int64_t> ret;
+    for (auto vertex : acc->Vertices(label, properties, prefix, lower, upper, view)) {
+      ret.push_back(vertex.GetProperty(prop_id, view)->ValueInt());
+    }
+    return ret;
+  };
+
+  {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < 12; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_id, PropertyValue(i)));
+      ASSERT_NO_ERROR(vertex.AddLabel(label));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_tenant, PropertyValue(i % 3)));
+      // Vertices without all of the properties aren't indexed.
+      if (i != 11) ASSERT_NO_ERROR(vertex.SetProperty(prop_created, PropertyValue(i)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  {
+    auto unique_acc = storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(label, properties).HasError());
+    EXPECT_TRUE(unique_acc->CreateIndex(label, properties).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  {
+    auto acc = storage->Access();
+    EXPECT_TRUE(acc->LabelPropertyIndexExists(label, properties));
+    EXPECT_FALSE(acc->LabelPropertyIndexExists(label, std::vector{prop_created, prop_tenant}));
+    EXPECT_EQ(acc->ApproximateVertexCount(label, properties), 11);
+
+    EXPECT_THAT(get_ids(acc.get(), {PropertyValue(1)}, std::nullopt, std::nullopt, View::OLD),
+                UnorderedElementsAre(1, 4, 7, 10));
+    EXPECT_THAT(get_ids(acc.get(), {PropertyValue(2), PropertyValue(5)}, std::nullopt, std::nullopt, View::OLD),
+                UnorderedElementsAre(5));
+    EXPECT_THAT(get_ids(acc.get(), {PropertyValue(0)}, memgraph::utils::MakeBoundExclusive(PropertyValue(3)),
+                        memgraph::utils::MakeBoundInclusive(PropertyValue(9)), View::OLD),
+                UnorderedElementsAre(6, 9));
+    EXPECT_THAT(get_ids(acc.get(), {PropertyValue(1)}, std::nullopt, memgraph::utils::MakeBoundExclusive(PropertyValue(7)),
+                        View::OLD),
+                UnorderedElementsAre(1, 4));
+
+    // Changing a property of the prefix moves the vertex to the other prefix.
+    for (auto vertex : acc->Vertices(label, properties, {PropertyValue(2)}, std::nullopt, std::nullopt, View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_tenant, PropertyValue(1)));
+    }
+    EXPECT_THAT(get_ids(acc.get(), {PropertyValue(2)}, std::nullopt, std::nullopt, View::NEW), IsEmpty());
+    EXPECT_THAT(get_ids(acc.get(), {PropertyValue(1)}, std::nullopt, std::nullopt, View::NEW),
+                UnorderedElementsAre(1, 2, 4, 5, 7, 8, 10));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  storage->FreeMemory({}, false);
+
+  {
+    auto acc = storage->Access();
+    EXPECT_THAT(get_ids(acc.get(), {PropertyValue(2)}, std::nullopt, std::nullopt, View::OLD), IsEmpty());
+    EXPECT_THAT(get_ids(acc.get(), {PropertyValue(1)}, memgraph::utils::MakeBoundInclusive(PropertyValue(5)),
+                        std::nullopt, View::OLD),
+                UnorderedElementsAre(5, 7, 8, 10));
+    EXPECT_EQ(acc->ApproximateVertexCount(label, properties), 11);
+  }
+
+  {
+    auto unique_acc = storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->DropIndex(label, properties).HasError());
+    EXPECT_TRUE(unique_acc->DropIndex(label, properties).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  EXPECT_FALSE(storage->Access()->LabelPropertyIndexExists(label, properties));
+}
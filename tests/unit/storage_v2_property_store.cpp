@@ -17,6 +17,7 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 
 using testing::UnorderedElementsAre;
@@ -843,6 +844,138 @@ TEST(PropertyStore, GetPropertyOfTypes) {
   ASSERT_EQ(prop_of_type3, std::nullopt);
 }
 
+TEST(PropertyStore, Directory) {
+  // Enough properties for the store to keep a directory of their offsets
+  const auto properties_count = static_cast<int>(2 * FLAGS_storage_property_store_directory_threshold + 2);
+  std::map<PropertyId, PropertyValue> expected;
+  PropertyStore store;
+  for (int i = properties_count; i > 0; --i) {
+    const auto &value = kSampleValues[(i % (std::size(kSampleValues) - 1)) + 1];
+    ASSERT_TRUE(store.SetProperty(PropertyId::FromInt(2 * i), value));
+    expected.emplace(PropertyId::FromInt(2 * i), value);
+  }
+
+  auto check_store = [&] {
+    ASSERT_EQ(store.Properties(), expected);
+    for (int i = 0; i <= 2 * properties_count + 1; ++i) {
+      const auto property = PropertyId::FromInt(i);
+      auto found = expected.find(property);
+      if (found == expected.end()) {
+        ASSERT_FALSE(store.HasProperty(property));
+        ASSERT_TRUE(store.GetProperty(property).IsNull());
+        ASSERT_TRUE(store.IsPropertyEqual(property, PropertyValue()));
+      } else {
+        ASSERT_TRUE(store.HasProperty(property));
+        ASSERT_EQ(store.GetProperty(property), found->second);
+        TestIsPropertyEqual(store, property, found->second);
+      }
+    }
+  };
+  check_store();
+
+  // Replacing a property moves the ones after it
+  ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(2), PropertyValue(std::string(1000, 'a'))));
+  expected[PropertyId::FromInt(2)] = PropertyValue(std::string(1000, 'a'));
+  check_store();
+
+  PropertyStore init_store;
+  ASSERT_TRUE(init_store.InitProperties(expected));
+  ASSERT_EQ(init_store.Properties(), expected);
+  ASSERT_EQ(init_store.GetProperty(PropertyId::FromInt(2 * properties_count)),
+            expected[PropertyId::FromInt(2 * properties_count)]);
+
+  // Removing properties below the threshold drops the directory
+  for (int i = 1; i <= properties_count - 2; ++i) {
+    ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(2 * i), PropertyValue()));
+    expected.erase(PropertyId::FromInt(2 * i));
+  }
+  check_store();
+
+  ASSERT_TRUE(store.ClearProperties());
+  ASSERT_TRUE(store.Properties().empty());
+}
+
+TEST(PropertyStore, DictionaryEncoding) {
+  StringDictionary dictionary;
+  const auto encoded = PropertyId::FromInt(1000);
+  const auto plain = PropertyId::FromInt(1001);
+  dictionary.EnableEncoding(encoded);
+  ASSERT_TRUE(dictionary.IsEncoded(encoded));
+  ASSERT_FALSE(dictionary.IsEncoded(plain));
+
+  const auto value = PropertyValue(std::string(100, 'c'));
+  const auto other_value = PropertyValue(std::string(100, 'd'));
+  const auto short_value = PropertyValue(std::string("short"));
+  const auto list = PropertyValue(std::vector<PropertyValue>{value, PropertyValue(1)});
+
+  PropertyStore first;
+  PropertyStore second;
+  ASSERT_TRUE(first.SetProperty(encoded, value, &dictionary));
+  ASSERT_EQ(dictionary.Size(), 1U);
+  ASSERT_TRUE(second.SetProperty(encoded, value, &dictionary));
+  ASSERT_TRUE(second.SetProperty(plain, value, &dictionary));
+  // The same string is interned only once
+  ASSERT_EQ(dictionary.Size(), 1U);
+  // The address takes less space than the string
+  ASSERT_LT(first.PropertySize(encoded), second.PropertySize(plain));
+
+  for (const auto *store : {&first, &second}) {
+    ASSERT_EQ(store->GetProperty(encoded), value);
+    ASSERT_TRUE(store->HasProperty(encoded));
+    TestIsPropertyEqual(*store, encoded, value);
+    ASSERT_FALSE(store->IsPropertyEqual(encoded, other_value));
+  }
+
+  // Short strings, non string values and strings nested in other values are
+  // stored as usual
+  ASSERT_FALSE(first.SetProperty(encoded, short_value, &dictionary));
+  ASSERT_EQ(first.GetProperty(encoded), short_value);
+  ASSERT_FALSE(first.SetProperty(encoded, list, &dictionary));
+  ASSERT_EQ(first.GetProperty(encoded), list);
+  ASSERT_EQ(dictionary.Size(), 1U);
+  ASSERT_FALSE(first.SetProperty(encoded, other_value, &dictionary));
+  ASSERT_EQ(first.GetProperty(encoded), other_value);
+  ASSERT_EQ(dictionary.Size(), 2U);
+
+  // Stores without a dictionary keep the strings inline
+  PropertyStore third;
+  ASSERT_TRUE(third.InitProperties(std::map<PropertyId, PropertyValue>{{encoded, value}}));
+  ASSERT_EQ(third.PropertySize(encoded), second.PropertySize(plain));
+
+  ASSERT_TRUE(first.ClearProperties());
+  ASSERT_TRUE(second.ClearProperties());
+  dictionary.Clear();
+  ASSERT_EQ(dictionary.Size(), 0U);
+}
+
+TEST(PropertyStore, DictionaryEncodingFull) {
+  StringDictionary dictionary(1);
+  const auto property = PropertyId::FromInt(1000);
+  dictionary.EnableEncoding(property);
+
+  const auto value = PropertyValue(std::string(100, 'c'));
+  const auto other_value = PropertyValue(std::string(100, 'd'));
+
+  PropertyStore first;
+  PropertyStore second;
+  PropertyStore inline_store;
+  ASSERT_TRUE(first.SetProperty(property, value, &dictionary));
+  ASSERT_TRUE(inline_store.SetProperty(property, other_value));
+  // Values which are already interned are still encoded
+  ASSERT_TRUE(second.SetProperty(property, value, &dictionary));
+  ASSERT_EQ(second.PropertySize(property), first.PropertySize(property));
+  ASSERT_EQ(dictionary.Size(), 1U);
+
+  // New values are stored inline once the dictionary is full
+  ASSERT_FALSE(second.SetProperty(property, other_value, &dictionary));
+  ASSERT_EQ(dictionary.Size(), 1U);
+  ASSERT_EQ(second.PropertySize(property), inline_store.PropertySize(property));
+  ASSERT_EQ(second.GetProperty(property), other_value);
+  TestIsPropertyEqual(second, property, other_value);
+  ASSERT_FALSE(second.IsPropertyEqual(property, value));
+  ASSERT_EQ(first.GetProperty(property), value);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   int result = RUN_ALL_TESTS();
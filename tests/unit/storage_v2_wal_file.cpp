@@ -50,6 +50,8 @@ memgraph::storage::durability::WalDeltaData::Type StorageMetadataOperationToWalD
     add_case(LABEL_PROPERTY_INDEX_DROP);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_DROP);
     add_case(LABEL_PROPERTY_INDEX_STATS_SET);
     add_case(LABEL_PROPERTY_INDEX_STATS_CLEAR);
     add_case(TEXT_INDEX_CREATE);
@@ -352,6 +354,18 @@ class DeltaGenerator final {
         });
         break;
       }
+      case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        // Keep the order of the property names, so it matches the expected delta
+        std::vector<memgraph::storage::PropertyId> property_list;
+        for (const auto &property : properties) {
+          property_list.push_back(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)));
+        }
+        apply_encode(operation, [&](memgraph::storage::durability::BaseEncoder &encoder) {
+          EncodeLabelPropertyList(encoder, mapper_, label_id, property_list);
+        });
+        break;
+      }
       case memgraph::storage::durability::StorageMetadataOperation::TYPE_CONSTRAINT_CREATE:
       case memgraph::storage::durability::StorageMetadataOperation::TYPE_CONSTRAINT_DROP: {
         apply_encode(operation, [&](memgraph::storage::durability::BaseEncoder &encoder) {
@@ -418,6 +432,11 @@ class DeltaGenerator final {
           data.operation_label_properties.label = label;
           data.operation_label_properties.properties = properties;
           break;
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+          data.operation_label_property_list.label = label;
+          data.operation_label_property_list.properties.assign(properties.begin(), properties.end());
+          break;
         case memgraph::storage::durability::StorageMetadataOperation::TYPE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::TYPE_CONSTRAINT_DROP:
           data.operation_label_property_type.label = label;
@@ -778,6 +797,8 @@ GENERATE_SIMPLE_TEST(AllGlobalOperations, {
   OPERATION_TX(EXISTENCE_CONSTRAINT_DROP, "hello", {"world"});
   OPERATION_TX(UNIQUE_CONSTRAINT_CREATE, "hello", {"world", "and", "universe"});
   OPERATION_TX(UNIQUE_CONSTRAINT_DROP, "hello", {"world", "and", "universe"});
+  OPERATION_TX(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE, "hello", {"world", "and", "universe"});
+  OPERATION_TX(LABEL_PROPERTY_COMPOSITE_INDEX_DROP, "hello", {"world", "and", "universe"});
   OPERATION_TX(TYPE_CONSTRAINT_CREATE, "hello", {"world"})
   OPERATION_TX(TYPE_CONSTRAINT_DROP, "hello", {"world"});
 });
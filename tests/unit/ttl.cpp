@@ -13,12 +13,17 @@
 #include <chrono>
 #include <filesystem>
 #include <thread>
+#include <vector>
 
 #include "dbms/database.hpp"
 #include "disk_test_utils.hpp"
 #include "flags/run_time_configurable.hpp"
+#include "query/config.hpp"
+#include "query/cypher_query_interpreter.hpp"
+#include "query/db_accessor.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/time_to_live/time_to_live.hpp"
+#include "query/trigger.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "utils/on_scope_exit.hpp"
@@ -185,6 +190,110 @@ TYPED_TEST(TTLFixture, Periodic) {
   }
 }
 
+// Expired vertices are deleted directly through the storage when there are no
+// triggers. With the :TTL(ttl) index they are found by a range scan of the
+// index, otherwise every vertex is scanned.
+TYPED_TEST(TTLFixture, DeleteExpired) {
+  auto ttl_lbl = this->db_->storage()->NameToLabel("TTL");
+  auto ttl_prop = this->db_->storage()->NameToProperty("ttl");
+  const auto now = std::chrono::system_clock::now();
+  const auto older = now - std::chrono::seconds(10);
+  const auto older_ts = std::chrono::duration_cast<std::chrono::microseconds>(older.time_since_epoch()).count();
+  const auto newer = now + std::chrono::hours(1);
+  const auto newer_ts = std::chrono::duration_cast<std::chrono::microseconds>(newer.time_since_epoch()).count();
+
+  for (const bool with_index : {false, true}) {
+    if (with_index) {
+      auto unique_acc = this->db_->UniqueAccess();
+      ASSERT_FALSE(unique_acc->CreateIndex(ttl_lbl, ttl_prop).HasError());
+      ASSERT_FALSE(unique_acc->Commit().HasError());
+    }
+    {
+      auto acc = this->db_->Access();
+      ASSERT_EQ(acc->LabelPropertyIndexExists(ttl_lbl, ttl_prop), with_index);
+      auto other = acc->CreateVertex();
+      for (const auto ts : {older_ts, older_ts + 1, newer_ts}) {
+        auto v = acc->CreateVertex();
+        ASSERT_FALSE(v.AddLabel(ttl_lbl).HasError());
+        ASSERT_FALSE(v.SetProperty(ttl_prop, memgraph::storage::PropertyValue(ts)).HasError());
+        ASSERT_FALSE(acc->CreateEdge(&v, &other, acc->NameToEdgeType("E")).HasError());
+      }
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+
+    this->ttl_->Enable();
+    this->ttl_->Configure(memgraph::query::ttl::TtlInfo{std::chrono::milliseconds(100), {}});
+    EXPECT_NO_THROW(this->ttl_->Setup(this->db_, &this->interpreter_context_));
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    this->ttl_->Stop();
+
+    auto acc = this->db_->Access();
+    size_t vertices = 0;
+    size_t edges = 0;
+    for (auto v : acc->Vertices(memgraph::storage::View::NEW)) {
+      ++vertices;
+      edges += v.OutDegree(memgraph::storage::View::NEW).GetValue();
+    }
+    // Only the vertex with the newer timestamp and its edge are left
+    EXPECT_EQ(vertices, 2);
+    EXPECT_EQ(edges, 1);
+    std::vector<memgraph::storage::VertexAccessor> left;
+    for (auto v : acc->Vertices(memgraph::storage::View::NEW)) left.push_back(v);
+    std::vector<memgraph::storage::VertexAccessor *> nodes;
+    for (auto &v : left) nodes.push_back(&v);
+    ASSERT_TRUE(acc->DetachDelete(std::move(nodes), {}, true).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+}
+
+// Triggers only run for queries, so with a trigger registered the expired
+// vertices are deleted through the interpreter.
+TYPED_TEST(TTLFixture, DeleteExpiredWithTrigger) {
+  auto ttl_lbl = this->db_->storage()->NameToLabel("TTL");
+  auto ttl_prop = this->db_->storage()->NameToProperty("ttl");
+  auto deleted_lbl = this->db_->storage()->NameToLabel("Deleted");
+  const auto older = std::chrono::system_clock::now() - std::chrono::seconds(10);
+  const auto older_ts = std::chrono::duration_cast<std::chrono::microseconds>(older.time_since_epoch()).count();
+  {
+    auto acc = this->db_->Access();
+    for (int i = 0; i < 2; ++i) {
+      auto v = acc->CreateVertex();
+      ASSERT_FALSE(v.AddLabel(ttl_lbl).HasError());
+      ASSERT_FALSE(v.SetProperty(ttl_prop, memgraph::storage::PropertyValue(older_ts)).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  memgraph::utils::SkipList<memgraph::query::QueryCacheEntry> ast_cache;
+  {
+    auto acc = this->db_->Access();
+    memgraph::query::DbAccessor dba(acc.get());
+    this->db_->trigger_store()->AddTrigger(
+        "ttl_trigger", "UNWIND deletedVertices AS v CREATE (:Deleted)", {},
+        memgraph::query::TriggerEventType::VERTEX_DELETE, memgraph::query::TriggerPhase::BEFORE_COMMIT, &ast_cache,
+        &dba, memgraph::query::InterpreterConfig::Query{}, this->auth_checker.GenQueryUser(std::nullopt, std::nullopt));
+  }
+  ASSERT_TRUE(this->db_->trigger_store()->HasTriggers());
+
+  this->ttl_->Enable();
+  this->ttl_->Configure(memgraph::query::ttl::TtlInfo{std::chrono::milliseconds(100), {}});
+  EXPECT_NO_THROW(this->ttl_->Setup(this->db_, &this->interpreter_context_));
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+  this->ttl_->Stop();
+  this->db_->trigger_store()->DropAll();
+
+  auto acc = this->db_->Access();
+  size_t vertices = 0;
+  size_t deleted = 0;
+  for (auto v : acc->Vertices(memgraph::storage::View::NEW)) {
+    ++vertices;
+    if (*v.HasLabel(deleted_lbl, memgraph::storage::View::NEW)) ++deleted;
+  }
+  // The trigger replaced each expired vertex with a :Deleted one
+  EXPECT_EQ(vertices, 2);
+  EXPECT_EQ(deleted, 2);
+}
+
 TYPED_TEST(TTLFixture, StartTime) {
   auto lbl = this->db_->storage()->NameToLabel("L");
   auto prop = this->db_->storage()->NameToProperty("prop");
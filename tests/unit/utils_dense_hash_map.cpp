@@ -0,0 +1,91 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+
+#include "utils/dense_hash_map.hpp"
+#include "utils/memory.hpp"
+#include "utils/pmr/string.hpp"
+
+using namespace memgraph::utils;
+
+TEST(DenseHashMap, InsertAndFind) {
+  DenseHashMap<int64_t, int64_t> map(NewDeleteResource());
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(1), map.end());
+
+  // Multiples of a power of two have the same low bits.
+  constexpr int64_t kCount = 10000;
+  for (int64_t i = 0; i < kCount; ++i) {
+    auto [it, inserted] = map.try_emplace(i * 1024, i);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(it->second, i);
+  }
+  EXPECT_EQ(map.size(), kCount);
+
+  for (int64_t i = 0; i < kCount; ++i) {
+    auto it = map.find(i * 1024);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, i);
+    EXPECT_FALSE(map.contains(i * 1024 + 1));
+  }
+
+  auto [it, inserted] = map.try_emplace(5 * 1024, 42);
+  EXPECT_FALSE(inserted);
+  EXPECT_EQ(it->second, 5);
+  EXPECT_EQ(map.size(), kCount);
+}
+
+TEST(DenseHashMap, InsertionOrder) {
+  DenseHashMap<int64_t, int64_t> map(NewDeleteResource());
+  for (int64_t i = 100; i > 0; --i) {
+    map[i] += i;
+    map[i] += i;
+  }
+  int64_t expected = 100;
+  for (const auto &[key, value] : map) {
+    EXPECT_EQ(key, expected);
+    EXPECT_EQ(value, 2 * expected);
+    --expected;
+  }
+  EXPECT_EQ(expected, 0);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.find(1), map.end());
+  map[1] = 1;
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(DenseHashMap, PrehashedInsertAndMemoryResource) {
+  MonotonicBufferResource memory(1024);
+  DenseHashMap<pmr::string, pmr::string, std::hash<std::string_view>> map(&memory);
+  map.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    const auto key = std::to_string(i);
+    const auto hash = map.Hash(pmr::string(key, &memory));
+    map.Prefetch(hash);
+    auto [it, inserted] = map.try_emplace_hashed(hash, pmr::string(key, &memory), key + key);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(it->first.get_allocator().GetMemoryResource(), &memory);
+    EXPECT_EQ(it->second.get_allocator().GetMemoryResource(), &memory);
+  }
+  for (int i = 0; i < 100; ++i) {
+    const auto key = std::to_string(i);
+    auto it = map.find(pmr::string(key, &memory));
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(std::string_view(it->second), key + key);
+  }
+}
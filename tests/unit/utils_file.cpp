@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <map>
@@ -276,6 +277,33 @@ TEST_F(UtilsFileTest, OutputFileDescriptorLeackage) {
   }
 }
 
+TEST_F(UtilsFileTest, TryFlushingWhileReading) {
+  memgraph::utils::OutputFile handle;
+  handle.Open(storage / "existing_dir_777" / "existing_file_777",
+              memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  const uint8_t data = 1;
+  handle.Write(&data, 1);
+
+  handle.DisableFlushing();
+  ASSERT_FALSE(handle.TryFlushing());
+  ASSERT_EQ(handle.CurrentBuffer().second, 1);
+
+  std::atomic<bool> flushing{false};
+  std::thread waiter([&] {
+    handle.WaitForFlushing();
+    flushing = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(flushing);
+  handle.EnableFlushing();
+  waiter.join();
+  ASSERT_TRUE(flushing);
+
+  ASSERT_TRUE(handle.TryFlushing());
+  ASSERT_EQ(handle.CurrentBuffer().second, 0);
+  handle.Close();
+}
+
 TEST_F(UtilsFileTest, ConcurrentReadingAndWritting) {
   const auto file_path = storage / "existing_dir_777" / "existing_file_777";
   memgraph::utils::OutputFile handle;